@@ -1,11 +1,12 @@
-// Auto-generated from .\frogger_background.png
+// Auto-generated by frogger_host/assetgen from frogger_background.png,
+// do not edit.
 #pragma once
 #include <stdint.h>
 
 #define BG_NUM_SPRITES   11
 #define SPR_W         16
 #define SPR_H         16
-#define PALETTE_SIZE  14
+#define PALETTE_SIZE  16
 #define TILES_X       14
 #define TILES_Y       16
 
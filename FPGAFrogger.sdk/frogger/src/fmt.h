@@ -0,0 +1,32 @@
+// Number and text formatting for the console dumps (phase.c, fps.c).
+//
+// Lines are built in a buffer and printed with one hal_print(), so the
+// board and the host print them alike. Divides go through OP_DIV/OP_MOD.
+#pragma once
+#include "opcount.h"
+#include <stdint.h>
+
+// Right-aligns v in a field of w characters at s; returns the end
+static inline char *put_u32(char *s, uint32_t v, int w) {
+    char buf[10];
+    int n = 0;
+
+    do {
+        buf[n++] = (char)('0' + OP_MOD(v, 10u));
+        v = OP_DIV(v, 10u);
+    } while (v);
+    for (; w > n; --w)
+        *s++ = ' ';
+    while (n)
+        *s++ = buf[--n];
+    return s;
+}
+
+// Left-aligns str in a field of w characters at s; returns the end
+static inline char *put_str(char *s, const char *str, int w) {
+    for (; *str; --w)
+        *s++ = *str++;
+    for (; w > 0; --w)
+        *s++ = ' ';
+    return s;
+}
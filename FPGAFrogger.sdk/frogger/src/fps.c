@@ -0,0 +1,71 @@
+// Frame-pacing report, see fps.h.
+#include "fps.h"
+#include "fmt.h"
+#include "hal.h"
+#include "opcount.h"
+
+// display_480p: 800 x 525 clocks of 25.175 MHz per frame pulse; DRAW_MAX
+// and CLEAR_CLKS count the 75 MHz CPU clock
+#define FRAME_CLKS 420000u
+#define PIX_KHZ 25175u
+#define CPU_KHZ 75000u
+
+static struct hal_fb_stats base;   // counts at the start of the window
+
+void fps_reset(void) {
+    hal_fb_stats(&base);
+}
+
+// v / 100 with two decimals, right-aligned in w characters
+static char *put_fix2(char *s, uint32_t v, int w) {
+    s = put_u32(s, OP_DIV(v, 100u), w - 3);
+    *s++ = '.';
+    v = OP_MOD(v, 100u);
+    *s++ = (char)('0' + OP_DIV(v, 10u));
+    *s++ = (char)('0' + OP_MOD(v, 10u));
+    return s;
+}
+
+static void print_row(const char *name, uint32_t vsyncs, uint32_t swaps, uint32_t missed,
+                      uint32_t clear_clks) {
+    char line[80], *e = put_str(line, name, 8);
+    // swaps per second: swaps / (vsyncs * FRAME_CLKS / (PIX_KHZ * 1000)),
+    // times 100 for the two decimals
+    uint64_t fps = vsyncs ? OP_DIV((uint64_t)swaps * PIX_KHZ * 100000u,
+                                   (uint64_t)vsyncs * FRAME_CLKS) : 0;
+    // clear share: CPU clocks * 1007 / 3000 are pixel clocks
+    uint64_t clear = vsyncs ? OP_DIV((uint64_t)clear_clks * 1007u * 10000u,
+                                     (uint64_t)vsyncs * FRAME_CLKS * 3000u) : 0;
+
+    e = put_u32(e, vsyncs, 9);
+    e = put_u32(e, swaps, 9);
+    e = put_u32(e, missed, 9);
+    e = put_fix2(e, (uint32_t)fps, 9);
+    e = put_fix2(e, (uint32_t)clear, 9);
+    *e++ = '\n';
+    *e = 0;
+    hal_print(line);
+}
+
+void fps_dump(void) {
+    struct hal_fb_stats now;
+    char line[64], *e;
+
+    if (!(hal_fb_caps() & HAL_FB_STREAM))
+        return;
+    hal_fb_stats(&now);
+
+    hal_print("pacing    vsyncs    swaps   missed      fps  clear %\n");
+    print_row("window", now.vsyncs - base.vsyncs, now.swaps - base.swaps,
+              now.missed - base.missed, now.clear_clks - base.clear_clks);
+    print_row("total", now.vsyncs, now.swaps, now.missed, now.clear_clks);
+
+    // CPU clocks to microseconds
+    e = put_str(line, "longest draw ", 0);
+    e = put_u32(e, OP_DIV(now.draw_max, CPU_KHZ / 1000u), 0);
+    e = put_str(e, " us\n", 0);
+    *e = 0;
+    hal_print(line);
+
+    base = now;
+}
@@ -0,0 +1,14 @@
+// Frame rate and late frames from the frame-pacing counts of the hardware
+// (hal_fb_stats()).
+//
+// fps_dump() prints, for the time since the last dump (or fps_reset()) and
+// since the hardware was reset: frame pulses, swaps, pulses that found the
+// CPU still drawing, the frame rate shown and the share of the time spent
+// clearing, then the longest stay in S_DRAW. Without the slave it prints
+// nothing.
+#pragma once
+
+// Start the next measurement window now
+void fps_reset(void);
+
+void fps_dump(void);
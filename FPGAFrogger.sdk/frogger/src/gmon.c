@@ -0,0 +1,80 @@
+// Profiler buffers and their readout, see gmon.h.
+//
+// _program_init() runs from the crt before _profile_init() starts the
+// sample timer, so _gmonparam points at our tables by the first tick. Each
+// tick adds one to the bin of the interrupted PC, 16 bytes of code per bin
+// (BINSIZE 4 words); mcount() adds the call arcs. Neither checks bounds, so
+// the text must fit GMON_BINS bins and the game must not have more than
+// GMON_FROMS call sites and GMON_TOS arcs, or the tables overrun.
+//
+// Dump format, one record per line, numbers in hex:
+//   gmon <lowpc> <highpc> <bins> <sample Hz>
+//   h <bin> <count>                  non-empty bins only
+//   a <frompc> <selfpc> <count>
+//   end
+// Must be built without -pg: mcount() re-enables the timer on its way out.
+#include "gmon.h"
+
+#ifdef FROGGER_PROFILE
+#include "_profile_timer_hw.h"
+#include "profile.h"
+#include "xil_printf.h"
+
+#define GMON_BINS 4096     // 64 KB of text
+#define GMON_FROMS 512
+#define GMON_TOS 1024
+
+extern char __rodata_start[];   // end of .text/.init/.fini, lscript.ld
+extern u32 sample_freq_hz;
+
+static u16 kcount[GMON_BINS];
+static struct fromstruct froms[GMON_FROMS];
+static struct tostruct tos[GMON_TOS];
+static struct gmonparam param;
+
+void _program_init(void) {
+    u32 high = (u32)__rodata_start;
+
+    if (high > GMON_BINS * 16)
+        high = GMON_BINS * 16;   // the rest is not sampled
+    param.state = GMON_PROF_ON;
+    param.kcount = kcount;
+    param.kcountsize = (high + 15) / 16;
+    param.froms = froms;
+    param.fromssize = 0;
+    param.tos = &tos[GMON_TOS];   // mcount() grows it downwards
+    param.tossize = 0;
+    param.lowpc = 0;
+    param.highpc = param.kcountsize * 16;
+    param.textsize = param.highpc;
+    _gmonparam = &param;
+    n_gmon_sections = 1;
+}
+
+void gmon_dump(void) {
+    disable_timer();
+    xil_printf("gmon %x %x %x %x\r\n", param.lowpc, param.highpc, param.kcountsize,
+               sample_freq_hz);
+    for (u32 i = 0; i < param.kcountsize; ++i)
+        if (kcount[i])
+            xil_printf("h %x %x\r\n", i, kcount[i]);
+
+    // Arcs of call site f: tos entry n - 1 - link, n = tossize, following
+    // the links from froms[f].link, as mcount() does
+    const struct tostruct *t0 = param.tos;
+    for (u32 f = 0; f < param.fromssize && f < GMON_FROMS; ++f)
+        for (s32 link = froms[f].link; link != -1;) {
+            const struct tostruct *t = &t0[param.tossize - link - 1];
+            xil_printf("a %x %x %x\r\n", froms[f].frompc, t->selfpc, t->count);
+            link = t->link;
+        }
+    if (param.fromssize > GMON_FROMS || param.tossize > GMON_TOS)
+        xil_printf("overflow %x %x\r\n", param.fromssize, param.tossize);
+    xil_printf("end\r\n");
+    enable_timer();
+}
+#else
+void gmon_dump(void) {
+    // Not a -pg build
+}
+#endif
@@ -0,0 +1,11 @@
+// Readout of the standalone BSP's profiler for the -pg build
+// (../../frogger_profile).
+//
+// The profiler normally gets its buffers from XMD at download time. In a
+// build with FROGGER_PROFILE, gmon.c provides them itself and gmon_dump()
+// prints the PC histogram and the call arcs to the console for
+// frogger_host/gmonconv, which writes a gmon.out for mb-gprof. In every
+// other build gmon_dump() does nothing.
+#pragma once
+
+void gmon_dump(void);
@@ -0,0 +1,184 @@
+// Hardware abstraction layer for the framebuffer handshake and keypad.
+//
+// main.c only talks to the hardware through these calls. hal_board.c is the
+// MicroBlaze backend (AXI GPIOs wired to vga_framebuffer_top, PmodKYPD); the
+// headless Linux backend lives in ../../frogger_host.
+#pragma once
+#include <stdint.h>
+
+// Same key layout the PmodKYPD driver is loaded with
+#define HAL_KEYTABLE "0FED789C456B123A"
+
+// Return values of hal_key_pressed() (match KYPD_NO_KEY/SINGLE_KEY/MULTI_KEY)
+#define HAL_KEY_NONE 0
+#define HAL_KEY_SINGLE 1
+#define HAL_KEY_MULTI 2
+
+// hal_fb_caps() bits
+#define HAL_FB_KEEP_BACK (1u << 0)   // back buffer is not cleared at the swap
+#define HAL_FB_WIDE (1u << 1)        // packed 8-pixel write port, hal_fb_write8()
+#define HAL_FB_STREAM (1u << 2)      // memory-mapped slave, one store per pixel
+#define HAL_FB_BLIT (1u << 3)        // sprite blitter, hal_fb_blit()
+#define HAL_FB_OAM (1u << 4)         // object layer, hal_oam_write()
+#define HAL_FB_TILES (1u << 5)       // tile layer, hal_tile_write()
+#define HAL_FB_FILL (1u << 6)        // rectangle fill engine, hal_fb_fill()
+#define HAL_FB_LANES (1u << 7)       // scrolling lanes, hal_lane_write8()
+#define HAL_FB_SPAN (1u << 8)        // span writes of the fill engine, hal_fb_span()
+#define HAL_FB_TRIPLE (1u << 9)      // three buffers: a finished frame waits for the
+                                     // swap without the CPU, see finish_frame()
+#define HAL_FB_IRQ (1u << 10)        // frame interrupts of the slave, hal_irq_count()
+#define HAL_FB_PALETTE (1u << 11)    // CPU-written palette, hal_palette_write()
+
+// hal_fb_blit() command word (sprite_blitter.v): sprite id, signed position,
+// transform and the colour left transparent
+#define HAL_BLIT_ID(n) ((uint32_t)(n) & 0x3F)
+#define HAL_BLIT_X(x) (((uint32_t)(x) & 0x1FF) << 6)
+#define HAL_BLIT_Y(y) (((uint32_t)(y) & 0x1FF) << 15)
+#define HAL_BLIT_FLIP_H (1u << 24)
+#define HAL_BLIT_FLIP_V (1u << 25)
+#define HAL_BLIT_ROT (1u << 26)      // 90 degrees counterclockwise, after the flips
+#define HAL_BLIT_KEY(c) (((uint32_t)(c) & 0xF) << 27)
+#define HAL_BLIT_OPAQUE (1u << 31)   // no transparent colour
+
+// Object layer entry (oam_layer.v): id, position and transform as in a blit
+// command, colour 0 transparent, higher entries on top
+#define HAL_OAM_ENTRIES 64
+#define HAL_OAM_BEHIND (1u << 27)    // only shown where the frame buffer is 0
+#define HAL_OAM_ENABLE (1u << 31)
+
+// Tile layer (tile_layer.v): 14x16 tilemap of background[] tiles shown where
+// the frame buffer pixel is 0; tile 0 is empty
+#define HAL_TILES_X 14
+#define HAL_TILES_Y 16
+
+// Lane layer (lane_layer.v): 16-pixel band b of the frame buffer can show a
+// 16 x 512 lane buffer, column x from column (x + scroll) mod width; shown
+// where the frame buffer pixel is 0, over the tile layer
+#define HAL_LANE_FIRST 3     // bands with a lane buffer
+#define HAL_LANE_LAST 13
+#define HAL_LANE_W 512
+
+// Palette (palette_regs.v): 16 RGB444 entries and HAL_PAL_CYCLES slots that
+// rotate entries first..last by one every `frames` frame pulses; down moves
+// the colours to the next lower entry
+#define HAL_PAL_CYCLES 4
+#define HAL_PAL_RGB(r, g, b) ((uint16_t)(((r) & 0xF) << 8 | ((g) & 0xF) << 4 | ((b) & 0xF)))
+#define HAL_PAL_CYCLE(first, last, frames) \
+    (((uint32_t)(first) & 0xF) | ((uint32_t)(last) & 0xF) << 4 | ((uint32_t)(frames) & 0xFF) << 8)
+#define HAL_PAL_DOWN (1u << 16)
+
+void hal_init(void);
+
+// Framebuffer features of the attached hardware
+uint32_t hal_fb_caps(void);
+
+// Write one 4-bit pixel at linear address idx (y * FB_W + x) of the back buffer
+void hal_fb_write(uint16_t idx, uint8_t c);
+
+// Write n pixels px[0..n-1] to idx, idx + 1, ... With the memory-mapped
+// slave these stream through the auto-incrementing address register: one
+// store per pixel and no address write when idx continues the last stream
+void hal_fb_stream(uint16_t idx, const uint8_t *px, int n);
+
+// Write the pixels of group idx / 8 selected by mask; pixel k (x = 8 * group
+// + k) comes from bits 4k..4k+3 of pix and is written if bit k of mask is set
+void hal_fb_write8(uint16_t group, uint32_t pix, uint8_t mask);
+
+// Queue a sprite for the blitter (HAL_FB_BLIT). It is drawn in order with
+// the pixel writes around it; waits while the command FIFO is full
+void hal_fb_blit(uint32_t cmd);
+
+// Queue a fill of the w x h rectangle at (x, y) with colour c (HAL_FB_FILL).
+// The rectangle must lie inside the buffer; it is drawn in order with the
+// pixel writes and blits around it
+void hal_fb_fill(int x, int y, int w, int h, uint8_t c);
+
+// Queue a write of colour c to the n (1..256) pixels idx, idx + 1, ...
+// (HAL_FB_SPAN), in order like hal_fb_fill()
+void hal_fb_span(uint16_t idx, int n, uint8_t c);
+
+// Write entry i of the OAM bank that is shown with the back buffer
+// (HAL_FB_OAM); both swap together
+void hal_oam_write(int i, uint32_t entry);
+
+// Object-layer entries dropped by the per-line limit in the last frame shown
+uint32_t hal_oam_dropped(void);
+
+// Write the pixels of 8-pixel group `group` (columns 8 * group ..) of row
+// `row` of the lane buffer of band b selected by mask, pixel k in bits
+// 4k..4k+3 of pix. Goes to the bank shown with the back buffer
+void hal_lane_write8(int b, int row, int group, uint32_t pix, uint8_t mask);
+
+// Scroll register of band b in the back bank: width 224..511 (0 = the band
+// shows no lane) and scroll 0..width - 1. Both banks swap with the buffers,
+// so it is written every frame
+void hal_lane_scroll(int b, int scroll, int width);
+
+// Set tilemap entry i (ty * HAL_TILES_X + tx) of the bank shown with the back
+// buffer (HAL_FB_TILES), swapped like the OAM
+void hal_tile_write(int i, uint8_t tile);
+
+// Set palette entry i (0..15) to RGB444 rgb (HAL_FB_PALETTE). The entries
+// written so far are shown from the next frame pulse on, whether or not a
+// frame is swapped in there, so they are not banked like the layers
+void hal_palette_write(int i, uint16_t rgb);
+
+// Set palette-cycle slot k (HAL_PAL_CYCLE() | HAL_PAL_DOWN, 0 = off); it
+// restarts the slot's count, and entries written later rotate along
+void hal_palette_cycle(int k, uint32_t cfg);
+
+// cpu_done input of vga_framebuffer_top
+void hal_set_cpu_done(int done);
+
+// frame_ready / VGA_Vsync levels as seen by the CPU
+int hal_frame_ready(void);
+int hal_vsync(void);
+
+uint16_t hal_key_states(void);
+uint32_t hal_key_pressed(uint16_t ks, uint8_t *key);
+
+void hal_sleep(unsigned int seconds);
+
+// Frame-pacing counts of vga_framebuffer_top since reset, as of the last
+// frame pulse (VSYNCS..CLEAR_CLKS of the slave); all 0 without the slave.
+// Each count wraps at 2^32
+struct hal_fb_stats {
+    uint32_t vsyncs;      // frame pulses
+    uint32_t swaps;       // buffer swaps, i.e. new frames shown
+    uint32_t missed;      // frame pulses that found the CPU still drawing
+    uint32_t draw_max;    // longest stay in S_DRAW, CPU clock cycles
+    uint32_t clear_clks;  // CPU clock cycles spent clearing the back buffer
+};
+void hal_fb_stats(struct hal_fb_stats *st);
+
+// Free-running count of CPU clock cycles (CYCLES register of the slave),
+// wraps every 2^32 so only differences mean anything; 0 without the slave
+uint32_t hal_cycles(void);
+
+// Interrupts of the slave (HAL_FB_IRQ), IRQ_STATUS bits 0..2
+enum {
+    HAL_IRQ_READY_RISE,   // frame_ready rose: a back buffer to draw into
+    HAL_IRQ_READY_FALL,   // frame_ready fell: the frame handed over was taken
+    HAL_IRQ_VSYNC,        // frame pulse at the start of the vertical blank,
+                          // where the buffers swap
+    HAL_NUM_IRQS
+};
+
+// Interrupts of kind irq taken since hal_init(), and hal_cycles() in the
+// handler of the last one; both wrap at 2^32. Memory reads, no bus
+// transaction
+uint32_t hal_irq_count(int irq);
+uint32_t hal_irq_cycles(int irq);
+
+// Wait for an interrupt. Returns at once if one was taken since the last
+// hal_idle() returned, so a count checked before the call cannot miss one
+void hal_idle(void);
+
+// Write a string to the console: the UART on the board, stdout on the host.
+// The board queues it and sends it from hal_flush(), or waits for the UART
+// while the queue is full
+void hal_print(const char *s);
+
+// Send queued console output as far as the UART takes it without waiting;
+// returns nonzero while some is left. Nothing is queued on the host
+int hal_flush(void);
@@ -0,0 +1,462 @@
+// MicroBlaze backend of hal.h: framebuffer over the axi_fb_slave peripheral
+// or the AXI GPIO write port, PmodKYPD keypad, the slave's frame interrupts
+// through axi_intc_0 and a queued console on the UART.
+#include "hal.h"
+#include "PmodKYPD.h"
+#include "sleep.h"
+#include "xgpio.h"
+#include "xil_io.h"
+#include "xil_printf.h"
+#include "xil_types.h"
+#include "xparameters.h"
+#include "xuartlite_l.h"
+
+// axi_fb_slave registers; replaces the WE/ADDR/DAT GPIOs when present
+#ifdef XPAR_AXI_FB_SLAVE_0_BASEADDR
+#define FB_BASE XPAR_AXI_FB_SLAVE_0_BASEADDR
+#define FB_ADDR (FB_BASE + 0x0)
+#define FB_DATA (FB_BASE + 0x4)
+#define FB_DATA8 (FB_BASE + 0x8)
+#define FB_MASK (FB_BASE + 0xC)
+#define FB_BLIT (FB_BASE + 0x10)
+#define FB_OAM_DROP (FB_BASE + 0x14)
+#define FB_FILL (FB_BASE + 0x18)
+#define FB_FILL_COL (FB_BASE + 0x1C)
+#define FB_LANE_ADDR (FB_BASE + 0x24)
+#define FB_LANE_DATA8 (FB_BASE + 0x28)
+#define FB_SPAN (FB_BASE + 0x2C)
+#define FB_CYCLES (FB_BASE + 0x30)
+#define FB_VSYNCS (FB_BASE + 0x34)
+#define FB_SWAPS (FB_BASE + 0x38)
+#define FB_MISSED (FB_BASE + 0x3C)
+#define FB_DRAW_MAX (FB_BASE + 0x40)
+#define FB_CLEAR_CLKS (FB_BASE + 0x44)
+#define FB_IRQ_STATUS (FB_BASE + 0x48)
+#define FB_IRQ_ENABLE (FB_BASE + 0x4C)
+#define FB_SCROLL (FB_BASE + 0x800)
+#define FB_OAM (FB_BASE + 0x100)
+#define FB_TILES (FB_BASE + 0x400)
+#define FB_PALETTE (FB_BASE + 0x200)
+#define FB_PAL_CYCLE (FB_BASE + 0x240)
+#define FB_WINDOW (FB_BASE + 0x40000)
+#define FB_STREAM \
+    (HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT | HAL_FB_OAM | HAL_FB_TILES | HAL_FB_FILL | \
+     HAL_FB_LANES | HAL_FB_SPAN | HAL_FB_PALETTE)
+#else
+#define WE_DEVICE_ID XPAR_AXI_GPIO_WE_DEVICE_ID
+#define ADDR_DEVICE_ID XPAR_AXI_GPIO_ADDR_DEVICE_ID
+#define DAT_DEVICE_ID XPAR_AXI_GPIO_DAT_DEVICE_ID
+#define FB_STREAM 0
+#endif
+#define VSYNC_DEVICE_ID XPAR_AXI_GPIO_VSYNC_DEVICE_ID
+#define FRAME_RDY_DEVICE_ID XPAR_AXI_GPIO_FRAME_RDY_DEVICE_ID
+#define CPU_DONE_DEVICE_ID XPAR_AXI_GPIO_CPU_DONE_DEVICE_ID
+#define GPIO_CH 1
+
+// Packed write port: dual-channel GPIO with the 32-bit pixel word on channel 1
+// and the 8-bit mask on channel 2; the strobe is bit 1 of the WE GPIO
+#if defined(XPAR_AXI_GPIO_WDAT_DEVICE_ID) && !defined(FB_BASE)
+#define WDAT_DEVICE_ID XPAR_AXI_GPIO_WDAT_DEVICE_ID
+#define WMASK_CH 2
+#define WE8 2
+#define FB_WIDE HAL_FB_WIDE
+#else
+#define FB_WIDE 0
+#endif
+
+// Frame interrupts: the slave's irq on axi_intc_0
+// (FPGAFrogger.srcs/irq/design_1_irq.tcl)
+#if defined(FB_BASE) && defined(XPAR_AXI_INTC_0_AXI_FB_SLAVE_0_IRQ_INTR)
+#include "mb_interface.h"
+#include "xintc_l.h"
+#define INTC_BASE XPAR_AXI_INTC_0_BASEADDR
+#define INTC_DEVICE_ID XPAR_AXI_INTC_0_DEVICE_ID
+#define FB_IRQ_INTR XPAR_AXI_INTC_0_AXI_FB_SLAVE_0_IRQ_INTR
+#define FB_IRQ HAL_FB_IRQ
+#else
+#define FB_IRQ 0
+#endif
+
+#define KYPD_GPIO_ID XPAR_PMODKYPD_0_AXI_LITE_GPIO_BASEADDR
+
+// Console queue of hal_print(); a power of two
+#define CON_SIZE 1024
+
+// Build with -DFB_CAPS=HAL_FB_KEEP_BACK when vga_framebuffer_top has
+// CLEAR_BACK = 0, and with HAL_FB_TRIPLE added when it has NUM_BUFFERS = 3
+// (hal_fb_caps() then drops HAL_FB_OAM, HAL_FB_TILES and HAL_FB_LANES).
+// Build with -DFB_NO_LANES when it has LANES = 0, as in the profiling design
+#ifndef FB_CAPS
+#define FB_CAPS 0
+#endif
+
+static XGpio gpio_vsync, gpio_frame_rdy, gpio_done;
+#ifdef FB_BASE
+static uint16_t fb_cursor;      // shadow of FB_ADDR
+static uint8_t fb_mask = 0xFF;  // shadow of FB_MASK
+static uint8_t fb_fill_col;     // shadow of FILL_COL
+static uint16_t lane_cursor;    // shadow of LANE_ADDR
+#else
+static XGpio gpio_we, gpio_addr, gpio_dat;
+#endif
+#ifdef WDAT_DEVICE_ID
+static XGpio gpio_wdat;
+#endif
+static PmodKYPD keypad;
+static char con_buf[CON_SIZE];
+static uint32_t con_head, con_tail;   // free-running, head - tail chars queued
+
+#ifdef INTC_BASE
+static volatile uint32_t irq_counts[HAL_NUM_IRQS], irq_stamps[HAL_NUM_IRQS];
+static volatile int irq_taken;
+
+// IRQ_STATUS keeps each event until it is cleared, so one call sees all
+// that came since the last
+static void fb_irq_handler(void *ref) {
+    uint32_t st = Xil_In32(FB_IRQ_STATUS);
+    uint32_t now = Xil_In32(FB_CYCLES);
+
+    (void)ref;
+    Xil_Out32(FB_IRQ_STATUS, st);
+    for (int i = 0; i < HAL_NUM_IRQS; ++i, st >>= 1)
+        if (st & 1) {
+            irq_counts[i]++;
+            irq_stamps[i] = now;
+        }
+    irq_taken = 1;
+}
+#endif
+
+void hal_init(void) {
+#ifdef FB_BASE
+    Xil_Out32(FB_ADDR, 0);
+    Xil_Out32(FB_MASK, 0xFF);
+    Xil_Out32(FB_FILL_COL, 0);
+    fb_cursor = 0;
+    fb_mask = 0xFF;
+    fb_fill_col = 0;
+    lane_cursor = 0xFFFF;
+#else
+    XGpio_Initialize(&gpio_we, WE_DEVICE_ID);
+    XGpio_Initialize(&gpio_addr, ADDR_DEVICE_ID);
+    XGpio_Initialize(&gpio_dat, DAT_DEVICE_ID);
+    XGpio_SetDataDirection(&gpio_we, GPIO_CH, 0);
+    XGpio_SetDataDirection(&gpio_addr, GPIO_CH, 0);
+    XGpio_SetDataDirection(&gpio_dat, GPIO_CH, 0);
+#endif
+    XGpio_Initialize(&gpio_vsync, VSYNC_DEVICE_ID);
+    XGpio_Initialize(&gpio_frame_rdy, FRAME_RDY_DEVICE_ID);
+    XGpio_Initialize(&gpio_done, CPU_DONE_DEVICE_ID);
+
+    XGpio_SetDataDirection(&gpio_done, GPIO_CH, 0);
+    XGpio_SetDataDirection(&gpio_vsync, GPIO_CH, 0xFFFFFFFF);
+    XGpio_SetDataDirection(&gpio_frame_rdy, GPIO_CH, 0xFFFFFFFF);
+
+    XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 0);
+
+#ifdef WDAT_DEVICE_ID
+    XGpio_Initialize(&gpio_wdat, WDAT_DEVICE_ID);
+    XGpio_SetDataDirection(&gpio_wdat, GPIO_CH, 0);
+    XGpio_SetDataDirection(&gpio_wdat, WMASK_CH, 0);
+#endif
+
+    KYPD_begin(&keypad, KYPD_GPIO_ID);
+    KYPD_loadKeyTable(&keypad, (u8 *)HAL_KEYTABLE);
+
+#ifdef INTC_BASE
+    // Through the controller's handler table; in the profiling build the
+    // profiler's timer is already enabled on it, so only our bit is added
+    XIntc_RegisterHandler(INTC_BASE, FB_IRQ_INTR, fb_irq_handler, NULL);
+    XIntc_EnableIntr(INTC_BASE, XIntc_In32(INTC_BASE + XIN_IER_OFFSET) | 1u << FB_IRQ_INTR);
+    XIntc_MasterEnable(INTC_BASE);
+    microblaze_register_handler((XInterruptHandler)XIntc_DeviceInterruptHandler,
+                                (void *)INTC_DEVICE_ID);
+    Xil_Out32(FB_IRQ_STATUS, (1u << HAL_NUM_IRQS) - 1);
+    Xil_Out32(FB_IRQ_ENABLE, (1u << HAL_NUM_IRQS) - 1);
+    microblaze_enable_interrupts();
+#endif
+}
+
+uint32_t hal_fb_caps(void) {
+    uint32_t caps = FB_CAPS | FB_WIDE | FB_STREAM | FB_IRQ;
+
+    // NUM_BUFFERS = 3 is built without the lane layer, and the object and
+    // tile banks would go with the wrong frame while one waits for its swap
+    if (caps & HAL_FB_TRIPLE)
+        caps &= ~(HAL_FB_OAM | HAL_FB_TILES | HAL_FB_LANES);
+#ifdef FB_NO_LANES
+    caps &= ~HAL_FB_LANES;
+#endif
+    return caps;
+}
+
+#ifdef FB_BASE
+void hal_fb_write(uint16_t idx, uint8_t c) {
+    if (idx == fb_cursor) {
+        Xil_Out32(FB_DATA, c);
+        fb_cursor++;
+    } else {
+        Xil_Out32(FB_WINDOW + idx * 4, c);
+    }
+}
+
+void hal_fb_stream(uint16_t idx, const uint8_t *px, int n) {
+    if (idx != fb_cursor)
+        Xil_Out32(FB_ADDR, idx);
+    for (int i = 0; i < n; ++i)
+        Xil_Out32(FB_DATA, px[i]);
+    fb_cursor = idx + n;
+}
+
+void hal_fb_write8(uint16_t group, uint32_t pix, uint8_t mask) {
+    uint16_t idx = group * 8;
+
+    if (mask != fb_mask) {
+        Xil_Out32(FB_MASK, mask);
+        fb_mask = mask;
+    }
+    if (idx != fb_cursor)
+        Xil_Out32(FB_ADDR, idx);
+    Xil_Out32(FB_DATA8, pix);
+    fb_cursor = idx + 8;
+}
+
+void hal_fb_blit(uint32_t cmd) {
+    Xil_Out32(FB_BLIT, cmd);
+}
+
+void hal_fb_fill(int x, int y, int w, int h, uint8_t c) {
+    if (c != fb_fill_col) {
+        Xil_Out32(FB_FILL_COL, c);
+        fb_fill_col = c;
+    }
+    Xil_Out32(FB_FILL, x | y << 8 | (w - 1) << 16 | (uint32_t)(h - 1) << 24);
+}
+
+void hal_fb_span(uint16_t idx, int n, uint8_t c) {
+    Xil_Out32(FB_SPAN, idx | (n - 1) << 16 | (uint32_t)c << 24);
+}
+
+void hal_oam_write(int i, uint32_t entry) {
+    Xil_Out32(FB_OAM + i * 4, entry);
+}
+
+void hal_lane_write8(int b, int row, int group, uint32_t pix, uint8_t mask) {
+    uint16_t addr = b << 10 | row << 6 | group;
+
+    if (mask != fb_mask) {
+        Xil_Out32(FB_MASK, mask);
+        fb_mask = mask;
+    }
+    if (addr != lane_cursor)
+        Xil_Out32(FB_LANE_ADDR, addr);
+    Xil_Out32(FB_LANE_DATA8, pix);
+    lane_cursor = addr + 1;
+}
+
+void hal_lane_scroll(int b, int scroll, int width) {
+    Xil_Out32(FB_SCROLL + b * 4, scroll | width << 9);
+}
+
+uint32_t hal_oam_dropped(void) {
+    return Xil_In32(FB_OAM_DROP);
+}
+
+void hal_tile_write(int i, uint8_t tile) {
+    Xil_Out32(FB_TILES + i * 4, tile);
+}
+
+void hal_palette_write(int i, uint16_t rgb) {
+    Xil_Out32(FB_PALETTE + i * 4, rgb);
+}
+
+void hal_palette_cycle(int k, uint32_t cfg) {
+    Xil_Out32(FB_PAL_CYCLE + k * 4, cfg);
+}
+
+uint32_t hal_cycles(void) {
+    return Xil_In32(FB_CYCLES);
+}
+
+void hal_fb_stats(struct hal_fb_stats *st) {
+    // Updated together once a frame, so a read near a frame pulse may mix
+    // two frames
+    st->vsyncs = Xil_In32(FB_VSYNCS);
+    st->swaps = Xil_In32(FB_SWAPS);
+    st->missed = Xil_In32(FB_MISSED);
+    st->draw_max = Xil_In32(FB_DRAW_MAX);
+    st->clear_clks = Xil_In32(FB_CLEAR_CLKS);
+}
+#else
+void hal_fb_write(uint16_t idx, uint8_t c) {
+    XGpio_DiscreteWrite(&gpio_addr, GPIO_CH, idx);
+    XGpio_DiscreteWrite(&gpio_dat, GPIO_CH, c & 0xF);
+    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, 1);
+    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, 0);
+}
+
+void hal_fb_stream(uint16_t idx, const uint8_t *px, int n) {
+    for (int i = 0; i < n; ++i)
+        hal_fb_write(idx + i, px[i]);
+}
+
+void hal_fb_write8(uint16_t group, uint32_t pix, uint8_t mask) {
+#ifdef WDAT_DEVICE_ID
+    XGpio_DiscreteWrite(&gpio_addr, GPIO_CH, group);
+    XGpio_DiscreteWrite(&gpio_wdat, GPIO_CH, pix);
+    XGpio_DiscreteWrite(&gpio_wdat, WMASK_CH, mask);
+    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, WE8);
+    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, 0);
+#else
+    // No packed port: fall back to single-pixel writes
+    uint16_t idx = group * 8;
+    for (int k = 0; k < 8; ++k, pix >>= 4, mask >>= 1)
+        if (mask & 1)
+            hal_fb_write(idx + k, pix & 0xF);
+#endif
+}
+
+void hal_fb_blit(uint32_t cmd) {
+    // No blitter without the slave; HAL_FB_BLIT is not reported
+    (void)cmd;
+}
+
+void hal_fb_fill(int x, int y, int w, int h, uint8_t c) {
+    // Nor a fill engine
+    (void)x;
+    (void)y;
+    (void)w;
+    (void)h;
+    (void)c;
+}
+
+void hal_fb_span(uint16_t idx, int n, uint8_t c) {
+    // Nor its spans
+    (void)idx;
+    (void)n;
+    (void)c;
+}
+
+void hal_oam_write(int i, uint32_t entry) {
+    // Likewise no object layer
+    (void)i;
+    (void)entry;
+}
+
+void hal_lane_write8(int b, int row, int group, uint32_t pix, uint8_t mask) {
+    // Nor a lane layer
+    (void)b;
+    (void)row;
+    (void)group;
+    (void)pix;
+    (void)mask;
+}
+
+void hal_lane_scroll(int b, int scroll, int width) {
+    (void)b;
+    (void)scroll;
+    (void)width;
+}
+
+uint32_t hal_oam_dropped(void) {
+    return 0;
+}
+
+void hal_tile_write(int i, uint8_t tile) {
+    // Nor a tile layer
+    (void)i;
+    (void)tile;
+}
+
+void hal_palette_write(int i, uint16_t rgb) {
+    // The palette stays palette.mem
+    (void)i;
+    (void)rgb;
+}
+
+void hal_palette_cycle(int k, uint32_t cfg) {
+    (void)k;
+    (void)cfg;
+}
+
+uint32_t hal_cycles(void) {
+    // Nor a cycle counter
+    return 0;
+}
+
+void hal_fb_stats(struct hal_fb_stats *st) {
+    // Nor the frame-pacing counts
+    st->vsyncs = st->swaps = st->missed = st->draw_max = st->clear_clks = 0;
+}
+#endif
+
+void hal_set_cpu_done(int done) {
+    XGpio_DiscreteWrite(&gpio_done, GPIO_CH, done);
+}
+
+int hal_frame_ready(void) {
+    return XGpio_DiscreteRead(&gpio_frame_rdy, GPIO_CH) & 1;
+}
+
+int hal_vsync(void) {
+    return XGpio_DiscreteRead(&gpio_vsync, GPIO_CH) & 1;
+}
+
+uint16_t hal_key_states(void) {
+    return KYPD_getKeyStates(&keypad);
+}
+
+uint32_t hal_key_pressed(uint16_t ks, uint8_t *key) {
+    return KYPD_getKeyPressed(&keypad, ks, key);
+}
+
+void hal_sleep(unsigned int seconds) {
+    sleep(seconds);
+}
+
+#ifdef INTC_BASE
+uint32_t hal_irq_count(int irq) {
+    return irq_counts[irq];
+}
+
+uint32_t hal_irq_cycles(int irq) {
+    return irq_stamps[irq];
+}
+
+void hal_idle(void) {
+    // Spins on local memory, off the bus. MicroBlaze's sleep would not be
+    // woken by an interrupt taken between the caller's check and the sleep
+    while (!irq_taken)
+        ;
+    irq_taken = 0;
+}
+#else
+uint32_t hal_irq_count(int irq) {
+    // No frame interrupts; HAL_FB_IRQ is not reported
+    (void)irq;
+    return 0;
+}
+
+uint32_t hal_irq_cycles(int irq) {
+    (void)irq;
+    return 0;
+}
+
+void hal_idle(void) {
+}
+#endif
+
+void hal_print(const char *s) {
+    for (; *s; ++s) {
+        while (con_head - con_tail == CON_SIZE)
+            hal_flush();
+        con_buf[con_head++ & (CON_SIZE - 1)] = *s;
+    }
+}
+
+int hal_flush(void) {
+    while (con_tail != con_head && !XUartLite_IsTransmitFull(STDOUT_BASEADDRESS))
+        XUartLite_WriteReg(STDOUT_BASEADDRESS, XUL_TX_FIFO_OFFSET,
+                           con_buf[con_tail++ & (CON_SIZE - 1)]);
+    return con_tail != con_head;
+}
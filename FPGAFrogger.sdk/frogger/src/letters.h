@@ -1,4 +1,4 @@
-// Auto-generated 8x8 letter sprites A-Z for text display
+// Auto-generated by frogger_host/assetgen from letters.png, do not edit.
 #pragma once
 #include <stdint.h>
 
@@ -268,4 +268,4 @@ static const uint8_t letters[NUM_LETTERS][LETTER_W * LETTER_H] = {
     0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE
   }
-};
\ No newline at end of file
+};
@@ -1,31 +1,15 @@
-#include "PmodKYPD.h"
-#include "background.h"
-#include "letters.h"
-#include "numbers.h"
-#include "sleep.h"
-#include "sprites.h"
-#include "xgpio.h"
-#include "xil_types.h"
-#include "xparameters.h"
+#include "fps.h"
+#include "gmon.h"
+#include "hal.h"
+#include "phase.h"
+#include "render.h"
+#include "slack.h"
 #include <stdint.h>
 #include <stdlib.h>
  
-#define FB_W 224
-#define FB_H 256
 #define TILE_W 16
 #define TILE_H 16
  
-#define WE_DEVICE_ID XPAR_AXI_GPIO_WE_DEVICE_ID
-#define ADDR_DEVICE_ID XPAR_AXI_GPIO_ADDR_DEVICE_ID
-#define DAT_DEVICE_ID XPAR_AXI_GPIO_DAT_DEVICE_ID
-#define VSYNC_DEVICE_ID XPAR_AXI_GPIO_VSYNC_DEVICE_ID
-#define FRAME_RDY_DEVICE_ID XPAR_AXI_GPIO_FRAME_RDY_DEVICE_ID
-#define CPU_DONE_DEVICE_ID XPAR_AXI_GPIO_CPU_DONE_DEVICE_ID
-#define GPIO_CH 1
- 
-#define KYPD_GPIO_ID XPAR_PMODKYPD_0_AXI_LITE_GPIO_BASEADDR
-#define KEYTABLE "0FED789C456B123A"
- 
 #define BAR_W 118
 #define BAR_H 8
 #define BAR_Y0 (FB_H - BAR_H)
@@ -43,6 +27,14 @@
 #define SPR_HEART 31
 #define SPR_DEAD 15
  
+// Palette entries rewritten by the palette effects (HAL_FB_PALETTE)
+#define PAL_WATER 1       // the river, and nothing else
+#define PAL_FROG 4        // yellow of the frogs and SPR_DEAD
+#define PAL_TEXT 14       // the glyphs, left alone by the fade
+#define PAL_FLASH 0xF00   // red the dead frog flashes to
+#define SHIMMER_FRAMES 12
+#define FADE_STEPS 8
+ 
 #define LOGS_ROW0 3
 #define LOGS_ROW1 2
 #define LOGS_ROW2 3
@@ -54,6 +46,15 @@
 #define TURTLES_ROW0 (CLUSTERS_ROW0 * TPC_ROW0)
 #define TURTLES_ROW1 (CLUSTERS_ROW1 * TPC_ROW1)
  
+// Lane periods: how far move_lanes() puts an object that leaves the screen
+// back on the other side (x + dx past the limit, in the phase the lane's
+// objects move in)
+#define PERIOD_LOGS(len, dx) (FB_W + TILE_W + (dx) + (len) * TILE_W)
+#define PERIOD_TURTLES (FB_W + TILE_W + 2 * TILE_W + 2)
+#define PERIOD_CARS_L (FB_W + TILE_W + 2 * TILE_W + 1)   // y = 208, 176
+#define PERIOD_CARS_R (FB_W + TILE_W + 2 + TILE_W)       // y = 192, 160
+#define PERIOD_CARS_144 (FB_W + TILE_W + 3 * TILE_W + 1)
+ 
 #define DIVE_STAGES 20
 #define SURFACE_TIME 10
  
@@ -63,15 +64,11 @@
 #define DIR_LEFT 3
  
 #define ANIM_FRAMES 3
-#define ANIM_SPEED 1
  
 struct Obj {
     int x, y, px, py, idx, dx;
 };
  
-static XGpio gpio_we, gpio_addr, gpio_dat, gpio_vsync, gpio_frame_rdy, gpio_done;
-static PmodKYPD keypad;
- 
 static struct Obj car0, car1, frog;
 static struct Obj cars_208[3]; // 3 cars moving left on y=208 (sprite 3)
 static struct Obj cars_192[3]; // 3 cars moving right on y=192 (sprite 4)
@@ -98,72 +95,22 @@ static int captured_frog_timer = 0;
 static int turtle_anim_timer = 0;
 static int turtle_anim_frame = 0;
 static int frog_highest_y; // Track highest y position reached (lowest y value)
- 
-static inline void draw_pixel_fast(int x, int y, uint8_t c) {
-    uint16_t idx = y * FB_W + x;
-    XGpio_DiscreteWrite(&gpio_addr, GPIO_CH, idx);
-    XGpio_DiscreteWrite(&gpio_dat, GPIO_CH, c & 0xF);
-    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, 1);
-    XGpio_DiscreteWrite(&gpio_we, GPIO_CH, 0);
-}
- 
-static inline void draw_pixel(int x, int y, uint8_t c) {
-    if ((unsigned)x < FB_W && (unsigned)y < FB_H)
-        draw_pixel_fast(x, y, c);
-}
- 
-static void draw_sprite_flipped(int sprite_idx, int sx, int sy, int flip_h, int flip_v) {
-    if (sx < -TILE_W || sx >= FB_W || sy < -TILE_H || sy >= FB_H)
-        return;
- 
-    const uint8_t *spr = sprites[sprite_idx];
-    for (int dy = 0; dy < 16; ++dy) {
-        int y = sy + dy;
-        if ((unsigned)y >= FB_H)
-            continue;
- 
-        for (int dx = 0; dx < 16; ++dx) {
-            int src_x = flip_h ? (15 - dx) : dx;
-            int src_y = flip_v ? (15 - dy) : dy;
- 
-            uint8_t c = spr[src_y * 16 + src_x];
-            if (c) {
-                int x = sx + dx;
-                if ((unsigned)x < FB_W)
-                    draw_pixel_fast(x, y, c);
-            }
-        }
-    }
-}
+static int pal_fx;         // HAL_FB_PALETTE: water shimmer, death flash, fade
+static int shimmer_timer, shimmer_step, fade_level;
  
 static void draw_sprite_fast(int n, int sx, int sy) {
-    draw_sprite_flipped(n, sx, sy, 0, 0);
+    render_sprite(n, sx, sy, XF_NONE);
 }
  
-static void draw_sprite_8x8(const uint8_t *sprite_data, int sx, int sy) {
-    if (sx < -8 || sx >= FB_W || sy < -8 || sy >= FB_H)
-        return;
- 
-    for (int dy = 0; dy < 8; ++dy) {
-        int y = sy + dy;
-        if ((unsigned)y >= FB_H)
-            continue;
- 
-        for (int dx = 0; dx < 8; ++dx) {
-            uint8_t c = sprite_data[dy * 8 + dx];
-            if (c) {
-                int x = sx + dx;
-                if ((unsigned)x < FB_W)
-                    draw_pixel_fast(x, y, c);
-            }
-        }
-    }
+// Sprite of the current render_lane()
+static void draw_lane_fast(int n, int sx) {
+    render_lane_sprite(n, sx, XF_NONE);
 }
  
 static void draw_number(int number, int x, int y) {
     // Handle negative numbers or zero
     if (number <= 0) {
-        draw_sprite_8x8(numbers[0], x, y);
+        render_glyph(GLYPH_DIGIT, x, y);
         return;
     }
  
@@ -172,20 +119,27 @@ static void draw_number(int number, int x, int y) {
         number = 999999;
     }
  
-    // Count digits to position correctly
-    int temp = number;
+    // Digits by subtracting powers of ten, the core has no divider; leading
+    // zeros are dropped
+    static const int pow10[6] = {100000, 10000, 1000, 100, 10, 1};
+    uint8_t digits[6];
     int digit_count = 0;
-    while (temp > 0) {
-        temp /= 10;
-        digit_count++;
+    for (int i = 0; i < 6; ++i) {
+        int digit = 0;
+        while (number >= pow10[i]) {
+            number -= pow10[i];
+            digit++;
+        }
+        if (digit || digit_count)
+            digits[digit_count++] = digit;
     }
  
     // Draw digits from right to left
-    int current_x = x + (digit_count - 1) * 8;
-    while (number > 0) {
-        int digit = number % 10;
-        draw_sprite_8x8(numbers[digit], current_x, y);
-        number /= 10;
+    int current_x = x;
+    for (int i = 1; i < digit_count; ++i)
+        current_x += 8;
+    for (int i = digit_count - 1; i >= 0; --i) {
+        render_glyph(GLYPH_DIGIT + digits[i], current_x, y);
         current_x -= 8;
     }
 }
@@ -193,9 +147,9 @@ static void draw_number(int number, int x, int y) {
 // Draw a single letter (A-Z)
 static void draw_letter(char letter, int x, int y) {
     if (letter >= 'A' && letter <= 'Z') {
-        draw_sprite_8x8(letters[letter - 'A'], x, y);
+        render_glyph(letter - 'A', x, y);
     } else if (letter >= 'a' && letter <= 'z') {
-        draw_sprite_8x8(letters[letter - 'a'], x, y);  // Convert to uppercase
+        render_glyph(letter - 'a', x, y);  // Convert to uppercase
     }
 }
  
@@ -207,11 +161,11 @@ static void draw_text(const char* text, int x, int y) {
         char c = *text;
  
         if (c >= 'A' && c <= 'Z') {
-            draw_sprite_8x8(letters[c - 'A'], current_x, y);
+            render_glyph(c - 'A', current_x, y);
         } else if (c >= 'a' && c <= 'z') {
-            draw_sprite_8x8(letters[c - 'a'], current_x, y);  // Convert to uppercase
+            render_glyph(c - 'a', current_x, y);  // Convert to uppercase
         } else if (c >= '0' && c <= '9') {
-            draw_sprite_8x8(numbers[c - '0'], current_x, y);
+            render_glyph(GLYPH_DIGIT + c - '0', current_x, y);
         } else if (c == ' ') {
             // Space - just advance position
         }
@@ -267,103 +221,189 @@ static void update_turtle_animation() {
 }
  
 static int get_frog_sprite() {
+    // Sprite of each animation frame; update_animation() keeps anim_timer
+    // below ANIM_FRAMES
+    static const uint8_t anim_sequence[ANIM_FRAMES] = {2, 0, 2};
+ 
     if (!is_animating)
         return 2;
- 
-    int frame = anim_timer / ANIM_SPEED;
-    int anim_sequence[] = {2, 0, 2};
-    return anim_sequence[frame % 3];
+    return anim_sequence[anim_timer];
 }
  
 static void draw_frog() {
-    int sprite = get_frog_sprite();
+    // Sprite transform for each facing (DIR_UP, DIR_RIGHT, DIR_DOWN, DIR_LEFT)
+    static const uint8_t dir_xf[4] = {XF_NONE, XF_ROT_RIGHT, XF_ROT_180, XF_ROT_LEFT};
  
-    if (frog.x < -TILE_W || frog.x >= FB_W || frog.y < -TILE_H || frog.y >= FB_H)
-        return;
+    render_sprite(get_frog_sprite(), frog.x, frog.y, dir_xf[frog_dir & 3]);
+}
  
-    const uint8_t *spr = sprites[sprite];
+static void draw_slow_car(int x) {
+    // Draw sprite 5 for first half
+    draw_lane_fast(5, x);
+    // Draw sprite 6 for second half
+    draw_lane_fast(6, x + TILE_W);
+}
  
-    for (int dy = 0; dy < 16; ++dy) {
-        int y = frog.y + dy;
-        if ((unsigned)y >= FB_H)
-            continue;
+// All pieces, on screen or not: the lane layer scrolls the ones off screen in,
+// the renderer clips them otherwise
+static void draw_log_fast(int x, int len) {
+    if (len <= 0)
+        return;
  
-        for (int dx = 0; dx < 16; ++dx) {
-            int src_x, src_y;
+    if (len == 1) {
+        draw_lane_fast(47, x);
+        return;
+    }
  
-            // Calculate source coordinates based on direction
-            switch (frog_dir) {
-            case DIR_UP:
-                src_x = dx;
-                src_y = dy;
-                break;
-            case DIR_DOWN:
-                src_x = 15 - dx;
-                src_y = 15 - dy;
-                break;
-            case DIR_LEFT:
-                src_x = 15 - dy;
-                src_y = dx;
-                break;
-            case DIR_RIGHT:
-                src_x = dy;
-                src_y = 15 - dx;
-                break;
-            default:
-                src_x = dx;
-                src_y = dy;
-                break;
-            }
+    int end = x;
+    for (int i = 1; i < len; ++i)
+        end += TILE_W;
+    draw_lane_fast(46, x);
+    draw_lane_fast(48, end);
+    for (int tx = x + TILE_W; tx < end; tx += TILE_W)
+        draw_lane_fast(47, tx);
+}
  
-            uint8_t c = spr[src_y * 16 + src_x];
-            if (c) {
-                int x = frog.x + dx;
-                if ((unsigned)x < FB_W)
-                    draw_pixel_fast(x, y, c);
-            }
-        }
-    }
+static void wait_vsync(void) {
+    while (!hal_vsync())
+        hal_flush();
+    while (hal_vsync())
+        hal_flush();
 }
  
-static void draw_slow_car(int x, int y) {
-    // Draw sprite 5 for first half
-    draw_sprite_fast(5, x, y);
-    // Draw sprite 6 for second half
-    draw_sprite_fast(6, x + TILE_W, y);
+static void wait_frame_ready(void) {
+    while (!hal_frame_ready())
+        hal_flush();
 }
  
-static void draw_log_fast(int x, int y, int len) {
-    if (len <= 0 || y < -TILE_H || y >= FB_H)
-        return;
-    if (x >= FB_W || x + len * TILE_W <= 0)
+// Frame handshake with the frame interrupts (HAL_FB_IRQ): finish_frame()
+// returns at once, the loop simulates the next frame while the display
+// still needs the buffer and begin_frame() waits for it after that
+static int irq_loop;
+static int handed;                          // frame handed over, buffer not back yet
+static uint32_t handed_at;                  // hal_cycles() then
+static uint32_t handed_rise, handed_fall;   // interrupt counts then
+ 
+// Waits for interrupt irq after its count `seen`, sending console output
+// or idling meanwhile
+static void wait_irq(int irq, uint32_t seen) {
+    while (hal_irq_count(irq) == seen)
+        if (!hal_flush())
+            hal_idle();
+}
+ 
+// Hands the frame over. Polled, with two buffers the CPU waits for the
+// swap at the next vsync; with three it only waits until the frame is
+// taken, which is at once unless one is already queued, and the swap
+// happens without it
+static void finish_frame(void) {
+    if (irq_loop) {
+        handed_rise = hal_irq_count(HAL_IRQ_READY_RISE);
+        handed_fall = hal_irq_count(HAL_IRQ_READY_FALL);
+        handed_at = hal_cycles();
+        handed = 1;
+        hal_set_cpu_done(1);
         return;
+    }
+    hal_set_cpu_done(1);
+    if (hal_fb_caps() & HAL_FB_TRIPLE) {
+        while (hal_frame_ready())
+            hal_flush();
+    } else
+        wait_vsync();
+}
  
-    if (len == 1) {
-        draw_sprite_fast(47, x, y);
+// Waits for a back buffer to draw into. With the interrupts that is the
+// rise of frame_ready after the swap, with three buffers the fall when the
+// frame is taken and then the rise once cpu_done is low again
+static void begin_frame(void) {
+    phase_mark(PHASE_WAIT_READY);
+    if (!irq_loop) {
+        hal_set_cpu_done(0);
+        wait_frame_ready();
         return;
     }
+    if (!handed)
+        return;   // nothing handed over since: the back buffer is still ours
+ 
+    uint32_t t_wait = hal_cycles();
+    int back = HAL_IRQ_READY_RISE;
+    if (hal_fb_caps() & HAL_FB_TRIPLE) {
+        wait_irq(HAL_IRQ_READY_FALL, handed_fall);
+        back = HAL_IRQ_READY_FALL;
+        uint32_t rise = hal_irq_count(HAL_IRQ_READY_RISE);
+        hal_set_cpu_done(0);
+        wait_irq(HAL_IRQ_READY_RISE, rise);
+    } else {
+        wait_irq(HAL_IRQ_READY_RISE, handed_rise);
+        hal_set_cpu_done(0);
+    }
+    handed = 0;
+ 
+    // The simulation ran in slack up to the interrupt, or all of it if the
+    // interrupt came later
+    uint32_t t_back = hal_irq_cycles(back);
+    uint32_t sim = t_wait - handed_at;
+    if (t_back - handed_at < sim)
+        sim = t_back - handed_at;
+    slack_frame(sim, hal_cycles() - t_wait);
+}
  
-    if (x > -TILE_W)
-        draw_sprite_fast(46, x, y);
-    if (x + (len - 1) * TILE_W < FB_W)
-        draw_sprite_fast(48, x + (len - 1) * TILE_W, y);
-    for (int i = 1; i < len - 1; ++i) {
-        int tx = x + i * TILE_W;
-        if (tx > -TILE_W && tx < FB_W)
-            draw_sprite_fast(47, tx, y);
+// The second of pause after a death; with the interrupts it is counted in
+// vsyncs, and console output goes out meanwhile. With the palette it is
+// counted in vsyncs too, and the dead frog flashes red every 8 of them
+static void pause_1s(void) {
+    if (!irq_loop && !pal_fx) {
+        hal_sleep(1);
+        return;
+    }
+    for (int i = 0; i < 60; ++i) {
+        if (pal_fx && i % 8 == 0)
+            hal_palette_write(PAL_FROG, i & 8 ? render_palette(PAL_FROG) : PAL_FLASH);
+        if (irq_loop)
+            wait_irq(HAL_IRQ_VSYNC, hal_irq_count(HAL_IRQ_VSYNC));
+        else
+            wait_vsync();
     }
 }
  
-static void wait_vsync(void) {
-    while (!(XGpio_DiscreteRead(&gpio_vsync, GPIO_CH) & 1))
-        ;
-    while ((XGpio_DiscreteRead(&gpio_vsync, GPIO_CH) & 1))
-        ;
+// Every SHIMMER_FRAMES the river's blue steps along +0, +1, +2, +1 of its
+// palette.mem value: one register write instead of redrawing the water
+static void palette_shimmer(void) {
+    static const uint8_t blue[4] = {0, 1, 2, 1};
+ 
+    if (!pal_fx || ++shimmer_timer < SHIMMER_FRAMES)
+        return;
+    shimmer_timer = 0;
+    shimmer_step = (shimmer_step + 1) & 3;
+    hal_palette_write(PAL_WATER, render_palette(PAL_WATER) + blue[shimmer_step]);
 }
  
-static void wait_frame_ready(void) {
-    while (!(XGpio_DiscreteRead(&gpio_frame_rdy, GPIO_CH) & 1))
-        ;
+// Game-over fade: each frame every channel of every entry but the text
+// drops by one, down to half its palette.mem value
+static void palette_fade(void) {
+    if (!pal_fx || fade_level == FADE_STEPS)
+        return;
+    ++fade_level;
+    for (int i = 0; i < 16; ++i) {
+        if (i == PAL_TEXT)
+            continue;
+        uint16_t base = render_palette(i), rgb = 0;
+        for (int sh = 0; sh < 12; sh += 4) {
+            int c = base >> sh & 0xF, d = c - fade_level;
+            rgb |= (uint16_t)((d < c >> 1 ? c >> 1 : d) << sh);
+        }
+        hal_palette_write(i, rgb);
+    }
+}
+ 
+// Back to palette.mem for a new game
+static void palette_restore(void) {
+    if (!pal_fx)
+        return;
+    for (int i = 0; i < 16; ++i)
+        hal_palette_write(i, render_palette(i));
+    shimmer_timer = shimmer_step = fade_level = 0;
 }
  
 static void bar_init(void) {
@@ -513,27 +553,6 @@ static int check_car_collisions(int fx, int fy) {
     return 0;
 }
  
-static void init_io(void) {
-    XGpio_Initialize(&gpio_we, WE_DEVICE_ID);
-    XGpio_Initialize(&gpio_addr, ADDR_DEVICE_ID);
-    XGpio_Initialize(&gpio_dat, DAT_DEVICE_ID);
-    XGpio_Initialize(&gpio_vsync, VSYNC_DEVICE_ID);
-    XGpio_Initialize(&gpio_frame_rdy, FRAME_RDY_DEVICE_ID);
-    XGpio_Initialize(&gpio_done, CPU_DONE_DEVICE_ID);
- 
-    XGpio_SetDataDirection(&gpio_we, GPIO_CH, 0);
-    XGpio_SetDataDirection(&gpio_addr, GPIO_CH, 0);
-    XGpio_SetDataDirection(&gpio_dat, GPIO_CH, 0);
-    XGpio_SetDataDirection(&gpio_done, GPIO_CH, 0);
-    XGpio_SetDataDirection(&gpio_vsync, GPIO_CH, 0xFFFFFFFF);
-    XGpio_SetDataDirection(&gpio_frame_rdy, GPIO_CH, 0xFFFFFFFF);
- 
-    XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 0);
- 
-    KYPD_begin(&keypad, KYPD_GPIO_ID);
-    KYPD_loadKeyTable(&keypad, (u8 *)KEYTABLE);
-}
- 
 static void reset_frog(struct Obj *f) {
     f->x = (FB_W - TILE_W) / 2;
     f->y = FB_H - 2 * TILE_H;
@@ -615,28 +634,13 @@ static void start_new_game(void) {
         targets[i].filled = 0;
  
     reset_world();
+    palette_restore();
 }
  
 static void draw_complete_frame(void) {
-    // Draw background tiles (with the skip check restored for performance)
-    for (int ty = 0; ty < FB_H / TILE_H; ++ty)
-        for (int tx = 0; tx < FB_W / TILE_W; ++tx) {
-            uint8_t tid = bg_tilemap[ty][tx];
-            if (!tid)
-                continue; // Restore this for performance
- 
-            const uint8_t *tile = background[tid];
-            int bx = tx * TILE_W, by = ty * TILE_H;
-            for (int dy = 0; dy < TILE_H; ++dy) {
-                const uint8_t *row = &tile[dy * TILE_W];
-                int y = by + dy;
-                for (int dx = 0; dx < TILE_W; ++dx) {
-                    uint8_t c = row[dx];
-                    if (c)
-                        draw_pixel_fast(bx + dx, y, c);
-                }
-            }
-        }
+    phase_mark(PHASE_BACKGROUND);
+    render_begin();
+    phase_mark(PHASE_SPRITES);
  
     // Draw lily pads (these are on water)
     for (int i = 0; i < 5; ++i) {
@@ -650,224 +654,265 @@ static void draw_complete_frame(void) {
     }
  
     // Draw timer bar
-    for (int x = BAR_X0 + (BAR_W - bar_cols); x < BAR_X0 + BAR_W; ++x)
-        for (int y = 0; y < BAR_H; ++y)
-            draw_pixel_fast(x, BAR_Y0 + y, BAR_COLOR);
+    render_fill(BAR_X0 + (BAR_W - bar_cols), BAR_Y0, bar_cols, BAR_H, BAR_COLOR);
  
     // Draw logs (these should have blue background built into the sprites)
+    render_lane(log_row0[0].y, PERIOD_LOGS(log_row0_len, 1));
     for (int i = 0; i < LOGS_ROW0; ++i)
-        draw_log_fast(log_row0[i].x, log_row0[i].y, log_row0_len);
+        draw_log_fast(log_row0[i].x, log_row0_len);
+    render_lane(log_row1[0].y, PERIOD_LOGS(log_row1_len, 2));
     for (int i = 0; i < LOGS_ROW1; ++i)
-        draw_log_fast(log_row1[i].x, log_row1[i].y, log_row1_len);
+        draw_log_fast(log_row1[i].x, log_row1_len);
+    render_lane(log_row2[0].y, PERIOD_LOGS(log_row2_len, 1));
     for (int i = 0; i < LOGS_ROW2; ++i)
-        draw_log_fast(log_row2[i].x, log_row2[i].y, log_row2_len);
+        draw_log_fast(log_row2[i].x, log_row2_len);
  
     // Draw turtles (these should have blue background built into the sprites)
-    for (int c = 0; c < CLUSTERS_ROW0; ++c) {
+    render_lane(turtle_row0[0].y, PERIOD_TURTLES);
+    for (int c = 0, idx = 0; c < CLUSTERS_ROW0; ++c) {
         int hidden = (submerged_row[0] && c == diving_cluster_row[0]);
-        for (int t = 0; t < TPC_ROW0; ++t) {
-            int idx = c * TPC_ROW0 + t;
+        for (int t = 0; t < TPC_ROW0; ++t, ++idx) {
             if (!hidden)
-                draw_sprite_fast(turtle_row0[idx].idx, turtle_row0[idx].x, turtle_row0[idx].y);
+                draw_lane_fast(turtle_row0[idx].idx, turtle_row0[idx].x);
             else
-            	draw_sprite_fast(26, turtle_row0[idx].x, turtle_row0[idx].y);
+            	draw_lane_fast(26, turtle_row0[idx].x);
         }
     }
-    for (int c = 0; c < CLUSTERS_ROW1; ++c) {
+    render_lane(turtle_row1[0].y, PERIOD_TURTLES);
+    for (int c = 0, idx = 0; c < CLUSTERS_ROW1; ++c) {
         int hidden = (submerged_row[1] && c == diving_cluster_row[1]);
-        for (int t = 0; t < TPC_ROW1; ++t) {
-            int idx = c * TPC_ROW1 + t;
+        for (int t = 0; t < TPC_ROW1; ++t, ++idx) {
             if (!hidden)
-                draw_sprite_fast(turtle_row1[idx].idx, turtle_row1[idx].x, turtle_row1[idx].y);
+                draw_lane_fast(turtle_row1[idx].idx, turtle_row1[idx].x);
             else
-            	draw_sprite_fast(26, turtle_row1[idx].x, turtle_row1[idx].y);
+            	draw_lane_fast(26, turtle_row1[idx].x);
         }
     }
  
-    // Draw cars (these are on road, not water)
-    for (int i = 0; i < 3; i++) {
-        draw_sprite_fast(cars_208[i].idx, cars_208[i].x, cars_208[i].y);
-        draw_sprite_fast(cars_192[i].idx, cars_192[i].x, cars_192[i].y);
-        draw_sprite_fast(cars_176[i].idx, cars_176[i].x, cars_176[i].y);
-    }
-    for (int i = 0; i < 2; i++) {
-        draw_sprite_fast(cars_160[i].idx, cars_160[i].x, cars_160[i].y);
-        draw_slow_car(cars_144[i].x, cars_144[i].y);
-    }
+    // Draw cars (these are on road, not water), one lane at a time
+    render_lane(cars_208[0].y, PERIOD_CARS_L);
+    for (int i = 0; i < 3; i++)
+        draw_lane_fast(cars_208[i].idx, cars_208[i].x);
+    render_lane(cars_192[0].y, PERIOD_CARS_R);
+    for (int i = 0; i < 3; i++)
+        draw_lane_fast(cars_192[i].idx, cars_192[i].x);
+    render_lane(cars_176[0].y, PERIOD_CARS_L);
+    for (int i = 0; i < 3; i++)
+        draw_lane_fast(cars_176[i].idx, cars_176[i].x);
+    render_lane(cars_160[0].y, PERIOD_CARS_R);
+    for (int i = 0; i < 2; i++)
+        draw_lane_fast(cars_160[i].idx, cars_160[i].x);
+    render_lane(cars_144[0].y, PERIOD_CARS_144);
+    for (int i = 0; i < 2; i++)
+        draw_slow_car(cars_144[i].x);
  
     // Draw frog
     draw_frog();
  
     // Draw lives and score using sprite #2 instead of life.h
-    for (int i = 0; i < lives; ++i)
-        draw_sprite_fast(2, 8 + i * 16, 242);
+    phase_mark(PHASE_HUD);
+    for (int i = 0, x = 8; i < lives; ++i, x += 16)
+        draw_sprite_fast(2, x, 242);
  
     // Draw score label and number
     draw_number(score, 4, 8);   // Score value
 }
  
-int main(void) {
-    init_io();
-    start_new_game();
+// Enhanced game over screen, drawn over the last frame
+static void draw_game_over(void) {
+    draw_text("GAME OVER", 64, 100);
+    draw_text("FINAL SCORE", 64, 120);
+    draw_number(score, 96, 140);
+    draw_text("PRESS 5 TO RESTART", 32, 180);
+}
  
-    uint16_t ks, st;
-    uint8_t key, last = 0;
+static void draw_death_frame(void) {
+    draw_complete_frame();
+    phase_mark(PHASE_SPRITES);
+    draw_sprite_fast(SPR_DEAD, frog.x, frog.y);
+}
  
-    while (1) {
-        XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 0);
-        wait_frame_ready();
+// Store previous positions
+static void save_positions(void) {
+    for (int i = 0; i < LOGS_ROW0; ++i)
+        log_row0[i].px = log_row0[i].x;
+    for (int i = 0; i < LOGS_ROW1; ++i)
+        log_row1[i].px = log_row1[i].x;
+    for (int i = 0; i < LOGS_ROW2; ++i)
+        log_row2[i].px = log_row2[i].x;
  
-        update_animation();
-        update_fly_system();
-        update_turtle_animation();
+    for (int i = 0; i < 3; i++) {
+        cars_208[i].px = cars_208[i].x;
+        cars_192[i].px = cars_192[i].x;
+        cars_176[i].px = cars_176[i].x;
+    }
+    for (int i = 0; i < 2; i++) {
+        cars_160[i].px = cars_160[i].x;
+        cars_144[i].px = cars_144[i].x;
+    }
  
-        if (game_over) {
-            draw_complete_frame();
+    frog.px = frog.x;
+    frog.py = frog.y;
+    for (int i = 0; i < TURTLES_ROW0; ++i)
+        turtle_row0[i].px = turtle_row0[i].x;
+    for (int i = 0; i < TURTLES_ROW1; ++i)
+        turtle_row1[i].px = turtle_row1[i].x;
+}
  
-            // Enhanced game over screen
-            draw_text("GAME OVER", 64, 100);
-            draw_text("FINAL SCORE", 64, 120);
-            draw_number(score, 96, 140);
-            draw_text("PRESS 5 TO RESTART", 32, 180);
+static void move_lanes(void) {
+    // Move logs
+    for (int i = 0; i < LOGS_ROW0; ++i) {
+        log_row0[i].x += log_row0[i].dx;
+        if (log_row0[i].x > FB_W + TILE_W)
+            log_row0[i].x = -(log_row0_len * TILE_W);
+        if (log_row0[i].x < -(log_row0_len * TILE_W) - TILE_W)
+            log_row0[i].x = FB_W + TILE_W;
+    }
+    for (int i = 0; i < LOGS_ROW1; ++i) {
+        log_row1[i].x += log_row1[i].dx;
+        if (log_row1[i].x > FB_W + TILE_W)
+            log_row1[i].x = -(log_row1_len * TILE_W);
+        if (log_row1[i].x < -(log_row1_len * TILE_W) - TILE_W)
+            log_row1[i].x = FB_W + TILE_W;
+    }
+    for (int i = 0; i < LOGS_ROW2; ++i) {
+        log_row2[i].x += log_row2[i].dx;
+        if (log_row2[i].x > FB_W + TILE_W)
+            log_row2[i].x = -(log_row2_len * TILE_W);
+        if (log_row2[i].x < -(log_row2_len * TILE_W) - TILE_W)
+            log_row2[i].x = FB_W + TILE_W;
+    }
  
-            XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 1);
-            wait_vsync();
+    // Move cars
+    for (int i = 0; i < 3; i++) {
+        cars_208[i].x += cars_208[i].dx;
+        if (cars_208[i].x < -2 * TILE_W)
+            cars_208[i].x = FB_W + TILE_W;
  
-            ks = KYPD_getKeyStates(&keypad);
-            st = KYPD_getKeyPressed(&keypad, ks, &key);
-            if (st == KYPD_SINGLE_KEY && key == '5')
-                start_new_game();
-            continue;
-        }
+        cars_192[i].x += cars_192[i].dx;
+        if (cars_192[i].x > FB_W + TILE_W)
+            cars_192[i].x = -TILE_W;
  
-        // Store previous positions
-        for (int i = 0; i < LOGS_ROW0; ++i)
-            log_row0[i].px = log_row0[i].x;
-        for (int i = 0; i < LOGS_ROW1; ++i)
-            log_row1[i].px = log_row1[i].x;
-        for (int i = 0; i < LOGS_ROW2; ++i)
-            log_row2[i].px = log_row2[i].x;
- 
-        for (int i = 0; i < 3; i++) {
-            cars_208[i].px = cars_208[i].x;
-            cars_192[i].px = cars_192[i].x;
-            cars_176[i].px = cars_176[i].x;
-        }
-        for (int i = 0; i < 2; i++) {
-            cars_160[i].px = cars_160[i].x;
-            cars_144[i].px = cars_144[i].x;
-        }
+        cars_176[i].x += cars_176[i].dx;
+        if (cars_176[i].x < -2 * TILE_W)
+            cars_176[i].x = FB_W + TILE_W;
+    }
  
-        frog.px = frog.x;
-        frog.py = frog.y;
-        for (int i = 0; i < TURTLES_ROW0; ++i)
-            turtle_row0[i].px = turtle_row0[i].x;
-        for (int i = 0; i < TURTLES_ROW1; ++i)
-            turtle_row1[i].px = turtle_row1[i].x;
- 
-        // Move logs
-        for (int i = 0; i < LOGS_ROW0; ++i) {
-            log_row0[i].x += log_row0[i].dx;
-            if (log_row0[i].x > FB_W + TILE_W)
-                log_row0[i].x = -(log_row0_len * TILE_W);
-            if (log_row0[i].x < -(log_row0_len * TILE_W) - TILE_W)
-                log_row0[i].x = FB_W + TILE_W;
-        }
-        for (int i = 0; i < LOGS_ROW1; ++i) {
-            log_row1[i].x += log_row1[i].dx;
-            if (log_row1[i].x > FB_W + TILE_W)
-                log_row1[i].x = -(log_row1_len * TILE_W);
-            if (log_row1[i].x < -(log_row1_len * TILE_W) - TILE_W)
-                log_row1[i].x = FB_W + TILE_W;
-        }
-        for (int i = 0; i < LOGS_ROW2; ++i) {
-            log_row2[i].x += log_row2[i].dx;
-            if (log_row2[i].x > FB_W + TILE_W)
-                log_row2[i].x = -(log_row2_len * TILE_W);
-            if (log_row2[i].x < -(log_row2_len * TILE_W) - TILE_W)
-                log_row2[i].x = FB_W + TILE_W;
-        }
+    for (int i = 0; i < 2; i++) {
+        cars_160[i].x += cars_160[i].dx;
+        if (cars_160[i].x > FB_W + TILE_W)
+            cars_160[i].x = -TILE_W;
  
-        // Move cars
-        for (int i = 0; i < 3; i++) {
-            cars_208[i].x += cars_208[i].dx;
-            if (cars_208[i].x < -2 * TILE_W)
-                cars_208[i].x = FB_W + TILE_W;
+        cars_144[i].x += cars_144[i].dx;
+        if (cars_144[i].x < -3 * TILE_W)
+            cars_144[i].x = FB_W + TILE_W; // Account for 32px width
+    }
  
-            cars_192[i].x += cars_192[i].dx;
-            if (cars_192[i].x > FB_W + TILE_W)
-                cars_192[i].x = -TILE_W;
+    // Move turtles
+    for (int i = 0; i < TURTLES_ROW0; ++i) {
+        turtle_row0[i].x += turtle_row0[i].dx;
+        if (turtle_row0[i].x > FB_W + TILE_W)
+            turtle_row0[i].x = -TILE_W;
+        if (turtle_row0[i].x < -2 * TILE_W)
+            turtle_row0[i].x = FB_W + TILE_W;
+    }
+    for (int i = 0; i < TURTLES_ROW1; ++i) {
+        turtle_row1[i].x += turtle_row1[i].dx;
+        if (turtle_row1[i].x > FB_W + TILE_W)
+            turtle_row1[i].x = -TILE_W;
+        if (turtle_row1[i].x < -2 * TILE_W)
+            turtle_row1[i].x = FB_W + TILE_W;
+    }
  
-            cars_176[i].x += cars_176[i].dx;
-            if (cars_176[i].x < -2 * TILE_W)
-                cars_176[i].x = FB_W + TILE_W;
-        }
+    // Turtle dive FSM
+    ++dive_timer_row[0];
  
-        for (int i = 0; i < 2; i++) {
-            cars_160[i].x += cars_160[i].dx;
-            if (cars_160[i].x > FB_W + TILE_W)
-                cars_160[i].x = -TILE_W;
+    // Prevent timer overflow
+    if (dive_timer_row[0] > 10000) dive_timer_row[0] = 0;
+ 
+    if (dive_timer_row[0] == DIVE_STAGES) {
+        submerged_row[0] = 1;
+        int c = diving_cluster_row[0];
+        for (int t = 0; t < TPC_ROW0; ++t)
+            turtle_row0[c * TPC_ROW0 + t].idx = 26;
+    } else if (dive_timer_row[0] == DIVE_STAGES + SURFACE_TIME) {
+        int c = diving_cluster_row[0];
+        submerged_row[0] = 0;
+        // Reset to animated sprites when surfacing - FIX: pass 0 for is_diving
+        for (int t = 0; t < TPC_ROW0; ++t)
+            turtle_row0[c * TPC_ROW0 + t].idx = 23;  // Changed from 1 to 0
+        dive_timer_row[0] = 0;
+    }
  
-            cars_144[i].x += cars_144[i].dx;
-            if (cars_144[i].x < -3 * TILE_W)
-                cars_144[i].x = FB_W + TILE_W; // Account for 32px width
-        }
+    ++dive_timer_row[1];
  
-        // Move turtles
-        for (int i = 0; i < TURTLES_ROW0; ++i) {
-            turtle_row0[i].x += turtle_row0[i].dx;
-            if (turtle_row0[i].x > FB_W + TILE_W)
-                turtle_row0[i].x = -TILE_W;
-            if (turtle_row0[i].x < -2 * TILE_W)
-                turtle_row0[i].x = FB_W + TILE_W;
-        }
-        for (int i = 0; i < TURTLES_ROW1; ++i) {
-            turtle_row1[i].x += turtle_row1[i].dx;
-            if (turtle_row1[i].x > FB_W + TILE_W)
-                turtle_row1[i].x = -TILE_W;
-            if (turtle_row1[i].x < -2 * TILE_W)
-                turtle_row1[i].x = FB_W + TILE_W;
-        }
+    // Prevent timer overflow
+    if (dive_timer_row[1] > 10000) dive_timer_row[1] = 0;
+ 
+    if (dive_timer_row[1] == DIVE_STAGES) {
+        submerged_row[1] = 1;
+        int c = diving_cluster_row[1];
+        for (int t = 0; t < TPC_ROW1; ++t)
+            turtle_row1[c * TPC_ROW1 + t].idx = 26;
+    } else if (dive_timer_row[1] == DIVE_STAGES + SURFACE_TIME) {
+        int c = diving_cluster_row[1];
+        submerged_row[1] = 0;
+        // Reset to animated sprites when surfacing - FIX: pass 0 for is_diving
+        for (int t = 0; t < TPC_ROW1; ++t)
+            turtle_row1[c * TPC_ROW1 + t].idx = 23;  // Changed from 1 to 0
+        dive_timer_row[1] = 0;
+    }
+}
  
-        // Turtle dive FSM
-        ++dive_timer_row[0];
- 
-        // Prevent timer overflow
-        if (dive_timer_row[0] > 10000) dive_timer_row[0] = 0;
- 
-        if (dive_timer_row[0] == DIVE_STAGES) {
-            submerged_row[0] = 1;
-            int c = diving_cluster_row[0];
-            for (int t = 0; t < TPC_ROW0; ++t)
-                turtle_row0[c * TPC_ROW0 + t].idx = 26;
-        } else if (dive_timer_row[0] == DIVE_STAGES + SURFACE_TIME) {
-            int c = diving_cluster_row[0];
-            submerged_row[0] = 0;
-            // Reset to animated sprites when surfacing - FIX: pass 0 for is_diving
-            for (int t = 0; t < TPC_ROW0; ++t)
-                turtle_row0[c * TPC_ROW0 + t].idx = 23;  // Changed from 1 to 0
-            dive_timer_row[0] = 0;
-        }
+int main(void) {
+    hal_init();
+    render_init();
+    phase_reset();
+    fps_reset();
+    slack_reset();
+    pal_fx = (hal_fb_caps() & HAL_FB_PALETTE) != 0;
+    start_new_game();
  
-        ++dive_timer_row[1];
- 
-        // Prevent timer overflow
-        if (dive_timer_row[1] > 10000) dive_timer_row[1] = 0;
- 
-        if (dive_timer_row[1] == DIVE_STAGES) {
-            submerged_row[1] = 1;
-            int c = diving_cluster_row[1];
-            for (int t = 0; t < TPC_ROW1; ++t)
-                turtle_row1[c * TPC_ROW1 + t].idx = 26;
-        } else if (dive_timer_row[1] == DIVE_STAGES + SURFACE_TIME) {
-            int c = diving_cluster_row[1];
-            submerged_row[1] = 0;
-            // Reset to animated sprites when surfacing - FIX: pass 0 for is_diving
-            for (int t = 0; t < TPC_ROW1; ++t)
-                turtle_row1[c * TPC_ROW1 + t].idx = 23;  // Changed from 1 to 0
-            dive_timer_row[1] = 0;
+    // The first back buffer comes with the first frame pulse; from then on
+    // begin_frame() only waits after a hand-over
+    irq_loop = (hal_fb_caps() & HAL_FB_IRQ) != 0;
+    if (irq_loop)
+        wait_frame_ready();
+ 
+    uint16_t ks, st;
+    uint8_t key, last = 0;
+ 
+    // Each pass simulates a frame, then waits for a back buffer and draws
+    // it, so with the interrupts the simulation runs while the last frame
+    // still waits for its swap
+    while (1) {
+        phase_frame(PHASE_LANES);
+        update_animation();
+        update_fly_system();
+        update_turtle_animation();
+ 
+        if (game_over) {
+            palette_fade();
+            begin_frame();
+            draw_complete_frame();
+            draw_game_over();
+            phase_mark(PHASE_FLUSH);
+            render_end();
+            phase_mark(PHASE_WAIT_VSYNC);
+            finish_frame();
+ 
+            phase_mark(PHASE_INPUT);
+            ks = hal_key_states();
+            st = hal_key_pressed(ks, &key);
+            if (st == HAL_KEY_SINGLE && key == '5')
+                start_new_game();
+            continue;
         }
  
+        save_positions();
+        move_lanes();
+        palette_shimmer();
+ 
         // Carry frog with log/turtle
         if (log_dx) {
             frog.x += log_dx;
@@ -881,9 +926,10 @@ int main(void) {
         }
  
         // Keypad input
-        ks = KYPD_getKeyStates(&keypad);
-        st = KYPD_getKeyPressed(&keypad, ks, &key);
-        if (st == KYPD_SINGLE_KEY && key != last) {
+        phase_mark(PHASE_INPUT);
+        ks = hal_key_states();
+        st = hal_key_pressed(ks, &key);
+        if (st == HAL_KEY_SINGLE && key != last) {
             int moved = 0;
             switch (key) {
             case '2':
@@ -918,6 +964,15 @@ int main(void) {
                 moved = 1;
                 frog_dir = DIR_RIGHT;
                 break;
+            case 'D':
+                phase_dump();
+                fps_dump();
+                slack_dump();
+                // gmon_dump() prints past the console queue
+                while (hal_flush())
+                    ;
+                gmon_dump();
+                break;
             }
             if (frog.x < 0)
                 frog.x = 0;
@@ -930,10 +985,11 @@ int main(void) {
             last = key;
             if (moved)
                 log_dx = 0;
-        } else if (st != KYPD_SINGLE_KEY)
+        } else if (st != HAL_KEY_SINGLE)
             last = 0;
  
         // Lily-pad landing
+        phase_mark(PHASE_COLLIDE);
         if (frog.y < RIVER_TOP) {
             for (int i = 0; i < 5; ++i)
                 if (!targets[i].filled && abs(frog.x - targets[i].x) < TILE_W) {
@@ -971,11 +1027,14 @@ int main(void) {
         // Log/turtle collision
         log_dx = check_frog_on_log(frog.x, frog.y);
         if (log_dx == -999) {
-            draw_complete_frame();
-            draw_sprite_fast(SPR_DEAD, frog.x, frog.y);
-            XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 1);
-            wait_vsync();
-            sleep(1);
+            begin_frame();
+            draw_death_frame();
+            phase_mark(PHASE_FLUSH);
+            render_end();
+            phase_mark(PHASE_WAIT_VSYNC);
+            finish_frame();
+            phase_mark(PHASE_PAUSE);
+            pause_1s();
             if (--lives <= 0)
                 game_over = 1;
             else
@@ -985,11 +1044,14 @@ int main(void) {
  
         // Car collision
         if (check_car_collisions(frog.x, frog.y)) {
-            draw_complete_frame();
-            draw_sprite_fast(SPR_DEAD, frog.x, frog.y);
-            XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 1);
-            wait_vsync();
-            sleep(1);
+            begin_frame();
+            draw_death_frame();
+            phase_mark(PHASE_FLUSH);
+            render_end();
+            phase_mark(PHASE_WAIT_VSYNC);
+            finish_frame();
+            phase_mark(PHASE_PAUSE);
+            pause_1s();
             if (--lives <= 0)
                 game_over = 1;
             else
@@ -1007,9 +1069,12 @@ int main(void) {
             continue;
         }
  
+        begin_frame();
         draw_complete_frame();
-        XGpio_DiscreteWrite(&gpio_done, GPIO_CH, 1);
-        wait_vsync();
+        phase_mark(PHASE_FLUSH);
+        render_end();
+        phase_mark(PHASE_WAIT_VSYNC);
+        finish_frame();
     }
     return 0;
 }
@@ -1,4 +1,4 @@
-// Auto-generated 8x8 number sprites for scoring
+// Auto-generated by frogger_host/assetgen from numbers.png, do not edit.
 #pragma once
 #include <stdint.h>
 
@@ -108,4 +108,4 @@ static const uint8_t numbers[NUM_DIGITS][DIGIT_W * DIGIT_H] = {
     0xE, 0xE, 0x0, 0x0, 0x0, 0x0, 0xE, 0xE,
     0x0, 0xE, 0xE, 0xE, 0xE, 0xE, 0xE, 0x0
   }
-};
\ No newline at end of file
+};
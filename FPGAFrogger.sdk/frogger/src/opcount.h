@@ -0,0 +1,27 @@
+// Markers for arithmetic the MicroBlaze cannot do in one instruction.
+//
+// The core is built with -mxl-soft-mul and has no hardware divider or barrel
+// shifter, so a multiply by a runtime value or a non-power-of-two constant
+// becomes a __mulsi3 call or a shift-add chain, and every divide/modulo a
+// __divsi3/__modsi3 call. Wrapping them lets the host build count how many
+// each frame costs; on the board the macros compile to the plain operator.
+// The hardware-math build (../../frogger_hwmath) has the multiplier and the
+// barrel shifter, still no divider.
+//
+// OP_PX(n) marks n pixels the renderer composes in RAM without a bus write,
+// so the host can charge that loop work as well.
+#pragma once
+#include <stdint.h>
+
+#ifdef FROGGER_COUNT_OPS
+extern uint32_t op_count_mul, op_count_div, op_count_px;
+#define OP_MUL(a, b) (op_count_mul++, (a) * (b))
+#define OP_DIV(a, b) (op_count_div++, (a) / (b))
+#define OP_MOD(a, b) (op_count_div++, (a) % (b))
+#define OP_PX(n) (op_count_px += (n))
+#else
+#define OP_MUL(a, b) ((a) * (b))
+#define OP_DIV(a, b) ((a) / (b))
+#define OP_MOD(a, b) ((a) % (b))
+#define OP_PX(n) ((void)0)
+#endif
@@ -0,0 +1,387 @@
+// Auto-generated by frogger_host/packgen from sprites.h, background.h,
+// letters.h and numbers.h, do not edit.
+//
+// The assets at 4 bits per pixel, each distinct row stored once, see
+// packgen.c for the layout. Included by render.c.
+#pragma once
+#include <stdint.h>
+
+#define NUM_SPRITES 54
+#define BG_NUM_SPRITES 11
+#define NUM_GLYPHS 36
+#define SPR_W 16
+#define SPR_H 16
+#define TILES_X 14
+#define TILES_Y 16
+#define NUM_ROWS 491
+#define NUM_GLYPH_ROWS 36
+#define PACKED_BYTES 8070   // 12576 with a row per image row, 19168 as bytes
+
+static const uint32_t row_pix[491][2] = {
+    {0x00000000, 0x00000000}, {0x00006000, 0x00060000}, {0x64006600, 0x00660044}, {0x46706000, 0x00060764},
+    {0x46606000, 0x00060664}, {0x44460000, 0x00006444}, {0x46400000, 0x00000444}, {0x64600000, 0x00000644},
+    {0x46660000, 0x00006664}, {0x00066000, 0x00066000}, {0x00006600, 0x00660000}, {0x00060000, 0x00006000},
+    {0x64066000, 0x00066044}, {0x46760000, 0x00006764}, {0x00660000, 0x00006600}, {0x00600000, 0x00000600},
+    {0x06000000, 0x00000060}, {0x64006000, 0x00060044}, {0x46706600, 0x00660764}, {0x44466000, 0x00066444},
+    {0x46466000, 0x00066444}, {0x64606000, 0x00060644}, {0x46006600, 0x00660064}, {0x00000000, 0xAAAAA000},
+    {0xAAAAA000, 0xAAAAA000}, {0x00800000, 0x00800000}, {0x44444000, 0x04444444}, {0x88444408, 0x88888448},
+    {0x88844440, 0x4A4A4A44}, {0xADADADA0, 0x0DDD0000}, {0xADADADA0, 0x00AD0000}, {0x06000600, 0x0DDD6660},
+    {0xDDDDDD00, 0x00AD00DD}, {0x66DDDDD0, 0x0DDD006D}, {0x6D666DD0, 0x00AD00DD}, {0xDADADAD0, 0x00AD0000},
+    {0xDADADAD0, 0x0DDD0000}, {0x66000000, 0x06666006}, {0xDDDA0000, 0xDDDDDD0D}, {0xDDDDA000, 0xDDDDDD0D},
+    {0xDDDDA000, 0xDDDDDDAD}, {0x66000000, 0x00666006}, {0x00000000, 0x00066600}, {0xDDDDDDDD, 0x00DDDDDD},
+    {0x00550000, 0x00555000}, {0x77777300, 0x07777700}, {0x33777730, 0x37777737}, {0x73377530, 0x07333777},
+    {0x73377730, 0x07333777}, {0x00AAAAA0, 0x00000000}, {0x00AAAAA0, 0x00AAAAA0}, {0x00006000, 0x00006000},
+    {0xDDDDDDD0, 0x00DDDDDD}, {0xDD666666, 0x0DDDD666}, {0xDA0ADA00, 0xDDDD666D}, {0xDADADAD0, 0xDDDD666D},
+    {0x00003000, 0x00030000}, {0x37003300, 0x00330077}, {0x73503000, 0x00030537}, {0x73303000, 0x00030337},
+    {0x77730000, 0x00003777}, {0x73700000, 0x00000777}, {0x37300000, 0x00000377}, {0x73330000, 0x00003337},
+    {0x00033000, 0x00033000}, {0x00003300, 0x00330000}, {0x00030000, 0x00003000}, {0x37033000, 0x00033077},
+    {0x73530000, 0x00003537}, {0x00330000, 0x00003300}, {0x00300000, 0x00000300}, {0x03000000, 0x00000030},
+    {0x37003000, 0x00030077}, {0x73503300, 0x00330537}, {0x77733000, 0x00033777}, {0x73733000, 0x00033777},
+    {0x37303000, 0x00030377}, {0x73003300, 0x00330037}, {0x00004000, 0x00040000}, {0x48004400, 0x00440088},
+    {0x84A04000, 0x00040A48}, {0x84404000, 0x00040448}, {0x88840000, 0x00004888}, {0x84800000, 0x00000888},
+    {0x48400000, 0x00000488}, {0x84440000, 0x00004448}, {0x00044000, 0x00044000}, {0x00004400, 0x00440000},
+    {0x00040000, 0x00004000}, {0x48044000, 0x00044088}, {0x84A40000, 0x00004A48}, {0x00440000, 0x00004400},
+    {0x00400000, 0x00000400}, {0x04000000, 0x00000040}, {0x48004000, 0x00040088}, {0x84A04400, 0x00440A48},
+    {0x88844000, 0x00044888}, {0x84844000, 0x00044888}, {0x48404000, 0x00040488}, {0x84004400, 0x00440048},
+    {0x44000000, 0x00000444}, {0x44400000, 0x00004444}, {0x40440000, 0x00044044}, {0x44040000, 0x00040444},
+    {0x44440440, 0x44044444}, {0x44000440, 0x44000444}, {0x00040000, 0x00040000}, {0x40004000, 0x00400044},
+    {0x00400000, 0x00004000}, {0x04000000, 0x00000400}, {0x40000000, 0x00000040}, {0x00000000, 0x00000004},
+    {0x00440000, 0x00044000}, {0x80004000, 0x00040008}, {0x88800000, 0x00000888}, {0x88800400, 0x00400888},
+    {0x88880000, 0x00008888}, {0x40400000, 0x00000404}, {0x00000400, 0x00400000}, {0x40000000, 0x00000004},
+    {0x80400400, 0x00400408}, {0x88000000, 0x00000088}, {0x88840040, 0x04004888}, {0x00040004, 0x40004000},
+    {0x80000000, 0x00000008}, {0x00444000, 0x00044400}, {0x88844400, 0x00444888}, {0x8AA84000, 0x00048AA8},
+    {0x8AA80000, 0x00008AA8}, {0x84448000, 0x00084448}, {0x88448000, 0x00084488}, {0x8888A000, 0x00088888},
+    {0x8848A000, 0x00088888}, {0x884A0000, 0x00008888}, {0x84880000, 0x00048888}, {0x88844000, 0x00444888},
+    {0x04440000, 0x00044400}, {0x88004400, 0x00440088}, {0x88484440, 0x04448488}, {0x84448440, 0x04484448},
+    {0x84AA8000, 0x0008AA48}, {0x844A4800, 0x0084A448}, {0x88444800, 0x00844488}, {0x88844800, 0x00844888},
+    {0x88888800, 0x00888888}, {0x88848800, 0x00888888}, {0x88848000, 0x00088888}, {0x88484440, 0x04448888},
+    {0x88844440, 0x04444888}, {0x00044400, 0x00444000}, {0x88804440, 0x04440888}, {0x88888444, 0x44488888},
+    {0x84448804, 0x40884448}, {0x84444800, 0x00844448}, {0x8444A800, 0x008A4448}, {0x844AA880, 0x088AA448},
+    {0x884AA880, 0x088AA488}, {0x88888880, 0x08888888}, {0x88884800, 0x00888888}, {0x88848840, 0x44888888},
+    {0x88888440, 0x44488888}, {0x88804400, 0x00440888}, {0x11111111, 0x11111111}, {0x11161111, 0x11111611},
+    {0xAAA66111, 0x111166AA}, {0xAAAA1111, 0x11111AAA}, {0xAAAAAD11, 0x1111AAAA}, {0xAAAAA661, 0x116AAAAA},
+    {0xAAAAAD11, 0x1111ADAA}, {0xAADA1111, 0x11111ADA}, {0xDDA66111, 0x111166AD}, {0x11116111, 0x11116111},
+    {0x11166611, 0x11166611}, {0xAAA61111, 0x111116AA}, {0xAAAAA6D1, 0x1611AAAA}, {0xAAAAA666, 0x116AAAAA},
+    {0xAAAAA6D1, 0x1111ADAA}, {0xDDA61111, 0x111116AD}, {0x11D11111, 0x1111D111}, {0x1D661111, 0x111DD611},
+    {0xAAAAA6D1, 0x1111AAAA}, {0xAAAAA6D1, 0x1611ADAA}, {0x111D1111, 0x11111111}, {0x1111D111, 0x1111D111},
+    {0x66111111, 0x111D1166}, {0x66611111, 0x11111666}, {0x66661111, 0x11116666}, {0x66661111, 0x11116D66},
+    {0xD6611111, 0x111116DD}, {0x66111111, 0x11111166}, {0x1111D111, 0x111D1111}, {0x111D1111, 0x1111D111},
+    {0xD1111111, 0x1111111D}, {0x11D11111, 0x111111D1}, {0x661111D1, 0x1D111116}, {0x666111D1, 0x1D111166},
+    {0x66111111, 0x1111111D}, {0x44000400, 0x04440004}, {0x00400440, 0x40004040}, {0x00400400, 0x40004040},
+    {0x44004440, 0x04440004}, {0x00044400, 0x04400044}, {0x40400040, 0x40040400}, {0x40400000, 0x40040400},
+    {0x40040000, 0x40040400}, {0x40004000, 0x40040400}, {0x40000400, 0x40040400}, {0x00444440, 0x04400044},
+    {0x00000000, 0x00003333}, {0x30000000, 0x00000333}, {0x30990000, 0x00009933}, {0x36690000, 0x00099993},
+    {0x99666000, 0x00399999}, {0x00600600, 0x00600600}, {0x66699600, 0x00699666}, {0x66666000, 0x00066666},
+    {0x66600000, 0x00000666}, {0x69660000, 0x00006696}, {0x96660060, 0x06006669}, {0x66630666, 0x66603666},
+    {0x66636666, 0x66663666}, {0x66336666, 0x66663366}, {0x33366666, 0x66666333}, {0x99366660, 0x06666339},
+    {0x33666000, 0x00066633}, {0x00666600, 0x00666600}, {0x00606660, 0x06660600}, {0x00600600, 0x00699600},
+    {0x99660000, 0x00006699}, {0x99660060, 0x06006699}, {0x96630666, 0x66603669}, {0x00000990, 0x00000000},
+    {0x00009909, 0x00000000}, {0x00009999, 0x00000000}, {0x00006999, 0x00000000}, {0x00006069, 0x00000000},
+    {0x00000060, 0x00000000}, {0x00606099, 0x00000000}, {0x09999999, 0x00000000}, {0x00000600, 0x00000000},
+    {0x00000066, 0x00000000}, {0x00000000, 0x00009999}, {0x90000000, 0x00006999}, {0x99000000, 0x00006069},
+    {0x99996600, 0x00000060}, {0x69996600, 0x00000000}, {0x60999999, 0x00000000}, {0x00099669, 0x00000000},
+    {0x60099699, 0x00000060}, {0x69999993, 0x00606099}, {0x99999999, 0x09999999}, {0x00609999, 0x00000060},
+    {0x06000999, 0x00000600}, {0x00666660, 0x00000066}, {0x000000B0, 0x00000000}, {0x000000B0, 0x0B000B00},
+    {0x0C000BB0, 0xBBBBBBB0}, {0xBBBDBB00, 0xBBCBBDBB}, {0xDBBB0000, 0xBBDBBBBB}, {0x000000DD, 0xBBBBBBCB},
+    {0x00DDDD00, 0x00000000}, {0xDDDDD000, 0x00000000}, {0x00000000, 0xDDDD0000}, {0x00000000, 0x00B0000B},
+    {0xB0000B00, 0x0BDB00BB}, {0xBBBBBBB0, 0xBBBBBBBB}, {0xDBBBBBBB, 0xBBCBBBBB}, {0xBBBBCDBB, 0xBBBBBBCB},
+    {0xBBBBBBBB, 0xBBBBBDBB}, {0xBBBBBBCD, 0xBB0BBBBB}, {0xBBDC0000, 0x00000000}, {0xCBBB0DDD, 0xB0DD00D0},
+    {0x0BBBB000, 0xBB000D00}, {0xDDDD0000, 0xDD0000DD}, {0x00000000, 0x00000BB0}, {0x00000000, 0x0000BB0B},
+    {0x00000000, 0x0000BBBB}, {0xB0000000, 0x0000DBBB}, {0xBB000000, 0x0000D0DB}, {0xBBBBDD00, 0x000000D0},
+    {0xDBBBDD00, 0x00000000}, {0xD0BBBBBB, 0x00000000}, {0x000BBDDB, 0x00000000}, {0xD00BBDBB, 0x000000D0},
+    {0xDBBBBBBC, 0x00D0D0BB}, {0x0000BBBB, 0x00000000}, {0x00D0BBBB, 0x000000D0}, {0x0D000BBB, 0x00000D00},
+    {0x00DDDDD0, 0x000000DD}, {0x00BBDD00, 0x00000000}, {0xBBBBDDBB, 0x0BB00000}, {0xBBBBBBBB, 0x0B0BBBBB},
+    {0xDDBBBBCB, 0x0BBBBBBB}, {0xBBBBBBBC, 0x0DDDDDDD}, {0x00000000, 0x000BBB00}, {0x00000000, 0x00BDDBB0},
+    {0x00000000, 0xDBBBBBBB}, {0x00000000, 0xBBBBBBBB}, {0xB0000000, 0x0BBBBBDD}, {0xBBB00000, 0x000BDDBB},
+    {0xBBBBBBB0, 0x00D0BBBB}, {0xD00000DD, 0x0D000DDD}, {0x00DDD000, 0x00D00000}, {0x00000000, 0x000DDD00},
+    {0x0000DDD0, 0x00000000}, {0x00000000, 0x0BBBBBB0}, {0x00000000, 0x0BBBBBBB}, {0x00000000, 0x00D0DBBB},
+    {0xB0000000, 0x0000BBBB}, {0xBBB00000, 0x000BBBBB}, {0xBBBBB0DD, 0x0000BBBB}, {0xBBBBBB00, 0x0000BBBB},
+    {0xBBBBBBB0, 0x0000BDBB}, {0xDBBBBBBD, 0x000DDBDB}, {0x00DDDD00, 0x000D0000}, {0xD0000000, 0x0D00DDDD},
+    {0x00DDDDD0, 0x00D00000}, {0xDDD00000, 0x0000000D}, {0x55700000, 0x00000000}, {0x55550000, 0x00000005},
+    {0x55555000, 0x00000055}, {0x55000000, 0x00000055}, {0x55700000, 0x00000535}, {0x55570000, 0x00000555},
+    {0x00057000, 0x00005550}, {0x00000700, 0x50055350}, {0x00000000, 0x35555500}, {0x00000000, 0x55535000},
+    {0x00000000, 0x53550000}, {0x00055555, 0x00000000}, {0x00535535, 0x00000000}, {0x05550055, 0x00500000},
+    {0x53500005, 0x00030000}, {0x55000000, 0x00005535}, {0x05570000, 0x00000000}, {0x55555000, 0x00000000},
+    {0x55555500, 0x00000005}, {0x55500000, 0x00000055}, {0x35577700, 0x00000555}, {0x50555000, 0x50055555},
+    {0x00000000, 0x53555535}, {0x00000000, 0x55553500}, {0x00000000, 0x55550000}, {0x55355000, 0x00000000},
+    {0x35555355, 0x00000055}, {0x00005555, 0x00003550}, {0x00000055, 0x00055000}, {0x00000000, 0x00500000},
+    {0x00557000, 0x00000000}, {0x05555500, 0x35500000}, {0x55555550, 0x55555000}, {0x53550000, 0x00355555},
+    {0x55555500, 0x00055355}, {0x55000000, 0x00000553}, {0x00000005, 0x00535000}, {0x00000055, 0x00005530},
+    {0x50005535, 0x00000055}, {0x55553550, 0x00000000}, {0x03555000, 0x00000000}, {0xBB111111, 0xBB1BBBBB},
+    {0xBBBB1111, 0xBBBBBDBB}, {0xDDBB1111, 0xBBBBBBBB}, {0xBBBBB111, 0xBBBBBBBB}, {0xBBBBB111, 0xDDBBBBBB},
+    {0xBDDBB111, 0xBBBBDBBB}, {0xBBBBB111, 0xBBBBDBBB}, {0xBBBB1111, 0xCCDC1BBB}, {0x1C111111, 0xCCCCCCCC},
+    {0xBBB11111, 0xCCCC1CCC}, {0xBBBBB1BB, 0xBBB1BBBB}, {0xBBBBBBBD, 0xBBBBBBBB}, {0xBBBBBBBB, 0xBBBBBDDB},
+    {0xBBDBBBBB, 0xBDBBBBBB}, {0xBBBBBBBB, 0xBBBBBBBB}, {0xBBBBBDBB, 0xBBBBBBBB}, {0xBBBBBBBB, 0xBBBDDDBB},
+    {0xCCCCCCCC, 0xCBBBBBBC}, {0xCDDDCCCC, 0xCCCCCCCC}, {0xCCCC1CCC, 0xCCCC1CCC}, {0xBBBBB1BB, 0x11111DDD},
+    {0xDBBDBBBB, 0x1111DDDD}, {0xDBBBBBBB, 0x1111DBBB}, {0xDBBBBBBB, 0x111DDBBB}, {0xBDBBBBBB, 0x111DBBBB},
+    {0xBDBBBBBB, 0x111DBBDB}, {0xDDDBDDBB, 0x111DDBDB}, {0xDCCCCCCC, 0x1111DBBB}, {0xDCCCCCCC, 0x1111DDBB},
+    {0xCCC1CCCC, 0x11111DDB}, {0x66666600, 0x66666666}, {0x66666670, 0x66666666}, {0x44666670, 0x04444444},
+    {0x00666670, 0x00000000}, {0x66666670, 0x00666666}, {0x44666670, 0x00064444}, {0x00044440, 0x00000000},
+    {0x66666600, 0x00666666}, {0x44666670, 0x66667444}, {0x00666670, 0x66667000}, {0x00666670, 0x66666600},
+    {0x00666670, 0x66666670}, {0x66666670, 0x04446666}, {0x66666670, 0x00006666}, {0x44666670, 0x66666674},
+    {0x00044440, 0x04444440}, {0x66660000, 0x00666666}, {0x66667000, 0x00666666}, {0x44666600, 0x66667444},
+    {0x66667440, 0x04666666}, {0x44444000, 0x00044444}, {0x66000000, 0x66666666}, {0x66700000, 0x66666666},
+    {0x66660000, 0x04444444}, {0x66667000, 0x00000000}, {0x04666600, 0x00000000}, {0x00666670, 0x66667440},
+    {0x66667440, 0x66667000}, {0x66667000, 0x66667000}, {0x66744000, 0x66666666}, {0x44400000, 0x04444444},
+    {0x66660000, 0x66666666}, {0x66667000, 0x66666666}, {0x66667000, 0x04444444}, {0x66667000, 0x00044444},
+    {0x16666661, 0x66661666}, {0x66691666, 0x99166666}, {0x66916616, 0x61669916}, {0x66666666, 0x66666166},
+    {0x66699161, 0x66666666}, {0x99661666, 0x16999169}, {0x19966661, 0x91919919}, {0x11966666, 0x11111111},
+    {0x66661666, 0x16661666}, {0x99166666, 0x66166666}, {0x61669916, 0x61669916}, {0x66666166, 0x66666166},
+    {0x66666666, 0x69916666}, {0x16999169, 0x66166699}, {0x91919919, 0x16666991}, {0x16666661, 0x16666661},
+    {0x66666666, 0x66666666}, {0x66669916, 0x66669916}, {0x16666166, 0x16666166}, {0x69916616, 0x69916616},
+    {0x19166666, 0x11111111}, {0x11666991, 0x11111111}, {0x19966616, 0x11111111}, {0x11969916, 0x11111111},
+    {0x19166166, 0x11111111}, {0x11666666, 0x11111111}, {0x19966661, 0x11111111}, {0x11666661, 0x11111111},
+    {0x19966666, 0x11111111}, {0x11916999, 0x11111111}, {0x11116999, 0x11111111}, {0x11111111, 0x66916611},
+    {0x11111111, 0x69166191}, {0x11111111, 0x99966991}, {0x11111111, 0x61666611}, {0x11111111, 0x69916991},
+    {0x11111111, 0x66166911}, {0x11111111, 0x99169911}, {0x11111111, 0x11919111}, {0x66661666, 0x66661666},
+    {0x99166666, 0x99166666}, {0x16999169, 0x16999169}, {0x91919919, 0x91919919}, {0x00880080, 0x00088008},
+    {0x88888888, 0x88888808}, {0x28888288, 0x88288888}, {0xA2882A28, 0x82A28882}, {0x88888888, 0x8888828A},
+    {0x88882888, 0x88882A2A}, {0x2882A288, 0x8888828A}, {0xA2882888, 0x88888882}, {0x28888888, 0x88828888},
+    {0x88888828, 0x882A288A}, {0x888882A2, 0x88828880}, {0x28828828, 0x8888882A}, {0x882A2888, 0x88888882},
+    {0x88828888, 0x88888888}, {0x80088288, 0x00000800}, {0x44444400, 0x44444400}, {0x00440000, 0x00440000},
+    {0x00440000, 0x44444400}, {0x44000440, 0x44444400}, {0x44404440, 0x00004400}, {0x44444440, 0x00004400},
+    {0x44444440, 0x04444400}, {0x44040440, 0x00004400}, {0x44000440, 0x00004400},
+};
+
+static const uint8_t row_mask[491][2] = {
+    {0x00, 0x00}, {0x08, 0x10}, {0xCC, 0x33}, {0xE8, 0x17}, {0xE8, 0x17}, {0xF0, 0x0F}, {0xE0, 0x07}, {0xE0, 0x07},
+    {0xF0, 0x0F}, {0x18, 0x18}, {0x0C, 0x30}, {0x10, 0x08}, {0xD8, 0x1B}, {0xF0, 0x0F}, {0x30, 0x0C}, {0x20, 0x04},
+    {0x40, 0x02}, {0xC8, 0x13}, {0xEC, 0x37}, {0xF8, 0x1F}, {0xF8, 0x1F}, {0xE8, 0x17}, {0xCC, 0x33}, {0x00, 0xF8},
+    {0xF8, 0xF8}, {0x20, 0x20}, {0xF8, 0x7F}, {0xFD, 0xFF}, {0xFE, 0xFF}, {0xFE, 0x70}, {0xFE, 0x30}, {0x44, 0x7E},
+    {0xFC, 0x33}, {0xFE, 0x73}, {0xFE, 0x33}, {0xFE, 0x30}, {0xFE, 0x70}, {0xC0, 0x79}, {0xF0, 0xFD}, {0xF8, 0xFD},
+    {0xF8, 0xFF}, {0xC0, 0x39}, {0x00, 0x1C}, {0xFF, 0x3F}, {0x30, 0x38}, {0xFC, 0x7C}, {0xFE, 0xFF}, {0xFE, 0x7F},
+    {0xFE, 0x7F}, {0x3E, 0x00}, {0x3E, 0x3E}, {0x08, 0x08}, {0xFE, 0x3F}, {0xFF, 0x7F}, {0xDC, 0xFF}, {0xFE, 0xFF},
+    {0x08, 0x10}, {0xCC, 0x33}, {0xE8, 0x17}, {0xE8, 0x17}, {0xF0, 0x0F}, {0xE0, 0x07}, {0xE0, 0x07}, {0xF0, 0x0F},
+    {0x18, 0x18}, {0x0C, 0x30}, {0x10, 0x08}, {0xD8, 0x1B}, {0xF0, 0x0F}, {0x30, 0x0C}, {0x20, 0x04}, {0x40, 0x02},
+    {0xC8, 0x13}, {0xEC, 0x37}, {0xF8, 0x1F}, {0xF8, 0x1F}, {0xE8, 0x17}, {0xCC, 0x33}, {0x08, 0x10}, {0xCC, 0x33},
+    {0xE8, 0x17}, {0xE8, 0x17}, {0xF0, 0x0F}, {0xE0, 0x07}, {0xE0, 0x07}, {0xF0, 0x0F}, {0x18, 0x18}, {0x0C, 0x30},
+    {0x10, 0x08}, {0xD8, 0x1B}, {0xF0, 0x0F}, {0x30, 0x0C}, {0x20, 0x04}, {0x40, 0x02}, {0xC8, 0x13}, {0xEC, 0x37},
+    {0xF8, 0x1F}, {0xF8, 0x1F}, {0xE8, 0x17}, {0xCC, 0x33}, {0xC0, 0x07}, {0xE0, 0x0F}, {0xB0, 0x1B}, {0xD0, 0x17},
+    {0xF6, 0xDF}, {0xC6, 0xC7}, {0x10, 0x10}, {0x88, 0x23}, {0x20, 0x08}, {0x40, 0x04}, {0x80, 0x02}, {0x00, 0x01},
+    {0x30, 0x18}, {0x88, 0x11}, {0xE0, 0x07}, {0xE4, 0x27}, {0xF0, 0x0F}, {0xA0, 0x05}, {0x04, 0x20}, {0x80, 0x01},
+    {0xA4, 0x25}, {0xC0, 0x03}, {0xF2, 0x4F}, {0x11, 0x88}, {0x80, 0x01}, {0x38, 0x1C}, {0xFC, 0x3F}, {0xF8, 0x1F},
+    {0xF0, 0x0F}, {0xF8, 0x1F}, {0xF8, 0x1F}, {0xF8, 0x1F}, {0xF8, 0x1F}, {0xF0, 0x0F}, {0xF0, 0x1F}, {0xF8, 0x3F},
+    {0x70, 0x1C}, {0xCC, 0x33}, {0xFE, 0x7F}, {0xFE, 0x7F}, {0xF8, 0x1F}, {0xFC, 0x3F}, {0xFC, 0x3F}, {0xFC, 0x3F},
+    {0xFC, 0x3F}, {0xFC, 0x3F}, {0xF8, 0x1F}, {0xFE, 0x7F}, {0xFE, 0x7F}, {0x1C, 0x38}, {0xEE, 0x77}, {0xFF, 0xFF},
+    {0xFD, 0xBF}, {0xFC, 0x3F}, {0xFC, 0x3F}, {0xFE, 0x7F}, {0xFE, 0x7F}, {0xFE, 0x7F}, {0xFC, 0x3F}, {0xFE, 0xFF},
+    {0xFE, 0xFF}, {0xEC, 0x37}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xC4, 0x71}, {0x26, 0x8A}, {0x24, 0x8A},
+    {0xCE, 0x71}, {0x1C, 0x63}, {0xA2, 0x94}, {0xA0, 0x94}, {0x90, 0x94}, {0x88, 0x94}, {0x84, 0x94}, {0x3E, 0x63},
+    {0x00, 0x0F}, {0x80, 0x07}, {0xB0, 0x0F}, {0xF0, 0x1F}, {0xF8, 0x3F}, {0x24, 0x24}, {0xFC, 0x3F}, {0xF8, 0x1F},
+    {0xE0, 0x07}, {0xF0, 0x0F}, {0xF2, 0x4F}, {0xF7, 0xEF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFE, 0x7F},
+    {0xF8, 0x1F}, {0x3C, 0x3C}, {0x2E, 0x74}, {0x24, 0x3C}, {0xF0, 0x0F}, {0xF2, 0x4F}, {0xF7, 0xEF}, {0x06, 0x00},
+    {0x0D, 0x00}, {0x0F, 0x00}, {0x0F, 0x00}, {0x0B, 0x00}, {0x02, 0x00}, {0x2B, 0x00}, {0x7F, 0x00}, {0x04, 0x00},
+    {0x03, 0x00}, {0x00, 0x0F}, {0x80, 0x0F}, {0xC0, 0x0B}, {0xFC, 0x02}, {0xFC, 0x00}, {0xBF, 0x00}, {0x1F, 0x00},
+    {0x9F, 0x02}, {0xFF, 0x2B}, {0xFF, 0x7F}, {0x2F, 0x02}, {0x47, 0x04}, {0x3E, 0x03}, {0x02, 0x00}, {0x02, 0x44},
+    {0x46, 0xFE}, {0xFC, 0xFF}, {0xF0, 0xFF}, {0x03, 0xFF}, {0x3C, 0x00}, {0xF8, 0x00}, {0x00, 0xF0}, {0x00, 0x21},
+    {0x84, 0x73}, {0xFE, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xDF}, {0xF0, 0x00}, {0xF7, 0xB2},
+    {0x78, 0xC4}, {0xF0, 0xC3}, {0x00, 0x06}, {0x00, 0x0D}, {0x00, 0x0F}, {0x80, 0x0F}, {0xC0, 0x0B}, {0xFC, 0x02},
+    {0xFC, 0x00}, {0xBF, 0x00}, {0x1F, 0x00}, {0x9F, 0x02}, {0xFF, 0x2B}, {0x0F, 0x00}, {0x2F, 0x02}, {0x47, 0x04},
+    {0x3E, 0x03}, {0x3C, 0x00}, {0xFF, 0x60}, {0xFF, 0x5F}, {0xFF, 0x7F}, {0xFF, 0x7F}, {0x00, 0x1C}, {0x00, 0x3E},
+    {0x00, 0xFF}, {0x00, 0xFF}, {0x80, 0x7F}, {0xE0, 0x1F}, {0xFE, 0x2F}, {0x83, 0x47}, {0x38, 0x20}, {0x00, 0x1C},
+    {0x0E, 0x00}, {0x00, 0x7E}, {0x00, 0x7F}, {0x00, 0x2F}, {0x80, 0x0F}, {0xE0, 0x1F}, {0xFB, 0x0F}, {0xFC, 0x0F},
+    {0xFE, 0x0F}, {0xFF, 0x1F}, {0x3C, 0x10}, {0x80, 0x4F}, {0x3E, 0x20}, {0xE0, 0x01}, {0xE0, 0x00}, {0xF0, 0x01},
+    {0xF8, 0x03}, {0xC0, 0x03}, {0xE0, 0x07}, {0xF0, 0x07}, {0x18, 0x0E}, {0x04, 0x9E}, {0x00, 0xFC}, {0x00, 0xF8},
+    {0x00, 0xF0}, {0x1F, 0x00}, {0x3F, 0x00}, {0x73, 0x20}, {0xE1, 0x10}, {0xC0, 0x0F}, {0x70, 0x00}, {0xF8, 0x00},
+    {0xFC, 0x01}, {0xE0, 0x03}, {0xFC, 0x07}, {0xB8, 0x9F}, {0x00, 0xFF}, {0x00, 0xFC}, {0x00, 0xF0}, {0xF8, 0x00},
+    {0xFF, 0x03}, {0x0F, 0x0E}, {0x03, 0x18}, {0x00, 0x20}, {0x38, 0x00}, {0x7C, 0xE0}, {0xFE, 0xF8}, {0xF0, 0x3F},
+    {0xFC, 0x1F}, {0xC0, 0x07}, {0x01, 0x38}, {0x03, 0x0E}, {0x8F, 0x03}, {0xFE, 0x00}, {0x78, 0x00}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFC, 0xFF}, {0xFE, 0xFF}, {0xFE, 0x7F},
+    {0x3E, 0x00}, {0xFE, 0x3F}, {0xFE, 0x1F}, {0x1E, 0x00}, {0xFC, 0x3F}, {0xFE, 0xFF}, {0x3E, 0xF8}, {0x3E, 0xFC},
+    {0x3E, 0xFE}, {0xFE, 0x7F}, {0xFE, 0x0F}, {0xFE, 0xFF}, {0x1E, 0x7E}, {0xF0, 0x3F}, {0xF8, 0x3F}, {0xFC, 0xFF},
+    {0xFE, 0x7F}, {0xF8, 0x1F}, {0xC0, 0xFF}, {0xE0, 0xFF}, {0xF0, 0x7F}, {0xF8, 0x00}, {0x7C, 0x00}, {0x3E, 0xFE},
+    {0xFE, 0xF8}, {0xF8, 0xF8}, {0xF8, 0xFF}, {0xE0, 0x7F}, {0xF0, 0xFF}, {0xF8, 0xFF}, {0xF8, 0x7F}, {0xF8, 0x1F},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0x32, 0x19}, {0xFF, 0xFD}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFF}, {0xFF, 0xFE}, {0xFF, 0xFF}, {0xFF, 0xFF},
+    {0xFF, 0xFF}, {0x9F, 0x04}, {0xFC, 0xFC}, {0x30, 0x30}, {0x30, 0xFC}, {0xC6, 0xFC}, {0xEE, 0x0C}, {0xFE, 0x0C},
+    {0xFE, 0x7C}, {0xD6, 0x0C}, {0xC6, 0x0C},
+};
+
+static const uint16_t sprite_rows[54][16] = {
+    /*  0 */ {0, 0, 2, 4, 6, 8, 10, 12, 12, 14, 16, 18, 2, 20, 2, 0},
+    /*  1 */ {0, 0, 22, 24, 26, 16, 10, 12, 12, 14, 16, 18, 28, 30, 32, 32},
+    /*  2 */ {0, 0, 0, 34, 36, 8, 38, 12, 40, 42, 44, 2, 0, 0, 0, 0},
+    /*  3 */ {0, 46, 48, 48, 50, 52, 54, 56, 56, 54, 52, 50, 48, 48, 46, 0},
+    /*  4 */ {0, 0, 58, 60, 62, 64, 66, 68, 68, 66, 64, 62, 70, 72, 0, 0},
+    /*  5 */ {0, 0, 0, 74, 76, 78, 80, 80, 80, 80, 78, 76, 82, 0, 0, 0},
+    /*  6 */ {0, 0, 0, 84, 86, 86, 86, 86, 86, 86, 86, 86, 84, 0, 0, 0},
+    /*  7 */ {0, 0, 0, 88, 90, 92, 94, 96, 96, 94, 92, 90, 88, 0, 0, 0},
+    /*  8 */ {0, 98, 100, 100, 102, 104, 106, 108, 110, 106, 104, 102, 100, 100, 98, 0},
+    /*  9 */ {0, 0, 112, 114, 116, 118, 120, 122, 122, 124, 126, 128, 112, 130, 112, 0},
+    /* 10 */ {0, 0, 132, 134, 136, 126, 120, 122, 122, 124, 126, 128, 138, 140, 142, 142},
+    /* 11 */ {0, 0, 0, 144, 146, 118, 148, 122, 150, 152, 154, 112, 0, 0, 0, 0},
+    /* 12 */ {0, 0, 156, 158, 160, 162, 164, 166, 166, 168, 170, 172, 156, 174, 156, 0},
+    /* 13 */ {0, 0, 176, 178, 180, 170, 164, 166, 166, 168, 170, 172, 182, 184, 186, 186},
+    /* 14 */ {0, 0, 0, 188, 190, 162, 192, 166, 194, 196, 198, 156, 0, 0, 0, 0},
+    /* 15 */ {200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222, 220, 218, 224, 224},
+    /* 16 */ {0, 0, 186, 176, 226, 228, 230, 232, 232, 230, 228, 226, 176, 186, 0, 0},
+    /* 17 */ {0, 234, 156, 236, 238, 240, 242, 244, 244, 242, 240, 238, 236, 156, 234, 0},
+    /* 18 */ {186, 0, 236, 0, 186, 0, 246, 248, 248, 246, 0, 186, 0, 236, 0, 186},
+    /* 19 */ {0, 176, 250, 252, 254, 256, 258, 260, 262, 264, 266, 268, 270, 272, 216, 0},
+    /* 20 */ {0, 274, 276, 278, 280, 282, 284, 286, 288, 290, 292, 294, 296, 172, 0, 0},
+    /* 21 */ {298, 300, 302, 304, 306, 308, 310, 312, 314, 314, 316, 316, 318, 320, 322, 298},
+    /* 22 */ {324, 324, 324, 324, 326, 328, 330, 332, 334, 336, 338, 340, 326, 324, 324, 324},
+    /* 23 */ {324, 324, 324, 342, 344, 346, 330, 348, 350, 352, 338, 354, 344, 342, 324, 324},
+    /* 24 */ {324, 324, 324, 356, 358, 346, 330, 360, 350, 362, 338, 354, 358, 356, 324, 324},
+    /* 25 */ {324, 324, 324, 364, 366, 368, 370, 372, 374, 376, 378, 380, 382, 324, 324, 324},
+    /* 26 */ {324, 324, 384, 324, 324, 386, 357, 388, 390, 392, 357, 386, 324, 324, 384, 324},
+    /* 27 */ {0, 0, 0, 0, 394, 396, 398, 398, 398, 398, 400, 0, 0, 0, 0, 0},
+    /* 28 */ {0, 0, 0, 0, 402, 404, 406, 408, 410, 412, 414, 0, 0, 0, 0, 0},
+    /* 29 */ {0, 0, 0, 0, 416, 418, 420, 422, 424, 422, 420, 418, 416, 0, 0, 0},
+    /* 30 */ {18, 426, 428, 430, 432, 434, 436, 438, 440, 442, 444, 446, 446, 448, 450, 452},
+    /* 31 */ {18, 454, 428, 430, 432, 456, 458, 460, 440, 442, 444, 446, 446, 448, 450, 452},
+    /* 32 */ {462, 464, 466, 468, 470, 472, 0, 0, 0, 472, 474, 476, 0, 472, 478, 480},
+    /* 33 */ {0, 0, 482, 484, 486, 488, 490, 492, 494, 496, 498, 500, 466, 502, 504, 506},
+    /* 34 */ {0, 0, 0, 0, 0, 0, 508, 510, 512, 514, 516, 518, 520, 521, 522, 524},
+    /* 35 */ {0, 0, 0, 0, 0, 526, 528, 530, 532, 534, 536, 538, 540, 542, 544, 546},
+    /* 36 */ {548, 550, 552, 554, 556, 558, 560, 562, 564, 566, 568, 531, 570, 572, 574, 576},
+    /* 37 */ {0, 0, 0, 0, 0, 0, 578, 580, 582, 584, 586, 531, 570, 572, 574, 576},
+    /* 38 */ {0, 0, 0, 0, 0, 588, 590, 592, 594, 596, 598, 600, 602, 604, 606, 608},
+    /* 39 */ {588, 590, 610, 612, 614, 616, 618, 620, 622, 624, 626, 628, 630, 632, 606, 634},
+    /* 40 */ {0, 0, 636, 638, 640, 642, 644, 646, 648, 650, 652, 654, 656, 0, 0, 0},
+    /* 41 */ {0, 0, 0, 0, 0, 0, 0, 0, 658, 660, 662, 664, 666, 0, 0, 0},
+    /* 42 */ {0, 0, 0, 0, 668, 670, 672, 674, 676, 678, 680, 682, 684, 0, 0, 0},
+    /* 43 */ {0, 0, 0, 0, 0, 0, 0, 0, 686, 688, 690, 692, 694, 0, 0, 0},
+    /* 44 */ {0, 0, 0, 0, 0, 0, 0, 696, 698, 700, 702, 704, 706, 0, 0, 0},
+    /* 45 */ {0, 0, 0, 0, 0, 0, 0, 0, 708, 710, 712, 714, 716, 0, 0, 0},
+    /* 46 */ {324, 324, 324, 718, 720, 722, 724, 726, 728, 730, 732, 734, 736, 324, 324, 324},
+    /* 47 */ {324, 324, 324, 738, 740, 742, 744, 746, 748, 750, 752, 754, 756, 324, 324, 324},
+    /* 48 */ {324, 324, 324, 758, 760, 762, 764, 766, 768, 770, 772, 774, 776, 324, 324, 324},
+    /* 49 */ {778, 780, 782, 784, 784, 784, 786, 786, 788, 784, 784, 784, 784, 784, 790, 0},
+    /* 50 */ {792, 780, 794, 796, 796, 796, 798, 800, 802, 804, 786, 786, 806, 800, 808, 0},
+    /* 51 */ {810, 812, 814, 796, 796, 796, 796, 796, 796, 796, 796, 796, 816, 812, 818, 0},
+    /* 52 */ {820, 822, 824, 826, 828, 784, 798, 800, 830, 796, 832, 834, 836, 822, 838, 0},
+    /* 53 */ {840, 842, 844, 826, 826, 826, 812, 812, 846, 826, 826, 826, 842, 842, 52, 0},
+};
+
+static const uint16_t tile_rows[11][16] = {
+    /*  0 */ {324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 324},
+    /*  1 */ {324, 324, 324, 324, 324, 324, 324, 324, 848, 850, 852, 854, 856, 858, 860, 862},
+    /*  2 */ {324, 324, 324, 324, 324, 324, 324, 324, 864, 866, 868, 870, 872, 874, 876, 863},
+    /*  3 */ {324, 324, 324, 324, 324, 324, 324, 324, 878, 871, 880, 882, 884, 880, 886, 871},
+    /*  4 */ {888, 890, 892, 862, 894, 896, 898, 900, 862, 894, 896, 902, 904, 906, 908, 324},
+    /*  5 */ {905, 910, 912, 863, 863, 914, 916, 889, 863, 918, 920, 903, 889, 922, 924, 324},
+    /*  6 */ {878, 871, 880, 882, 884, 880, 886, 871, 926, 928, 868, 870, 880, 930, 932, 324},
+    /*  7 */ {934, 936, 938, 940, 938, 942, 944, 946, 948, 950, 952, 954, 956, 958, 960, 962},
+    /*  8 */ {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    /*  9 */ {0, 0, 0, 0, 0, 0, 0, 0, 964, 966, 966, 966, 966, 966, 968, 0},
+    /* 10 */ {0, 0, 0, 0, 0, 0, 0, 0, 970, 972, 974, 976, 978, 980, 970, 0},
+};
+
+static const uint32_t glyph_pix[36] = {
+    0x00000000, 0x00EEEE00, 0x0EE00EE0, 0xEE0000EE, 0xEEEEEEEE, 0x0EEEEEEE, 0x0EEEEEE0, 0x000000EE,
+    0x00EEEEEE, 0x0EEE00EE, 0xEEE000EE, 0xEEEE00EE, 0x000EE000, 0xEE000000, 0x0EE000EE, 0x00EE00EE,
+    0x000EE0EE, 0x0000EEEE, 0xEEE00EEE, 0xEE0EE0EE, 0xEE000EEE, 0xEE00EEEE, 0xEEEEEEE0, 0x00EEEEE0,
+    0x0EEEEE00, 0x0EE00000, 0x00EE0000, 0x0000EE00, 0x00000EE0, 0xEE0E00EE, 0xEE00E0EE, 0x000EEE00,
+    0x000EEEE0, 0x0EEE0000, 0x0EEEE000, 0x0EE0EE00,
+};
+
+static const uint8_t glyph_mask[36] = {
+    0x00, 0x3C, 0x66, 0xC3, 0xFF, 0x7F, 0x7E, 0x03, 0x3F, 0x73, 0xE3, 0xF3, 0x18, 0xC0, 0x63, 0x33,
+    0x1B, 0x0F, 0xE7, 0xDB, 0xC7, 0xCF, 0xFE, 0x3E, 0x7C, 0x60, 0x30, 0x0C, 0x06, 0xD3, 0xCB, 0x1C,
+    0x1E, 0x70, 0x78, 0x6C,
+};
+
+static const uint8_t glyph_rows[36][8] = {
+    /*  0 */ {1, 2, 2, 3, 4, 3, 3, 0},
+    /*  1 */ {5, 3, 3, 5, 5, 3, 3, 5},
+    /*  2 */ {6, 3, 7, 7, 7, 7, 3, 6},
+    /*  3 */ {8, 9, 10, 3, 3, 10, 9, 8},
+    /*  4 */ {4, 7, 7, 8, 8, 7, 7, 4},
+    /*  5 */ {4, 7, 7, 8, 8, 7, 7, 7},
+    /*  6 */ {6, 3, 7, 11, 11, 3, 3, 6},
+    /*  7 */ {3, 3, 3, 4, 4, 3, 3, 3},
+    /*  8 */ {4, 12, 12, 12, 12, 12, 12, 4},
+    /*  9 */ {13, 13, 13, 13, 3, 3, 3, 6},
+    /* 10 */ {14, 15, 16, 17, 17, 16, 15, 14},
+    /* 11 */ {7, 7, 7, 7, 7, 7, 7, 4},
+    /* 12 */ {3, 18, 4, 19, 3, 3, 3, 3},
+    /* 13 */ {3, 20, 21, 19, 11, 10, 3, 3},
+    /* 14 */ {6, 3, 3, 3, 3, 3, 3, 6},
+    /* 15 */ {5, 3, 3, 3, 5, 7, 7, 7},
+    /* 16 */ {6, 3, 3, 3, 19, 11, 10, 22},
+    /* 17 */ {5, 3, 3, 3, 5, 16, 15, 14},
+    /* 18 */ {6, 3, 7, 23, 24, 13, 3, 6},
+    /* 19 */ {4, 12, 12, 12, 12, 12, 12, 12},
+    /* 20 */ {3, 3, 3, 3, 3, 3, 3, 6},
+    /* 21 */ {3, 3, 3, 2, 2, 1, 12, 12},
+    /* 22 */ {3, 3, 3, 19, 4, 18, 3, 3},
+    /* 23 */ {3, 2, 1, 12, 12, 1, 2, 3},
+    /* 24 */ {3, 2, 1, 12, 12, 12, 12, 12},
+    /* 25 */ {4, 25, 26, 12, 27, 28, 7, 4},
+    /* 26 */ {6, 3, 10, 29, 30, 20, 3, 6},
+    /* 27 */ {12, 31, 32, 12, 12, 12, 12, 4},
+    /* 28 */ {6, 3, 13, 33, 31, 28, 7, 4},
+    /* 29 */ {6, 3, 13, 34, 34, 13, 3, 6},
+    /* 30 */ {33, 34, 35, 2, 14, 4, 25, 25},
+    /* 31 */ {4, 7, 7, 5, 13, 13, 3, 6},
+    /* 32 */ {6, 3, 7, 5, 3, 3, 3, 6},
+    /* 33 */ {4, 13, 25, 26, 12, 27, 28, 7},
+    /* 34 */ {6, 3, 3, 6, 6, 3, 3, 6},
+    /* 35 */ {6, 3, 3, 3, 22, 13, 3, 6},
+};
+
+static const uint8_t nib_swap[256] = {
+    0x00, 0x10, 0x20, 0x30, 0x40, 0x50, 0x60, 0x70, 0x80, 0x90, 0xA0, 0xB0, 0xC0, 0xD0, 0xE0, 0xF0,
+    0x01, 0x11, 0x21, 0x31, 0x41, 0x51, 0x61, 0x71, 0x81, 0x91, 0xA1, 0xB1, 0xC1, 0xD1, 0xE1, 0xF1,
+    0x02, 0x12, 0x22, 0x32, 0x42, 0x52, 0x62, 0x72, 0x82, 0x92, 0xA2, 0xB2, 0xC2, 0xD2, 0xE2, 0xF2,
+    0x03, 0x13, 0x23, 0x33, 0x43, 0x53, 0x63, 0x73, 0x83, 0x93, 0xA3, 0xB3, 0xC3, 0xD3, 0xE3, 0xF3,
+    0x04, 0x14, 0x24, 0x34, 0x44, 0x54, 0x64, 0x74, 0x84, 0x94, 0xA4, 0xB4, 0xC4, 0xD4, 0xE4, 0xF4,
+    0x05, 0x15, 0x25, 0x35, 0x45, 0x55, 0x65, 0x75, 0x85, 0x95, 0xA5, 0xB5, 0xC5, 0xD5, 0xE5, 0xF5,
+    0x06, 0x16, 0x26, 0x36, 0x46, 0x56, 0x66, 0x76, 0x86, 0x96, 0xA6, 0xB6, 0xC6, 0xD6, 0xE6, 0xF6,
+    0x07, 0x17, 0x27, 0x37, 0x47, 0x57, 0x67, 0x77, 0x87, 0x97, 0xA7, 0xB7, 0xC7, 0xD7, 0xE7, 0xF7,
+    0x08, 0x18, 0x28, 0x38, 0x48, 0x58, 0x68, 0x78, 0x88, 0x98, 0xA8, 0xB8, 0xC8, 0xD8, 0xE8, 0xF8,
+    0x09, 0x19, 0x29, 0x39, 0x49, 0x59, 0x69, 0x79, 0x89, 0x99, 0xA9, 0xB9, 0xC9, 0xD9, 0xE9, 0xF9,
+    0x0A, 0x1A, 0x2A, 0x3A, 0x4A, 0x5A, 0x6A, 0x7A, 0x8A, 0x9A, 0xAA, 0xBA, 0xCA, 0xDA, 0xEA, 0xFA,
+    0x0B, 0x1B, 0x2B, 0x3B, 0x4B, 0x5B, 0x6B, 0x7B, 0x8B, 0x9B, 0xAB, 0xBB, 0xCB, 0xDB, 0xEB, 0xFB,
+    0x0C, 0x1C, 0x2C, 0x3C, 0x4C, 0x5C, 0x6C, 0x7C, 0x8C, 0x9C, 0xAC, 0xBC, 0xCC, 0xDC, 0xEC, 0xFC,
+    0x0D, 0x1D, 0x2D, 0x3D, 0x4D, 0x5D, 0x6D, 0x7D, 0x8D, 0x9D, 0xAD, 0xBD, 0xCD, 0xDD, 0xED, 0xFD,
+    0x0E, 0x1E, 0x2E, 0x3E, 0x4E, 0x5E, 0x6E, 0x7E, 0x8E, 0x9E, 0xAE, 0xBE, 0xCE, 0xDE, 0xEE, 0xFE,
+    0x0F, 0x1F, 0x2F, 0x3F, 0x4F, 0x5F, 0x6F, 0x7F, 0x8F, 0x9F, 0xAF, 0xBF, 0xCF, 0xDF, 0xEF, 0xFF,
+};
+
+static const uint8_t bit_rev[256] = {
+    0x00, 0x80, 0x40, 0xC0, 0x20, 0xA0, 0x60, 0xE0, 0x10, 0x90, 0x50, 0xD0, 0x30, 0xB0, 0x70, 0xF0,
+    0x08, 0x88, 0x48, 0xC8, 0x28, 0xA8, 0x68, 0xE8, 0x18, 0x98, 0x58, 0xD8, 0x38, 0xB8, 0x78, 0xF8,
+    0x04, 0x84, 0x44, 0xC4, 0x24, 0xA4, 0x64, 0xE4, 0x14, 0x94, 0x54, 0xD4, 0x34, 0xB4, 0x74, 0xF4,
+    0x0C, 0x8C, 0x4C, 0xCC, 0x2C, 0xAC, 0x6C, 0xEC, 0x1C, 0x9C, 0x5C, 0xDC, 0x3C, 0xBC, 0x7C, 0xFC,
+    0x02, 0x82, 0x42, 0xC2, 0x22, 0xA2, 0x62, 0xE2, 0x12, 0x92, 0x52, 0xD2, 0x32, 0xB2, 0x72, 0xF2,
+    0x0A, 0x8A, 0x4A, 0xCA, 0x2A, 0xAA, 0x6A, 0xEA, 0x1A, 0x9A, 0x5A, 0xDA, 0x3A, 0xBA, 0x7A, 0xFA,
+    0x06, 0x86, 0x46, 0xC6, 0x26, 0xA6, 0x66, 0xE6, 0x16, 0x96, 0x56, 0xD6, 0x36, 0xB6, 0x76, 0xF6,
+    0x0E, 0x8E, 0x4E, 0xCE, 0x2E, 0xAE, 0x6E, 0xEE, 0x1E, 0x9E, 0x5E, 0xDE, 0x3E, 0xBE, 0x7E, 0xFE,
+    0x01, 0x81, 0x41, 0xC1, 0x21, 0xA1, 0x61, 0xE1, 0x11, 0x91, 0x51, 0xD1, 0x31, 0xB1, 0x71, 0xF1,
+    0x09, 0x89, 0x49, 0xC9, 0x29, 0xA9, 0x69, 0xE9, 0x19, 0x99, 0x59, 0xD9, 0x39, 0xB9, 0x79, 0xF9,
+    0x05, 0x85, 0x45, 0xC5, 0x25, 0xA5, 0x65, 0xE5, 0x15, 0x95, 0x55, 0xD5, 0x35, 0xB5, 0x75, 0xF5,
+    0x0D, 0x8D, 0x4D, 0xCD, 0x2D, 0xAD, 0x6D, 0xED, 0x1D, 0x9D, 0x5D, 0xDD, 0x3D, 0xBD, 0x7D, 0xFD,
+    0x03, 0x83, 0x43, 0xC3, 0x23, 0xA3, 0x63, 0xE3, 0x13, 0x93, 0x53, 0xD3, 0x33, 0xB3, 0x73, 0xF3,
+    0x0B, 0x8B, 0x4B, 0xCB, 0x2B, 0xAB, 0x6B, 0xEB, 0x1B, 0x9B, 0x5B, 0xDB, 0x3B, 0xBB, 0x7B, 0xFB,
+    0x07, 0x87, 0x47, 0xC7, 0x27, 0xA7, 0x67, 0xE7, 0x17, 0x97, 0x57, 0xD7, 0x37, 0xB7, 0x77, 0xF7,
+    0x0F, 0x8F, 0x4F, 0xCF, 0x2F, 0xAF, 0x6F, 0xEF, 0x1F, 0x9F, 0x5F, 0xDF, 0x3F, 0xBF, 0x7F, 0xFF,
+};
+
+static const uint8_t bg_map_rows[6][TILES_X] = {
+    { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    { 1,  2,  3,  1,  2,  3,  1,  2,  3,  1,  2,  3,  1,  2},
+    { 4,  5,  6,  4,  5,  6,  4,  5,  6,  4,  5,  6,  4,  5},
+    { 7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7,  7},
+    { 8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8},
+    { 8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  9, 10},
+};
+
+static const uint8_t bg_map_row[TILES_Y] = {0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 4, 4, 4, 4, 3, 5};
+
+static const uint16_t pal_rgb444[16] = {
+    0x000, 0x004, 0x00F, 0x0DF, 0xFF0, 0x9F0, 0x2D0, 0xF0F,
+    0x90F, 0xF40, 0xF00, 0xD64, 0x964, 0xDDF, 0xFFF, 0x000,
+};
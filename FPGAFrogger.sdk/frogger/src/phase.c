@@ -0,0 +1,121 @@
+// Phase timing of the game loop, see phase.h.
+//
+// phase_mark() is one counter read and a subtraction, so the markers can
+// stay in the release build: about a dozen per frame cost a few hundred
+// cycles of the 1.25 M a 60 Hz frame has. All arithmetic of the statistics
+// is done in phase_frame(), the divides only in phase_dump().
+#include "phase.h"
+#include "fmt.h"
+#include "hal.h"
+#include "opcount.h"
+
+static const char *const phase_name[NUM_PHASES] = {
+    "wait_ready", "input", "lanes", "collide", "background",
+    "sprites", "hud", "flush", "wait_vsync", "pause",
+};
+
+struct phase_stat {
+    uint32_t n;         // frames the phase ran in
+    uint32_t min, max;  // cycles in one frame
+    uint64_t total;
+};
+
+static struct phase_stat stats[NUM_PHASES + 1];   // + whole frames
+static uint32_t hist[PHASE_BINS];
+
+static uint32_t acc[NUM_PHASES];   // cycles of the running frame
+static uint32_t ran;               // bit p: phase p ran in this frame
+static uint32_t t_mark, t_frame;   // counter at the last mark / frame start
+static int cur = -1;               // running phase, -1 before the first frame
+
+static void add(struct phase_stat *s, uint32_t cycles) {
+    if (!s->n || cycles < s->min)
+        s->min = cycles;
+    if (cycles > s->max)
+        s->max = cycles;
+    s->total += cycles;
+    s->n++;
+}
+
+void phase_reset(void) {
+    for (int p = 0; p <= NUM_PHASES; ++p) {
+        stats[p].n = stats[p].min = stats[p].max = 0;
+        stats[p].total = 0;
+    }
+    for (int b = 0; b < PHASE_BINS; ++b)
+        hist[b] = 0;
+    cur = -1;
+}
+
+void phase_mark(int p) {
+    uint32_t now = hal_cycles();
+
+    if (cur >= 0) {
+        acc[cur] += now - t_mark;
+        ran |= 1u << cur;
+    }
+    t_mark = now;
+    cur = p;
+}
+
+void phase_frame(int p) {
+    int first = cur < 0;
+
+    phase_mark(p);
+    if (!first) {
+        for (int q = 0; q < NUM_PHASES; ++q)
+            if (ran & (1u << q))
+                add(&stats[q], acc[q]);
+
+        uint32_t cycles = t_mark - t_frame;
+        uint32_t bin = cycles >> PHASE_BIN_SHIFT;
+        add(&stats[NUM_PHASES], cycles);
+        hist[bin < PHASE_BINS ? bin : PHASE_BINS - 1]++;
+    }
+    for (int q = 0; q < NUM_PHASES; ++q)
+        acc[q] = 0;
+    ran = 0;
+    t_frame = t_mark;
+}
+
+static void print_stat(const char *name, const struct phase_stat *s) {
+    char line[64], *e = put_str(line, name, 12);
+
+    e = put_u32(e, s->n, 8);
+    e = put_u32(e, s->min, 11);
+    e = put_u32(e, s->n ? (uint32_t)OP_DIV(s->total, s->n) : 0, 11);
+    e = put_u32(e, s->max, 11);
+    *e++ = '\n';
+    *e = 0;
+    hal_print(line);
+}
+
+// "pNN < x" with the upper edge x of the bin that holds the pct-th
+// percentile frame, "pNN >= x" when that is the open-ended last bin
+static char *put_pct(char *s, uint32_t pct) {
+    uint32_t need = OP_DIV(stats[NUM_PHASES].n * pct + 99, 100u), seen = 0;
+    int b = 0;
+
+    while (b < PHASE_BINS - 1 && (seen += hist[b]) < need)
+        ++b;
+    s = put_str(s, "  p", 0);
+    s = put_u32(s, pct, 0);
+    if (b == PHASE_BINS - 1)
+        return put_u32(put_str(s, " >=", 0), (uint32_t)b << PHASE_BIN_SHIFT, 9);
+    return put_u32(put_str(s, " <", 0), (uint32_t)(b + 1) << PHASE_BIN_SHIFT, 10);
+}
+
+void phase_dump(void) {
+    char line[64], *e = put_str(line, "frame", 5);
+
+    hal_print("phase         frames     min/cyc     avg/cyc     max/cyc\n");
+    for (int p = 0; p < NUM_PHASES; ++p)
+        print_stat(phase_name[p], &stats[p]);
+    print_stat("frame", &stats[NUM_PHASES]);
+
+    e = put_pct(e, 50);
+    e = put_pct(e, 99);
+    *e++ = '\n';
+    *e = 0;
+    hal_print(line);
+}
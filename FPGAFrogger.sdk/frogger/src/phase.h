@@ -0,0 +1,43 @@
+// Per-phase timing of the game loop from the hal_cycles() counter.
+//
+// The loop calls phase_frame() once per iteration and phase_mark() where one
+// phase hands over to the next; the cycles between two calls are charged to
+// the phase that was running. Each phase keeps the min/avg/max of its cycles
+// per frame over the frames it ran in, and whole frames go into a histogram
+// for the percentiles. phase_dump() prints both to the console.
+//
+// Without the counter (hal_cycles() always 0) everything reads 0.
+#pragma once
+#include <stdint.h>
+
+enum {
+    PHASE_WAIT_READY,   // waiting for a back buffer in begin_frame()
+    PHASE_INPUT,        // keypad scan and frog moves
+    PHASE_LANES,        // animations, lane movement, frog carried on a log
+    PHASE_COLLIDE,      // lily pads, log/turtle and car checks, timer bar
+    PHASE_BACKGROUND,   // render_begin()
+    PHASE_SPRITES,      // lily pads, timer bar, lanes and the frog
+    PHASE_HUD,          // lives, score and the game-over text
+    PHASE_FLUSH,        // render_end()
+    PHASE_WAIT_VSYNC,   // cpu_done high, polled wait in finish_frame()
+    PHASE_PAUSE,        // hal_sleep() after a death
+    NUM_PHASES
+};
+
+// Frame-time histogram: PHASE_BINS bins of 2^PHASE_BIN_SHIFT cycles, the
+// last one open-ended (16384 cycles, 0.22 ms at 75 MHz; the last bin starts
+// at 27.7 ms, well past the 16.7 ms frame)
+#define PHASE_BIN_SHIFT 14
+#define PHASE_BINS 128
+
+// Forget all samples; the next phase_frame() starts the first frame
+void phase_reset(void);
+
+// End the running frame, if any, and start the next one in phase p
+void phase_frame(int p);
+
+// End the running phase and start p
+void phase_mark(int p);
+
+// Print the per-phase min/avg/max and the frame-time percentiles
+void phase_dump(void);
@@ -0,0 +1,1146 @@
+// Framebuffer renderer.
+//
+// With a clearing framebuffer (vga_framebuffer_top CLEAR_BACK = 1) every call
+// is drawn immediately: the background at render_begin(), then each sprite
+// in call order, skipping transparent pixels.
+//
+// When the hardware keeps the back buffer (HAL_FB_KEEP_BACK) the calls are
+// recorded into a display list instead. The back buffer the CPU gets after a
+// swap still holds the frame drawn two frames ago, so render_end() diffs the
+// new list against that one, collects the screen areas of items that were
+// added, removed or changed, and rewrites only the pixels inside them whose
+// colour differs.
+//
+// With the packed write port (HAL_FB_WIDE) consecutive pixels of the same
+// 8-pixel group are collected and sent as one hal_fb_write8(), transparent or
+// unchanged pixels masked off, so a 16-pixel sprite row costs two or three
+// writes instead of up to sixteen.
+//
+// An immediate sprite that lies wholly on screen is drawn by its kernel from
+// sprite_kernels.h (generated by frogger_host/kerngen), which sends the
+// sprite's opaque runs straight to put_run(); the generic loop, which tests
+// every pixel and applies the transform as it goes, is left for clipped
+// sprites and those without a kernel.
+//
+// With span writes (HAL_FB_SPAN) an untransformed immediate sprite is walked
+// span by span in the run-length form of sprite_spans.h instead (generated
+// by frogger_host/spangen), each span of one colour a single hal_fb_span().
+//
+// With the sprite blitter (HAL_FB_BLIT) an immediate sprite is a single
+// hal_fb_blit() command. The display list path keeps composing in RAM: it
+// only rewrites the pixels that changed, which the blitter cannot know.
+// Likewise an immediate render_fill() is one hal_fb_fill() job with the fill
+// engine (HAL_FB_FILL).
+//
+// With the object layer (HAL_FB_OAM) sprites are not drawn at all but
+// collected into OAM entries, which render_end() writes out; the hardware
+// shows them over the frame buffer. A glyph or fill drawn over such a sprite
+// has to cover it, so that sprite (and any earlier one under it) is drawn
+// into the frame buffer after all, as are sprites beyond the 64 entries.
+//
+// With the tile layer (HAL_FB_TILES) the background is not drawn either: the
+// hardware shows the tilemap wherever the frame buffer holds colour 0, and
+// render_end() only writes the tilemap entries that changed. In keep mode the
+// composed background is then 0 as well.
+//
+// With the lane layer (HAL_FB_LANES, on top of the packed port and the tile
+// layer) the sprites of a render_lane() go into the lane buffer of its band
+// instead, at their screen position plus the lane's scroll, modulo the
+// period. The scroll is chosen so the lane's first sprite stays at buffer
+// column 0; as long as the lane moves as a whole and wraps by exactly the
+// period its sprites keep their buffer columns, and a frame only costs the
+// scroll register. render_end() diffs each lane against what its bank holds
+// and rewrites the 8-pixel groups under the sprites that changed.
+//
+// The core has no multiplier or barrel shifter (see opcount.h), so no draw
+// loop multiplies, divides or shifts by a variable amount: a row's address
+// comes from row_base[] and rows are walked by adding their stride.
+//
+// Sprites, tiles and glyphs come from packed_assets.h (generated by
+// frogger_host/packgen) at 4 bits per pixel, each 8-pixel row a word with
+// its opacity mask. With the packed write port a row at a multiple of 8
+// pixels goes out as those words, masked by the opacity, without looking at
+// single pixels: the background always, sprites and glyphs when aligned,
+// horizontally flipped ones through the nibble-swap table. Elsewhere a row
+// is unpacked into one byte per pixel first, two pixels per load.
+//
+// Each distinct row is stored once: an image is a table of row entries,
+// index << 1 | flip, the flip bit set where the stored row is its mirror.
+// A row is drawn mirrored when that bit differs from the FLIP_H of the
+// transform, and entry 0, the empty row, is skipped outright.
+#include "render.h"
+#include "hal.h"
+#include "opcount.h"
+#include "packed_assets.h"
+#include "sprite_spans.h"
+#include <string.h>
+
+#define TILE_W 16
+#define TILE_H 16
+#define GLYPH_W 8
+
+// Packed bytes and opacity masks of a row entry
+#define ENT_BYTES(e) ((const uint8_t *)row_pix[(e) >> 1])
+#define ENT_WORDS(e) (row_pix[(e) >> 1])
+#define ENT_MASK(e) (row_mask[(e) >> 1])
+
+#define MAX_ITEMS 128
+#define MAX_RECTS 32
+#define RESYNC 8     // list entries searched ahead when the lists diverge
+
+enum { IT_SPRITE, IT_GLYPH, IT_FILL };
+
+// For IT_FILL, id/xf hold the width/height
+struct item {
+    int16_t x, y;
+    uint8_t kind, id, xf, c;
+};
+
+struct dlist {
+    struct item it[MAX_ITEMS];
+    int n;
+    int full;    // items were dropped, the list does not describe the frame
+};
+
+struct rect {
+    int16_t x0, y0, x1, y1;   // x1/y1 exclusive
+};
+
+// Linear address of each row, y * FB_W, for the rows a sprite can reach
+// (-16 .. FB_H + 15); negative rows wrap, as uint16_t arithmetic does
+#define ROW_MARGIN 16
+static uint16_t row_base_tab[ROW_MARGIN + FB_H + ROW_MARGIN];
+#define row_base (&row_base_tab[ROW_MARGIN])
+
+#ifdef FROGGER_COUNT_OPS
+// The bench can go back to multiplying, to compare
+int render_row_table = 1;
+#define ROW_BASE(y) (render_row_table ? row_base[y] : (uint16_t)OP_MUL(y, FB_W))
+#else
+#define ROW_BASE(y) row_base[y]
+#endif
+
+static int keep_back, wide, stream, blit, fill, span, obj_layer, tile_layer, lane_layer;
+
+// 8-pixel group collected for the packed write port
+static uint16_t pend_group = 0xFFFF;
+static uint8_t pend[8], pend_mask;
+static const uint8_t bit8[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+static const uint8_t low8[9] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+
+// Lists of the last buffers + 1 frames; lists[cur] is being recorded, the
+// one `buffers` frames back is what the back buffer currently shows
+static struct dlist lists[4];
+static int cur, history, buffers;
+
+static struct rect rects[MAX_RECTS];
+static int num_rects;
+
+static uint8_t new_row[FB_W], old_row[FB_W];
+static uint8_t sel_new[MAX_ITEMS], sel_old[MAX_ITEMS];
+
+// Sprites of this frame in the object layer, in draw order, and the entries
+// last written into each OAM bank; the banks alternate with the buffers
+static struct item objs[HAL_OAM_ENTRIES];
+static int num_objs;
+static uint8_t sunk[HAL_OAM_ENTRIES];
+static uint32_t oam_shadow[2][HAL_OAM_ENTRIES];
+static int bank;    // OAM and tilemap bank of the back buffer
+
+// Background tiles of this frame and, with render_tile() changes, of the
+// next one; the tilemap last written into each bank
+static uint8_t tilemap[TILES_Y][TILES_X], tile_next[TILES_Y][TILES_X];
+static int tiles_changed;
+static uint8_t tile_shadow[2][TILES_Y * TILES_X];
+
+// Sprites of this frame in each lane and what each bank's lane buffers hold
+// (n < 0: unknown); the scroll registers last written into each bank
+#define LANE_ITEMS 24
+
+struct lane_item {
+    int16_t x;   // buffer column
+    uint8_t id, xf;
+};
+
+struct lane {
+    int16_t period, scroll;   // period 0: the band shows no lane
+    int n;
+    struct lane_item it[LANE_ITEMS];
+};
+
+static struct lane lanes[TILES_Y], lane_shadow[2][TILES_Y];
+static uint32_t scroll_shadow[2][TILES_Y];
+static int cur_lane, lane_y;   // lane of render_lane_sprite(), its band's y
+static uint8_t lane_dirty[HAL_LANE_W / 8], lane_line[HAL_LANE_W];
+
+// ---------------------------------------------------------------------------
+// Immediate drawing
+// ---------------------------------------------------------------------------
+static void flush(void) {
+    if (!pend_mask)
+        return;
+
+    uint32_t pix = 0;
+    for (int k = 7; k >= 0; --k)
+        pix = (pix << 4) | pend[k];
+    hal_fb_write8(pend_group, pix, pend_mask);
+    pend_mask = 0;
+}
+
+// Write pixel idx (y * FB_W + x). Packed writes are sent once the pixels move
+// on to another group or at flush()
+static void emit(uint16_t idx, uint8_t c) {
+    uint16_t g = idx >> 3;
+    if (g != pend_group) {
+        flush();
+        pend_group = g;
+    }
+    pend[idx & 7] = c;
+    pend_mask |= bit8[idx & 7];
+}
+
+// Write n pixels px[] to idx, idx + 1, ... (all within one row)
+static void put_run(uint16_t idx, const uint8_t *px, int n) {
+    if (wide) {
+        for (int i = 0; i < n; ++i)
+            emit(idx + i, px[i]);
+    } else if (stream) {
+        hal_fb_stream(idx, px, n);
+    } else {
+        for (int i = 0; i < n; ++i)
+            hal_fb_write(idx + i, px[i]);
+    }
+}
+
+// Generated kernels, calling put_run(). They take about 10 KB of the LMB;
+// -DRENDER_NO_KERNELS leaves them out
+#ifndef RENDER_NO_KERNELS
+#include "sprite_kernels.h"
+#else
+#define SPRITE_KERNELS 0
+#define SPRITE_KERNEL_RUNS 0
+#define SPRITE_KERNEL_DATA 0
+#endif
+
+int render_kernels = 1;
+#ifdef FROGGER_COUNT_OPS
+const int render_kernel_size[3] = {SPRITE_KERNELS, SPRITE_KERNEL_RUNS, SPRITE_KERNEL_DATA};
+#endif
+
+static inline void put_pixel(int x, int y, uint8_t c) {
+    hal_fb_write(ROW_BASE(y) + x, c);
+}
+
+// Write the non-zero pixels of px[0..n-1] to row y from column x on. Runs of
+// opaque pixels go out as one put_run(); the plain GPIO port writes pixel by
+// pixel as before
+static void put_line(int x, int y, const uint8_t *px, int n) {
+    if (!wide && !stream) {
+        for (int i = 0; i < n; ++i)
+            if (px[i] && (unsigned)(x + i) < FB_W)
+                put_pixel(x + i, y, px[i]);
+        return;
+    }
+
+    int i = x < 0 ? -x : 0;
+    if (x + n > FB_W)
+        n = FB_W - x;
+    uint16_t base = ROW_BASE(y) + x;
+    while (i < n) {
+        if (!px[i]) {
+            ++i;
+            continue;
+        }
+        int start = i;
+        while (i < n && px[i])
+            ++i;
+        put_run(base + start, &px[start], i - start);
+    }
+}
+
+// Unpack n packed bytes to 2n pixels, in order or mirrored
+static void unpack(uint8_t *px, const uint8_t *b, int n) {
+    for (int j = 0; j < n; ++j, px += 2) {
+        px[0] = b[j] & 15;
+        px[1] = nib_swap[b[j]] & 15;
+    }
+}
+
+static void unpack_rev(uint8_t *px, const uint8_t *b, int n) {
+    for (int j = n - 1; j >= 0; --j, px += 2) {
+        px[0] = nib_swap[b[j]] & 15;
+        px[1] = b[j] & 15;
+    }
+}
+
+// Row dy of sprite idx drawn with transform xf, one byte per pixel. The
+// rotations gather column c of every row, column 15 - c of a mirrored one
+static void sprite_line(uint8_t *px, int idx, int xf, int dy) {
+    const uint16_t *rows = sprite_rows[idx];
+    int c, next = 1;
+
+    OP_PX(xf <= XF_ROT_180 ? 8 : 16);   // a load per byte, or per pixel
+    if (xf <= XF_ROT_180) {
+        unsigned e = rows[xf & XF_FLIP_V ? 15 - dy : dy];
+        if ((xf ^ e) & 1)
+            unpack_rev(px, ENT_BYTES(e), 8);
+        else
+            unpack(px, ENT_BYTES(e), 8);
+        return;
+    }
+    if (xf == XF_ROT_LEFT) {
+        c = 15 - dy;
+    } else {
+        c = dy;
+        rows += 15;
+        next = -1;
+    }
+    for (int dx = 0; dx < 16; ++dx, rows += next) {
+        unsigned e = *rows;
+        int k = e & 1 ? 15 - c : c;
+        uint8_t b = ENT_BYTES(e)[k >> 1];
+        px[dx] = (k & 1 ? nib_swap[b] : b) & 15;
+    }
+}
+
+static void glyph_line(uint8_t *px, int glyph, int dy) {
+    OP_PX(4);
+    unpack(px, (const uint8_t *)&glyph_pix[glyph_rows[glyph][dy]], 4);
+}
+
+// The opaque pixels of a packed row over row[lo..hi-1], source column c at
+// lo; mirrored, the source columns run down from c
+static void blend(uint8_t *row, int lo, int hi, const uint8_t *b, int c) {
+    int x = lo, j = c >> 1;
+    uint8_t v;
+
+    if (c & 1) {
+        if ((v = nib_swap[b[j++]] & 15))
+            row[x] = v;
+        ++x;
+    }
+    for (; x + 1 < hi; x += 2, ++j) {
+        if ((v = b[j] & 15))
+            row[x] = v;
+        if ((v = nib_swap[b[j]] & 15))
+            row[x + 1] = v;
+    }
+    if (x < hi && (v = b[j] & 15))
+        row[x] = v;
+}
+
+static void blend_rev(uint8_t *row, int lo, int hi, const uint8_t *b, int c) {
+    int x = lo, j = c >> 1;
+    uint8_t v;
+
+    if (!(c & 1)) {
+        if ((v = b[j--] & 15))
+            row[x] = v;
+        ++x;
+    }
+    for (; x + 1 < hi; x += 2, --j) {
+        if ((v = nib_swap[b[j]] & 15))
+            row[x] = v;
+        if ((v = b[j] & 15))
+            row[x + 1] = v;
+    }
+    if (x < hi && (v = nib_swap[b[j]] & 15))
+        row[x] = v;
+}
+
+// The words of a horizontally flipped row: bytes in reverse order, each
+// with its nibbles swapped, and the masks mirrored
+static void flip_words(uint32_t *dw, uint8_t *dm, const uint32_t *w, const uint8_t *m, int n) {
+    const uint8_t *s = (const uint8_t *)w;
+    uint8_t *d = (uint8_t *)dw;
+
+    for (int i = 0, j = 4 * n - 1; j >= 0; ++i, --j)
+        d[i] = nib_swap[s[j]];
+    for (int k = 0; k < n; ++k)
+        dm[k] = bit_rev[m[n - 1 - k]];
+}
+
+// n packed words of row y from column x on, x a multiple of 8, each written
+// with its opacity mask; words off screen are left out
+static void put_words(int x, int y, const uint32_t *w, const uint8_t *m, int n) {
+    int g = (ROW_BASE(y) + x) >> 3;
+
+    flush();   // pending pixels go first
+    for (int k = 0; k < n; ++k, ++g, x += 8)
+        if (m[k] && (unsigned)x < FB_W)
+            hal_fb_write8((uint16_t)g, w[k], m[k]);
+}
+
+// Blitter transform bits of each XF_* value
+static const uint32_t xf_blit[6] = {
+    0,
+    HAL_BLIT_FLIP_H,
+    HAL_BLIT_FLIP_V,
+    HAL_BLIT_FLIP_H | HAL_BLIT_FLIP_V,
+    HAL_BLIT_ROT,
+    HAL_BLIT_ROT | HAL_BLIT_FLIP_H | HAL_BLIT_FLIP_V,
+};
+
+static void draw_background(void) {
+    for (int ty = 0, by = 0; ty < FB_H / TILE_H; ++ty, by += TILE_H)
+        for (int tx = 0, bx = 0; tx < FB_W / TILE_W; ++tx, bx += TILE_W) {
+            uint8_t tid = tilemap[ty][tx];
+            if (!tid)
+                continue;   // tile 0 is left to the hardware clear
+
+            uint8_t line[TILE_W];
+            uint32_t fw[2];
+            uint8_t fm[2];
+            for (int dy = 0; dy < TILE_H; ++dy) {
+                unsigned e = tile_rows[tid][dy];
+                if (!e)
+                    continue;
+                if (wide && e & 1) {
+                    flip_words(fw, fm, ENT_WORDS(e), ENT_MASK(e), 2);
+                    put_words(bx, by + dy, fw, fm, 2);
+                } else if (wide) {
+                    put_words(bx, by + dy, ENT_WORDS(e), ENT_MASK(e), 2);
+                } else {
+                    OP_PX(TILE_W / 2);
+                    if (e & 1)
+                        unpack_rev(line, ENT_BYTES(e), TILE_W / 2);
+                    else
+                        unpack(line, ENT_BYTES(e), TILE_W / 2);
+                    put_line(bx, by + dy, line, TILE_W);
+                }
+            }
+        }
+}
+
+// Sprite idx from its colour spans, clipped to the buffer
+static void draw_spans(int idx, int sx, int sy) {
+    const uint8_t *p = &sprite_span_data[sprite_span_start[idx]];
+    uint16_t base = ROW_BASE(sy);
+
+    flush();   // pending pixels go first
+    for (int y = sy; y < sy + 16; ++y, base += FB_W) {
+        int n = *p++, x = sx;
+        for (; n; --n, p += 2) {
+            OP_PX(2);   // decode, about two pixels' worth of loop work
+            int x0 = x + (p[0] >> 4);
+            x = x0 + (p[0] & 15) + 1;
+            if ((unsigned)y >= FB_H)
+                continue;
+            int x1 = x > FB_W ? FB_W : x;
+            if (x0 < 0)
+                x0 = 0;
+            if (x0 < x1)
+                hal_fb_span(base + x0, x1 - x0, p[1]);
+        }
+    }
+}
+
+// Sprite idx at a column that is a multiple of 8, through the packed port:
+// its rows as stored or, flipped vertically, from the last one up
+static void draw_sprite_words(int idx, int sx, int sy, int xf) {
+    int dy = xf & XF_FLIP_V ? 15 : 0, next = xf & XF_FLIP_V ? -1 : 1;
+    uint32_t fw[2];
+    uint8_t fm[2];
+
+    for (int y = sy; y < sy + 16; ++y, dy += next) {
+        unsigned e = sprite_rows[idx][dy];
+        if ((unsigned)y >= FB_H || !e)
+            continue;
+        const uint32_t *w = ENT_WORDS(e);
+        const uint8_t *m = ENT_MASK(e);
+        if ((xf ^ e) & 1) {
+            flip_words(fw, fm, w, m, 2);
+            w = fw;
+            m = fm;
+        }
+        put_words(sx, y, w, m, 2);
+    }
+}
+
+static void draw_sprite(int idx, int sx, int sy, int xf) {
+    static uint8_t line[16];
+
+    if (blit) {
+        flush();   // pending pixels go first
+        hal_fb_blit(HAL_BLIT_ID(idx) | HAL_BLIT_X(sx) | HAL_BLIT_Y(sy) | xf_blit[xf] |
+                    HAL_BLIT_KEY(0));
+        return;
+    }
+    if (span && xf == XF_NONE) {
+        draw_spans(idx, sx, sy);
+        return;
+    }
+    if (wide && !(sx & 7) && xf <= XF_ROT_180) {
+        draw_sprite_words(idx, sx, sy, xf);
+        return;
+    }
+#ifndef RENDER_NO_KERNELS
+    if (render_kernels && (unsigned)sx <= FB_W - 16 && (unsigned)sy <= FB_H - 16 &&
+        sprite_kernels[idx][xf]) {
+        sprite_kernels[idx][xf](ROW_BASE(sy) + sx);
+        return;
+    }
+#endif
+
+    for (int y = sy, dy = 0; dy < 16; ++y, ++dy) {
+        if ((unsigned)y >= FB_H)
+            continue;
+        // Rows without an opaque pixel are known from their entries
+        if (xf <= XF_ROT_180 && !sprite_rows[idx][xf & XF_FLIP_V ? 15 - dy : dy])
+            continue;
+
+        sprite_line(line, idx, xf, dy);
+        OP_PX(16);   // transparency test of each pixel
+        put_line(sx, y, line, 16);
+    }
+}
+
+static void draw_glyph(int glyph, int sx, int sy) {
+    uint8_t line[GLYPH_W];
+
+    for (int y = sy, dy = 0; dy < 8; ++y, ++dy) {
+        unsigned e = glyph_rows[glyph][dy];
+        if ((unsigned)y >= FB_H || !e)
+            continue;
+        if (wide && !(sx & 7)) {
+            put_words(sx, y, &glyph_pix[e], &glyph_mask[e], 1);
+        } else {
+            glyph_line(line, glyph, dy);
+            put_line(sx, y, line, GLYPH_W);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Display list
+// ---------------------------------------------------------------------------
+static void item_rect(const struct item *it, struct rect *r) {
+    int w = 16, h = 16;
+    if (it->kind == IT_GLYPH)
+        w = h = GLYPH_W;
+    else if (it->kind == IT_FILL) {
+        w = it->id;
+        h = it->xf;
+    }
+    r->x0 = it->x < 0 ? 0 : it->x;
+    r->y0 = it->y < 0 ? 0 : it->y;
+    r->x1 = it->x + w > FB_W ? FB_W : it->x + w;
+    r->y1 = it->y + h > FB_H ? FB_H : it->y + h;
+}
+
+static void add_item(int kind, int x, int y, int id, int xf, int c, int w, int h) {
+    if (x <= -w || x >= FB_W || y <= -h || y >= FB_H)
+        return;
+
+    struct dlist *l = &lists[cur];
+    if (l->n == MAX_ITEMS) {
+        l->full = 1;
+        return;
+    }
+    struct item *it = &l->it[l->n++];
+    it->x = x;
+    it->y = y;
+    it->kind = kind;
+    it->id = id;
+    it->xf = xf;
+    it->c = c;
+}
+
+static int item_eq(const struct item *a, const struct item *b) {
+    return a->x == b->x && a->y == b->y && a->kind == b->kind && a->id == b->id &&
+           a->xf == b->xf && a->c == b->c;
+}
+
+static int overlaps(const struct rect *a, const struct rect *b) {
+    return a->x0 < b->x1 && b->x0 < a->x1 && a->y0 < b->y1 && b->y0 < a->y1;
+}
+
+static void add_rect(struct rect r) {
+    if (num_rects > MAX_RECTS)
+        return;   // already repainting everything
+
+    // Merge with every rect it overlaps; the union may in turn overlap others
+    for (int i = 0; i < num_rects;) {
+        if (!overlaps(&r, &rects[i])) {
+            ++i;
+            continue;
+        }
+        if (rects[i].x0 < r.x0) r.x0 = rects[i].x0;
+        if (rects[i].y0 < r.y0) r.y0 = rects[i].y0;
+        if (rects[i].x1 > r.x1) r.x1 = rects[i].x1;
+        if (rects[i].y1 > r.y1) r.y1 = rects[i].y1;
+        rects[i] = rects[--num_rects];
+        i = 0;
+    }
+    if (num_rects == MAX_RECTS) {
+        num_rects = MAX_RECTS + 1;
+        return;
+    }
+    rects[num_rects++] = r;
+}
+
+static void dirty_item(const struct item *it) {
+    struct rect r;
+    item_rect(it, &r);
+    add_rect(r);
+}
+
+// Walk both lists in step; items only present in one of them (or whose
+// order changed) mark their screen area dirty
+static void diff_lists(const struct dlist *a, const struct dlist *b) {
+    int i = 0, j = 0;
+
+    while (i < a->n && j < b->n) {
+        if (item_eq(&a->it[i], &b->it[j])) {
+            ++i;
+            ++j;
+            continue;
+        }
+
+        int k, skip_b = 0, skip_a = 0;
+        for (k = 1; k <= RESYNC && j + k < b->n; ++k)
+            if (item_eq(&a->it[i], &b->it[j + k])) {
+                skip_b = k;
+                break;
+            }
+        if (!skip_b)
+            for (k = 1; k <= RESYNC && i + k < a->n; ++k)
+                if (item_eq(&a->it[i + k], &b->it[j])) {
+                    skip_a = k;
+                    break;
+                }
+
+        if (skip_b) {
+            while (skip_b--)
+                dirty_item(&b->it[j++]);
+        } else if (skip_a) {
+            while (skip_a--)
+                dirty_item(&a->it[i++]);
+        } else {
+            dirty_item(&a->it[i++]);
+            dirty_item(&b->it[j++]);
+        }
+    }
+    while (i < a->n)
+        dirty_item(&a->it[i++]);
+    while (j < b->n)
+        dirty_item(&b->it[j++]);
+}
+
+// Indices of the items of l that touch r
+static int select_items(const struct dlist *l, const struct rect *r, uint8_t *sel) {
+    int n = 0;
+    for (int i = 0; i < l->n; ++i) {
+        struct rect ir;
+        item_rect(&l->it[i], &ir);
+        if (overlaps(&ir, r))
+            sel[n++] = i;
+    }
+    return n;
+}
+
+// Background of row y, columns x0..x1-1, as the clearing renderer draws it;
+// both lists share it
+static void compose_bg(uint8_t *row, int y, int x0, int x1) {
+    const uint8_t *tiles = tilemap[y / TILE_H];
+    int ty = y % TILE_H;
+    uint8_t px[16];
+
+    if (tile_layer) {
+        memset(&row[x0], 0, x1 - x0);   // the hardware shows the tiles
+    } else {
+        // Tile by tile, the part of each within x0..x1
+        for (int x = x0; x < x1;) {
+            int tx = x / TILE_W, end = (tx + 1) * TILE_W < x1 ? (tx + 1) * TILE_W : x1;
+            uint8_t tid = tiles[tx];
+            unsigned e = tid ? tile_rows[tid][ty] : 0;
+            uint8_t *d = end - x == TILE_W ? &row[x] : px;
+            if (e) {
+                if (e & 1)
+                    unpack_rev(d, ENT_BYTES(e), TILE_W / 2);
+                else
+                    unpack(d, ENT_BYTES(e), TILE_W / 2);
+                if (d == px)
+                    memcpy(&row[x], &px[x % TILE_W], end - x);
+            } else {
+                memset(&row[x], 0, end - x);
+            }
+            x = end;
+        }
+        OP_PX(x1 - x0);
+    }
+}
+
+// The items of l in sel drawn over that background
+static void compose_items(uint8_t *row, const struct dlist *l, const uint8_t *sel, int n,
+                          int y, int x0, int x1) {
+    uint8_t px[16];
+
+    for (int k = 0; k < n; ++k) {
+        const struct item *it = &l->it[sel[k]];
+        int dy = y - it->y;
+        int lo = x0 > it->x ? x0 : it->x;
+
+        if (it->kind == IT_FILL) {
+            int hi = it->x + it->id < x1 ? it->x + it->id : x1;
+            if (dy < 0 || dy >= it->xf || lo >= hi)
+                continue;
+            memset(&row[lo], it->c, hi - lo);
+            OP_PX(hi - lo);
+            continue;
+        }
+
+        int w = it->kind == IT_GLYPH ? GLYPH_W : 16;
+        int hi = it->x + w < x1 ? it->x + w : x1;
+        if (dy < 0 || dy >= w || lo >= hi)
+            continue;
+
+        // Rows as stored or mirrored straight from the packed bytes, the
+        // rotations unpacked first
+        int c = lo - it->x;
+        if (it->kind == IT_GLYPH) {
+            unsigned e = glyph_rows[it->id][dy];
+            if (e)
+                blend(row, lo, hi, (const uint8_t *)&glyph_pix[e], c);
+        } else if (it->xf <= XF_ROT_180) {
+            unsigned e = sprite_rows[it->id][it->xf & XF_FLIP_V ? 15 - dy : dy];
+            if (!e)
+                continue;
+            if ((it->xf ^ e) & 1)
+                blend_rev(row, lo, hi, ENT_BYTES(e), 15 - c);
+            else
+                blend(row, lo, hi, ENT_BYTES(e), c);
+        } else {
+            sprite_line(px, it->id, it->xf, dy);
+            for (int x = lo; x < hi; ++x, ++c)
+                if (px[c])
+                    row[x] = px[c];
+        }
+        OP_PX(hi - lo);
+    }
+}
+
+static void repaint(const struct rect *r, const struct dlist *nl, const struct dlist *ol) {
+    int nn = select_items(nl, r, sel_new);
+    int no = ol ? select_items(ol, r, sel_old) : 0;
+
+    for (int y = r->y0; y < r->y1; ++y) {
+        uint16_t base = ROW_BASE(y);
+
+        // The background is composed once and copied, a word per 4 pixels
+        // (a plain clear, like the memset, when the hardware shows the tiles)
+        compose_bg(new_row, y, r->x0, r->x1);
+        if (ol) {
+            memcpy(&old_row[r->x0], &new_row[r->x0], r->x1 - r->x0);
+            if (!tile_layer)
+                OP_PX((r->x1 - r->x0 + 3) / 4);
+            compose_items(old_row, ol, sel_old, no, y, r->x0, r->x1);
+        }
+        compose_items(new_row, nl, sel_new, nn, y, r->x0, r->x1);
+        // Runs of changed pixels
+        int x = r->x0;
+        while (x < r->x1) {
+            if (ol && new_row[x] == old_row[x]) {
+                ++x;
+                continue;
+            }
+            int start = x;
+            while (x < r->x1 && (!ol || new_row[x] != old_row[x]))
+                ++x;
+            put_run(base + start, &new_row[start], x - start);
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// Object layer
+// ---------------------------------------------------------------------------
+// Sprite into the frame buffer, or the display list
+static void fb_sprite(int idx, int x, int y, int xf) {
+    if (keep_back)
+        add_item(IT_SPRITE, x, y, idx, xf, 0, 16, 16);
+    else if (x > -16 && x < FB_W && y > -16 && y < FB_H)
+        draw_sprite(idx, x, y, xf);
+}
+
+// An item (fields as in struct item) is about to be drawn into the frame
+// buffer. Objects under it, and earlier objects overlapping those, move into
+// the frame buffer first, in their order
+static void sink_objs(int kind, int x, int y, int id, int xf) {
+    struct item t = {x, y, kind, id, xf, 0};
+    struct rect r, ir, jr;
+
+    item_rect(&t, &r);
+    for (int i = 0; i < num_objs; ++i) {
+        item_rect(&objs[i], &ir);
+        sunk[i] = overlaps(&ir, &r);
+    }
+    for (int i = num_objs - 1; i > 0; --i) {
+        if (!sunk[i])
+            continue;
+        item_rect(&objs[i], &ir);
+        for (int j = 0; j < i; ++j) {
+            item_rect(&objs[j], &jr);
+            if (overlaps(&jr, &ir))
+                sunk[j] = 1;
+        }
+    }
+
+    int n = 0;
+    for (int i = 0; i < num_objs; ++i) {
+        if (sunk[i])
+            fb_sprite(objs[i].id, objs[i].x, objs[i].y, objs[i].xf);
+        else
+            objs[n++] = objs[i];
+    }
+    num_objs = n;
+}
+
+// Entries that differ from what the back bank already holds
+static void write_oam(void) {
+    uint32_t *shadow = oam_shadow[bank];
+
+    for (int i = 0; i < HAL_OAM_ENTRIES; ++i) {
+        uint32_t e = 0;
+        if (i < num_objs) {
+            const struct item *it = &objs[i];
+            e = HAL_OAM_ENABLE | HAL_BLIT_ID(it->id) | HAL_BLIT_X(it->x) | HAL_BLIT_Y(it->y) |
+                xf_blit[it->xf];
+        }
+        if (e != shadow[i]) {
+            hal_oam_write(i, e);
+            shadow[i] = e;
+        }
+    }
+}
+
+// Likewise for the tilemap
+static void write_tiles(void) {
+    const uint8_t *t = &tilemap[0][0];
+    uint8_t *shadow = tile_shadow[bank];
+
+    for (int i = 0; i < TILES_Y * TILES_X; ++i)
+        if (t[i] != shadow[i]) {
+            hal_tile_write(i, t[i]);
+            shadow[i] = t[i];
+        }
+}
+
+// ---------------------------------------------------------------------------
+// Lane layer
+// ---------------------------------------------------------------------------
+// v modulo p for v within a few periods of 0, without a divide
+static int wrap(int v, int p) {
+    while (v < 0)
+        v += p;
+    while (v >= p)
+        v -= p;
+    return v;
+}
+
+static int lane_item_eq(const struct lane_item *a, const struct lane_item *b) {
+    return a->x == b->x && a->id == b->id && a->xf == b->xf;
+}
+
+// The groups a 16-pixel sprite at buffer column x covers
+static void dirty_lane_item(const struct lane_item *it, int p) {
+    lane_dirty[it->x >> 3] = 1;
+    lane_dirty[wrap(it->x + 8, p) >> 3] = 1;
+    lane_dirty[wrap(it->x + 15, p) >> 3] = 1;
+}
+
+// Rewrite the groups of lane buffer b whose sprites changed since the bank
+// last got them
+static void write_lane(int b, const struct lane *l, struct lane *s) {
+    int p = l->period, groups = (p + 7) >> 3, any = 0;
+
+    if (s->n < 0 || s->period != p) {
+        memset(lane_dirty, 1, groups);
+        any = 1;
+    } else {
+        memset(lane_dirty, 0, groups);
+        int n = l->n > s->n ? l->n : s->n;
+        for (int i = 0; i < n; ++i) {
+            if (i < l->n && i < s->n && lane_item_eq(&l->it[i], &s->it[i]))
+                continue;
+            if (i < l->n)
+                dirty_lane_item(&l->it[i], p);
+            if (i < s->n)
+                dirty_lane_item(&s->it[i], p);
+            any = 1;
+        }
+    }
+    if (!any)
+        return;
+
+    for (int row = 0; row < 16; ++row) {
+        memset(lane_line, 0, p);
+        for (int i = 0; i < l->n; ++i) {
+            const struct lane_item *it = &l->it[i];
+            OP_PX(16);
+            if (it->xf <= XF_ROT_180) {
+                // Two pixels per packed byte, mirrored from the last byte
+                unsigned e = sprite_rows[it->id][it->xf & XF_FLIP_V ? 15 - row : row];
+                if (!e)
+                    continue;
+                const uint8_t *b = ENT_BYTES(e);
+                int rev = (it->xf ^ e) & 1;
+                for (int k = 0, c = it->x; k < 8; ++k) {
+                    uint8_t pb = b[rev ? 7 - k : k], lo = pb & 15, hi = nib_swap[pb] & 15;
+                    uint8_t v0 = rev ? hi : lo, v1 = rev ? lo : hi;
+                    if (v0 && lane_dirty[c >> 3])
+                        lane_line[c] = v0;
+                    if (++c == p)
+                        c = 0;
+                    if (v1 && lane_dirty[c >> 3])
+                        lane_line[c] = v1;
+                    if (++c == p)
+                        c = 0;
+                }
+                continue;
+            }
+            uint8_t spr[16];
+            sprite_line(spr, it->id, it->xf, row);
+            for (int dx = 0, c = it->x; dx < 16; ++dx) {
+                if (lane_dirty[c >> 3] && spr[dx])
+                    lane_line[c] = spr[dx];
+                if (++c == p)
+                    c = 0;
+            }
+        }
+        const uint8_t *px = lane_line;
+        for (int g = 0, left = p; g < groups; ++g, px += 8, left -= 8) {
+            if (!lane_dirty[g])
+                continue;
+            int n = left < 8 ? left : 8;
+            uint32_t pix = 0;
+            for (int k = n - 1; k >= 0; --k)
+                pix = (pix << 4) | px[k];
+            hal_lane_write8(b, row, g, pix, low8[n]);
+        }
+    }
+    memcpy(s->it, l->it, l->n * sizeof(l->it[0]));
+    s->n = l->n;
+    s->period = p;
+}
+
+static void write_lanes(void) {
+    for (int b = HAL_LANE_FIRST; b <= HAL_LANE_LAST; ++b) {
+        struct lane *l = &lanes[b];
+        int scroll = l->period ? l->scroll : 0;
+        uint32_t reg = (uint32_t)(scroll | l->period << 9);
+
+        if (l->period)
+            write_lane(b, l, &lane_shadow[bank][b]);
+        if (reg != scroll_shadow[bank][b]) {
+            hal_lane_scroll(b, scroll, l->period);
+            scroll_shadow[bank][b] = reg;
+        }
+    }
+}
+
+// ---------------------------------------------------------------------------
+// API
+// ---------------------------------------------------------------------------
+void render_init(void) {
+    uint32_t caps = hal_fb_caps();
+
+    // The layers have two banks, swapped per frame handed over; with a
+    // third buffer a frame can wait for its swap while the next one is
+    // drawn, so they are left alone
+    if (caps & HAL_FB_TRIPLE)
+        caps &= ~(HAL_FB_OAM | HAL_FB_TILES | HAL_FB_LANES);
+
+    uint16_t base = (uint16_t)-(ROW_MARGIN * FB_W);
+    for (int y = 0; y < ROW_MARGIN + FB_H + ROW_MARGIN; ++y, base += FB_W)
+        row_base_tab[y] = base;
+
+    keep_back = (caps & HAL_FB_KEEP_BACK) != 0;
+    wide = (caps & HAL_FB_WIDE) != 0;
+    stream = (caps & HAL_FB_STREAM) != 0;
+    blit = (caps & HAL_FB_BLIT) != 0;
+    fill = (caps & HAL_FB_FILL) != 0;
+    span = (caps & HAL_FB_SPAN) != 0;
+    obj_layer = (caps & HAL_FB_OAM) != 0;
+    tile_layer = (caps & HAL_FB_TILES) != 0;
+    // Lane pixels go through the packed port; the background under them has
+    // to come from the tile layer
+    lane_layer = (caps & HAL_FB_LANES) && wide && tile_layer;
+    buffers = caps & HAL_FB_TRIPLE ? 3 : 2;
+    cur = 0;
+    history = 0;
+    num_objs = 0;
+    bank = 0;
+    memset(oam_shadow, 0xFF, sizeof(oam_shadow));   // bank contents unknown
+    memset(tile_shadow, 0xFF, sizeof(tile_shadow));
+    memset(scroll_shadow, 0xFF, sizeof(scroll_shadow));
+    for (int b = 0; b < TILES_Y; ++b) {
+        lanes[b].period = 0;
+        lane_shadow[0][b].n = lane_shadow[1][b].n = -1;
+    }
+    cur_lane = -1;
+    for (int y = 0; y < TILES_Y; ++y)
+        memcpy(tilemap[y], bg_map_rows[bg_map_row[y]], TILES_X);
+    memcpy(tile_next, tilemap, sizeof(tile_next));
+    tiles_changed = 0;
+}
+
+uint16_t render_palette(int i) {
+    return pal_rgb444[i & 15];
+}
+
+void render_begin(void) {
+    num_objs = 0;
+    for (int b = 0; b < TILES_Y; ++b)
+        lanes[b].period = 0;
+    cur_lane = -1;
+    if (tiles_changed) {
+        memcpy(tilemap, tile_next, sizeof(tilemap));
+        tiles_changed = 0;
+        // The display lists do not cover the background: without the tile
+        // layer every buffer is repainted
+        if (!tile_layer)
+            history = 0;
+    }
+    if (!keep_back) {
+        if (!tile_layer)
+            draw_background();
+        return;
+    }
+    lists[cur].n = 0;
+    lists[cur].full = 0;
+}
+
+void render_sprite(int idx, int x, int y, int xf) {
+    if (obj_layer && x > -16 && x < FB_W && y > -16 && y < FB_H) {
+        if (num_objs < HAL_OAM_ENTRIES) {
+            struct item *it = &objs[num_objs++];
+            it->x = x;
+            it->y = y;
+            it->kind = IT_SPRITE;
+            it->id = idx;
+            it->xf = xf;
+            it->c = 0;
+            return;
+        }
+        // Out of entries: into the frame buffer, above the objects under it
+        sink_objs(IT_SPRITE, x, y, idx, xf);
+    }
+    fb_sprite(idx, x, y, xf);
+}
+
+void render_glyph(int glyph, int x, int y) {
+    if (num_objs)
+        sink_objs(IT_GLYPH, x, y, glyph, 0);
+    if (keep_back)
+        add_item(IT_GLYPH, x, y, glyph, 0, 0, GLYPH_W, GLYPH_W);
+    else if (x > -GLYPH_W && x < FB_W && y > -GLYPH_W && y < FB_H)
+        draw_glyph(glyph, x, y);
+}
+
+void render_fill(int x, int y, int w, int h, uint8_t c) {
+    if (w <= 0 || h <= 0)
+        return;
+    if (num_objs)
+        sink_objs(IT_FILL, x, y, w, h);
+    if (keep_back) {
+        add_item(IT_FILL, x, y, w, h, c, w, h);
+        return;
+    }
+    if (!wide && !stream) {
+        for (int py = y; py < y + h; ++py)
+            for (int px = x; px < x + w; ++px)
+                if ((unsigned)px < FB_W && (unsigned)py < FB_H)
+                    put_pixel(px, py, c);
+        return;
+    }
+
+    int x0 = x < 0 ? 0 : x, x1 = x + w > FB_W ? FB_W : x + w;
+    int y0 = y < 0 ? 0 : y, y1 = y + h > FB_H ? FB_H : y + h;
+    if (x0 >= x1 || y0 >= y1)
+        return;
+    if (fill) {
+        flush();   // pending pixels go first
+        hal_fb_fill(x0, y0, x1 - x0, y1 - y0, c);
+        return;
+    }
+    memset(&new_row[x0], c, x1 - x0);   // row buffer is free outside keep mode
+    uint16_t base = ROW_BASE(y0) + x0;
+    for (int py = y0; py < y1; ++py, base += FB_W)
+        put_run(base, &new_row[x0], x1 - x0);
+}
+
+void render_lane(int y, int period) {
+    int b = y / TILE_H;
+
+    lane_y = y;
+    cur_lane = -1;
+    if (!lane_layer || y % TILE_H || b < HAL_LANE_FIRST || b > HAL_LANE_LAST ||
+        period < FB_W + TILE_W || period > HAL_LANE_W)
+        return;
+    cur_lane = b;
+    lanes[b].period = period;
+    lanes[b].scroll = 0;
+    lanes[b].n = 0;
+}
+
+void render_lane_sprite(int idx, int x, int xf) {
+    // Without a lane buffer, or out of lane entries: an ordinary sprite
+    if (cur_lane < 0 || lanes[cur_lane].n == LANE_ITEMS) {
+        render_sprite(idx, x, lane_y, xf);
+        return;
+    }
+    struct lane *l = &lanes[cur_lane];
+    if (!l->n)
+        l->scroll = wrap(-x, l->period);
+    struct lane_item *it = &l->it[l->n++];
+    it->x = wrap(x + l->scroll, l->period);
+    it->id = idx;
+    it->xf = xf;
+}
+
+void render_tile(int tx, int ty, int tile) {
+    if ((unsigned)tx >= TILES_X || (unsigned)ty >= TILES_Y || tile_next[ty][tx] == tile)
+        return;
+    tile_next[ty][tx] = tile;
+    tiles_changed = 1;
+}
+
+void render_end(void) {
+    if (obj_layer)
+        write_oam();
+    if (tile_layer)
+        write_tiles();
+    if (lane_layer)
+        write_lanes();
+    bank ^= 1;
+    if (!keep_back) {
+        flush();
+        return;
+    }
+
+    struct dlist *nl = &lists[cur];
+    int next = cur == buffers ? 0 : cur + 1;
+    struct dlist *ol = &lists[next];   // `buffers` frames back
+
+    if (history < buffers || ol->full) {
+        // Back buffer content unknown: repaint it completely
+        struct rect all = {0, 0, FB_W, FB_H};
+        repaint(&all, nl, NULL);
+    } else {
+        num_rects = 0;
+        diff_lists(nl, ol);
+        if (num_rects > MAX_RECTS) {
+            struct rect all = {0, 0, FB_W, FB_H};
+            repaint(&all, nl, ol);
+        } else {
+            for (int i = 0; i < num_rects; ++i)
+                repaint(&rects[i], nl, ol);
+        }
+    }
+    flush();
+
+    if (history < buffers)
+        history++;
+    cur = next;
+}
@@ -0,0 +1,55 @@
+// Framebuffer renderer used by draw_complete_frame() and the overlays.
+//
+// A frame is bracketed by render_begin()/render_end(). In between, the scene
+// is described with render_sprite()/render_glyph()/render_fill() in back to
+// front order; the background tilemap is always the bottom layer. With the
+// lane layer, lanes (render_lane()) end up under everything else drawn over
+// their band, so they are drawn first there.
+#pragma once
+#include <stdint.h>
+
+#define FB_W 224
+#define FB_H 256
+
+// Sprite transforms for render_sprite()
+#define XF_NONE 0
+#define XF_FLIP_H 1
+#define XF_FLIP_V 2
+#define XF_ROT_180 (XF_FLIP_H | XF_FLIP_V)
+#define XF_ROT_LEFT 4    // src_x = 15 - dy, src_y = dx
+#define XF_ROT_RIGHT 5   // src_x = dy, src_y = 15 - dx
+
+// 8x8 glyphs: 0..25 are letters A-Z, GLYPH_DIGIT + n is digit n
+#define GLYPH_DIGIT 26
+
+// Whole on-screen sprites are drawn by the generated kernels of
+// sprite_kernels.h rather than the generic loop (1, the default); the bench
+// turns them off to compare
+extern int render_kernels;
+#ifdef FROGGER_COUNT_OPS
+// Kernels, their put_run() calls and bytes of pre-transformed pixels
+extern const int render_kernel_size[3];
+// Row addresses from the row table (1, the default) or multiplied out as
+// y * FB_W; the bench compares the two
+extern int render_row_table;
+#endif
+
+void render_init(void);
+// Palette entry i as palette.mem has it, RGB444: what the palette registers
+// reset to and hal_palette_write() puts back
+uint16_t render_palette(int i);
+void render_begin(void);
+void render_sprite(int idx, int x, int y, int xf);
+void render_glyph(int glyph, int x, int y);
+void render_fill(int x, int y, int w, int h, uint8_t c);
+// Start the lane of the 16-pixel band at y. Its sprites, drawn with
+// render_lane_sprite() in back to front order, move together and leave the
+// screen on one side to come back exactly `period` pixels away on the other;
+// with the lane layer the hardware scrolls them instead of them being drawn
+void render_lane(int y, int period);
+void render_lane_sprite(int idx, int x, int xf);
+// Replace background tile (tx, ty) with background[tile] from the next frame
+// on; 0 is an empty tile. With the tile layer this is one tilemap write per
+// buffer
+void render_tile(int tx, int ty, int tile);
+void render_end(void);
@@ -0,0 +1,43 @@
+// Slack report of the frame loop, see slack.h.
+#include "slack.h"
+#include "fmt.h"
+#include "hal.h"
+#include "opcount.h"
+
+static uint32_t frames;
+static uint32_t recovered_max, waited_max;
+static uint64_t recovered_total, waited_total;
+
+void slack_reset(void) {
+    frames = recovered_max = waited_max = 0;
+    recovered_total = waited_total = 0;
+}
+
+void slack_frame(uint32_t recovered, uint32_t waited) {
+    frames++;
+    recovered_total += recovered;
+    waited_total += waited;
+    if (recovered > recovered_max)
+        recovered_max = recovered;
+    if (waited > waited_max)
+        waited_max = waited;
+}
+
+static void print_row(const char *name, uint64_t total, uint32_t max) {
+    char line[64], *e = put_str(line, name, 12);
+
+    e = put_u32(e, frames, 8);
+    e = put_u32(e, frames ? (uint32_t)OP_DIV(total, frames) : 0, 11);
+    e = put_u32(e, max, 11);
+    *e++ = '\n';
+    *e = 0;
+    hal_print(line);
+}
+
+void slack_dump(void) {
+    if (!(hal_fb_caps() & HAL_FB_IRQ))
+        return;
+    hal_print("slack         frames     avg/cyc     max/cyc\n");
+    print_row("recovered", recovered_total, recovered_max);
+    print_row("waited", waited_total, waited_max);
+}
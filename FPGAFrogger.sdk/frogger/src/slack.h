@@ -0,0 +1,18 @@
+// Slack the interrupt-driven frame loop recovers (HAL_FB_IRQ).
+//
+// Polled, the CPU spins from the hand-over of a frame until it gets a back
+// buffer again. With the frame interrupts it simulates the next frame in
+// that time and only then waits, flushing the console or idling.
+// slack_frame() takes the cycle counts of one hand-over: the simulation that
+// ran before the buffer came back (recovered) and the wait after it.
+// slack_dump() prints their per-frame average and maximum; without the
+// interrupts it prints nothing.
+#pragma once
+#include <stdint.h>
+
+// Forget all samples
+void slack_reset(void);
+
+void slack_frame(uint32_t recovered, uint32_t waited);
+
+void slack_dump(void);
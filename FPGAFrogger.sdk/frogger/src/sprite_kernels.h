@@ -0,0 +1,992 @@
+// Auto-generated by frogger_host/kerngen from sprites.h, do not edit.
+//
+// Straight-line kernels for the sprites main.c draws: k_<id>_<xf>(p) sends
+// the opaque runs of the sprite, top-left pixel at index p and wholly on
+// screen, through put_run(). Included by render.c.
+#pragma once
+
+#define SPRITE_KERNELS 26        // kernels
+#define SPRITE_KERNEL_RUNS 497   // put_run() calls in all of them
+#define SPRITE_KERNEL_DATA 3826  // bytes of opaque pixels
+
+static const uint8_t px_2_none[] = {
+    0x6, 0x4, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4, 0x4, 0x6, 0x7, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x6, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4,
+    0x6, 0x6, 0x6, 0x6, 0x4, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6,
+    0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_2_rot_right[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x4,
+    0x6, 0x7, 0x6, 0x4, 0x6, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6,
+    0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x6, 0x7, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_2_rot_180[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x4,
+    0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4,
+    0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4,
+    0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4, 0x4, 0x6, 0x7, 0x6, 0x6, 0x6, 0x4,
+    0x4, 0x6, 0x4, 0x6,
+};
+
+static const uint8_t px_2_rot_left[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4, 0x4,
+    0x4, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4, 0x6, 0x6,
+    0x4, 0x6, 0x7, 0x6, 0x4, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_0_none[] = {
+    0x6, 0x6, 0x6, 0x6, 0x4, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4, 0x4, 0x6,
+    0x7, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4,
+    0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_0_rot_right[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4,
+    0x4, 0x4, 0x6, 0x7, 0x6, 0x4, 0x6, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x6, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4,
+    0x4, 0x6, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x4, 0x6, 0x7, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_0_rot_180[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x4,
+    0x4, 0x6, 0x6, 0x6, 0x6, 0x4, 0x4, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x6, 0x6,
+    0x6, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4, 0x4, 0x6, 0x7, 0x6, 0x6, 0x6,
+    0x4, 0x4, 0x6, 0x4, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_0_rot_left[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x7, 0x6, 0x4,
+    0x4, 0x4, 0x6, 0x6, 0x4, 0x6, 0x6, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x4, 0x4, 0x4, 0x6, 0x4, 0x4, 0x6, 0x6, 0x4,
+    0x6, 0x6, 0x4, 0x6, 0x7, 0x6, 0x4, 0x4, 0x4, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_15_none[] = {
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4,
+};
+
+static const uint8_t px_29_none[] = {
+    0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x9, 0x9, 0x3, 0x3, 0x3, 0x9, 0x9, 0x9,
+    0x6, 0x6, 0x3, 0x3, 0x9, 0x9, 0x9, 0x9, 0x6, 0x6, 0x6, 0x9, 0x9, 0x9, 0x9, 0x9,
+    0x9, 0x9, 0x3, 0x9, 0x6, 0x6, 0x3, 0x3, 0x9, 0x9, 0x9, 0x9, 0x9, 0x9, 0x3, 0x3,
+    0x3, 0x9, 0x9, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3,
+};
+
+static const uint8_t px_30_none[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x9, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x9, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x9, 0x6, 0x6, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x9, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x9, 0x9, 0x9, 0x3, 0x3, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x9, 0x9, 0x9, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_31_none[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x9, 0x9, 0x6, 0x6, 0x9, 0x9, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x9, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x9, 0x9, 0x9, 0x9, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x9, 0x9, 0x9, 0x9, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x9, 0x9,
+    0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6,
+    0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x3,
+    0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x9, 0x9, 0x9, 0x3, 0x3,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x9, 0x9, 0x9, 0x3, 0x3, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x3, 0x3, 0x3, 0x3, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_46_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0x1, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0x1, 0xB, 0xB, 0xD, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xD,
+    0x1, 0x1, 0x1, 0xB, 0xB, 0xD, 0xD, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB,
+    0x1, 0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0x1, 0xC, 0xD, 0xC, 0xC,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xC, 0x1, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0xB, 0xB, 0xB, 0xC, 0xC, 0xC, 0x1, 0xC, 0xC, 0xC, 0xC,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_47_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0x1, 0xB, 0xB, 0xB,
+    0xD, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xD, 0xD, 0xB, 0xB, 0xB,
+    0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xC,
+    0xC, 0xC, 0xC, 0xC, 0xD, 0xD, 0xD, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC,
+    0xC, 0xC, 0xC, 0x1, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0x1, 0xC, 0xC, 0xC, 0xC,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_48_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0x1, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xD, 0xD, 0xD, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xD, 0xD, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xB, 0xB, 0xB, 0xB, 0xD, 0xB, 0xB, 0xD, 0xB, 0xB, 0xD, 0x1, 0x1, 0x1,
+    0xB, 0xB, 0xD, 0xD, 0xB, 0xD, 0xD, 0xD, 0xB, 0xD, 0xB, 0xD, 0xD, 0x1, 0x1, 0x1,
+    0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xD, 0xB, 0xB, 0xB, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xC, 0xD, 0xB, 0xB, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0xC, 0xC, 0xC, 0xC, 0x1, 0xC, 0xC, 0xC, 0xB, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_22_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x6, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0xD, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x6, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x1, 0x1,
+    0x1, 0x1, 0xD, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xD, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x6, 0x6, 0xA, 0xD, 0xD, 0xD, 0xA, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_23_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0xD, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x6, 0x1,
+    0x6, 0x6, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x1, 0x1,
+    0x1, 0xD, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xD, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0xA, 0xD, 0xD, 0xD, 0xA, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_24_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0xD, 0x1, 0x1, 0x1, 0x6, 0xD, 0xD, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0xD, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x1, 0x1, 0x1, 0x1,
+    0x6, 0x6, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x1, 0x1,
+    0x1, 0xD, 0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x6, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xA, 0xD, 0xA, 0xA, 0xA, 0xD, 0xA, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0xA, 0xD, 0xD, 0xD, 0xA, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0xD, 0x1, 0x1, 0x1, 0x6, 0xD, 0xD, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_25_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0xD, 0x6, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0xD, 0xD, 0xD, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_26_none[] = {
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1,
+    0x1, 0xD, 0x1, 0x1, 0x1, 0x6, 0x6, 0x6, 0x6, 0x6, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x6, 0x6, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0xD, 0xD, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+    0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+};
+
+static const uint8_t px_3_none[] = {
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x8, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4,
+    0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x8, 0x8, 0x4,
+    0x4, 0x8, 0x8, 0x8, 0x8, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x8, 0x8, 0x4, 0x4, 0xA,
+    0x4, 0xA, 0x4, 0xA, 0x4, 0x4, 0x4, 0x4, 0x4, 0x8, 0x8, 0x8, 0x4, 0x4, 0xA, 0x4,
+    0xA, 0x4, 0xA, 0x4, 0x8, 0x4, 0x4, 0x4, 0x4, 0x8, 0x8, 0x8, 0x4, 0x4, 0x8, 0x8,
+    0x8, 0x8, 0x8, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x4, 0x8,
+    0x8, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+};
+
+static const uint8_t px_4_none[] = {
+    0xA, 0xD, 0xA, 0xD, 0xA, 0xD, 0xA, 0xD, 0xD, 0xD, 0xA, 0xD, 0xA, 0xD, 0xA, 0xD,
+    0xA, 0xD, 0xA, 0x6, 0x6, 0x6, 0x6, 0x6, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0x6, 0x6, 0xD, 0x6, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0x6, 0x6, 0x6, 0xD, 0x6, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0x6, 0x6,
+    0x6, 0xD, 0x6, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0x6, 0x6, 0xD, 0x6,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0x6, 0x6, 0x6,
+    0x6, 0x6, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xA, 0xD, 0xA, 0xD, 0xD, 0xA, 0xD, 0xA,
+    0xD, 0xA, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD,
+};
+
+static const uint8_t px_5_none[] = {
+    0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xA, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_6_none[] = {
+    0x6, 0x6, 0x6, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0x6, 0x6, 0x6,
+};
+
+static const uint8_t px_7_none[] = {
+    0x5, 0x5, 0x5, 0x5, 0x5, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+    0x3, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x7, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3,
+    0x5, 0x7, 0x7, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x3, 0x7, 0x3, 0x7, 0x7,
+    0x7, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x3, 0x7, 0x3, 0x7, 0x7, 0x7, 0x3,
+    0x3, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x3, 0x7, 0x3, 0x5, 0x7, 0x7, 0x3, 0x3, 0x7,
+    0x7, 0x7, 0x7, 0x3, 0x3, 0x3, 0x7, 0x3, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x7, 0x3,
+    0x7, 0x7, 0x7, 0x7, 0x7, 0x3, 0x3, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7, 0x7,
+    0x7, 0x5, 0x5, 0x5, 0x5, 0x5,
+};
+
+static const uint8_t px_8_none[] = {
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0x6, 0x6, 0xD, 0xD, 0xD, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0xD, 0xD,
+    0x6, 0x6, 0x6, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xA, 0xA, 0xD, 0xD, 0x6, 0x6, 0x6,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xA, 0xD, 0xA, 0xD, 0xA, 0xD, 0xD, 0x6, 0x6, 0x6, 0xD,
+    0xD, 0xD, 0xD, 0x6, 0x6, 0x6, 0x6, 0x6, 0x6, 0xD, 0xD, 0x6, 0x6, 0x6, 0xD, 0xD,
+    0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0xD, 0x6,
+    0x6, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+    0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA, 0xA,
+};
+
+static void k_2_none(uint16_t p) {
+    const uint8_t *s = px_2_none;
+
+    put_run(p + 675, s + 0, 1);
+    put_run(p + 678, s + 1, 4);
+    put_run(p + 684, s + 5, 1);
+    put_run(p + 898, s + 6, 2);
+    put_run(p + 901, s + 8, 6);
+    put_run(p + 908, s + 14, 2);
+    put_run(p + 1123, s + 16, 1);
+    put_run(p + 1125, s + 17, 6);
+    put_run(p + 1132, s + 23, 1);
+    put_run(p + 1347, s + 24, 10);
+    put_run(p + 1573, s + 34, 6);
+    put_run(p + 1795, s + 40, 10);
+    put_run(p + 2019, s + 50, 1);
+    put_run(p + 2021, s + 51, 6);
+    put_run(p + 2028, s + 57, 1);
+    put_run(p + 2242, s + 58, 2);
+    put_run(p + 2246, s + 60, 4);
+    put_run(p + 2252, s + 64, 2);
+    put_run(p + 2467, s + 66, 1);
+    put_run(p + 2476, s + 67, 1);
+}
+
+static void k_2_rot_right(uint16_t p) {
+    const uint8_t *s = px_2_rot_right;
+
+    put_run(p + 453, s + 0, 1);
+    put_run(p + 459, s + 1, 1);
+    put_run(p + 676, s + 2, 4);
+    put_run(p + 681, s + 6, 4);
+    put_run(p + 903, s + 10, 1);
+    put_run(p + 905, s + 11, 1);
+    put_run(p + 1126, s + 12, 6);
+    put_run(p + 1349, s + 18, 8);
+    put_run(p + 1573, s + 26, 8);
+    put_run(p + 1797, s + 34, 8);
+    put_run(p + 2021, s + 42, 8);
+    put_run(p + 2246, s + 50, 6);
+    put_run(p + 2471, s + 56, 1);
+    put_run(p + 2473, s + 57, 1);
+    put_run(p + 2692, s + 58, 4);
+    put_run(p + 2697, s + 62, 4);
+    put_run(p + 2917, s + 66, 1);
+    put_run(p + 2923, s + 67, 1);
+}
+
+static void k_2_rot_180(uint16_t p) {
+    const uint8_t *s = px_2_rot_180;
+
+    put_run(p + 899, s + 0, 1);
+    put_run(p + 908, s + 1, 1);
+    put_run(p + 1122, s + 2, 2);
+    put_run(p + 1126, s + 4, 4);
+    put_run(p + 1132, s + 8, 2);
+    put_run(p + 1347, s + 10, 1);
+    put_run(p + 1349, s + 11, 6);
+    put_run(p + 1356, s + 17, 1);
+    put_run(p + 1571, s + 18, 10);
+    put_run(p + 1797, s + 28, 6);
+    put_run(p + 2019, s + 34, 10);
+    put_run(p + 2243, s + 44, 1);
+    put_run(p + 2245, s + 45, 6);
+    put_run(p + 2252, s + 51, 1);
+    put_run(p + 2466, s + 52, 2);
+    put_run(p + 2469, s + 54, 6);
+    put_run(p + 2476, s + 60, 2);
+    put_run(p + 2691, s + 62, 1);
+    put_run(p + 2694, s + 63, 4);
+    put_run(p + 2700, s + 67, 1);
+}
+
+static void k_2_rot_left(uint16_t p) {
+    const uint8_t *s = px_2_rot_left;
+
+    put_run(p + 452, s + 0, 1);
+    put_run(p + 458, s + 1, 1);
+    put_run(p + 675, s + 2, 4);
+    put_run(p + 680, s + 6, 4);
+    put_run(p + 902, s + 10, 1);
+    put_run(p + 904, s + 11, 1);
+    put_run(p + 1124, s + 12, 6);
+    put_run(p + 1347, s + 18, 8);
+    put_run(p + 1571, s + 26, 8);
+    put_run(p + 1795, s + 34, 8);
+    put_run(p + 2019, s + 42, 8);
+    put_run(p + 2244, s + 50, 6);
+    put_run(p + 2470, s + 56, 1);
+    put_run(p + 2472, s + 57, 1);
+    put_run(p + 2691, s + 58, 4);
+    put_run(p + 2696, s + 62, 4);
+    put_run(p + 2916, s + 66, 1);
+    put_run(p + 2922, s + 67, 1);
+}
+
+static void k_0_none(uint16_t p) {
+    const uint8_t *s = px_0_none;
+
+    put_run(p + 451, s + 0, 1);
+    put_run(p + 460, s + 1, 1);
+    put_run(p + 674, s + 2, 2);
+    put_run(p + 678, s + 4, 4);
+    put_run(p + 684, s + 8, 2);
+    put_run(p + 899, s + 10, 1);
+    put_run(p + 901, s + 11, 6);
+    put_run(p + 908, s + 17, 1);
+    put_run(p + 1123, s + 18, 1);
+    put_run(p + 1125, s + 19, 6);
+    put_run(p + 1132, s + 25, 1);
+    put_run(p + 1348, s + 26, 8);
+    put_run(p + 1573, s + 34, 6);
+    put_run(p + 1797, s + 40, 6);
+    put_run(p + 2021, s + 46, 6);
+    put_run(p + 2244, s + 52, 8);
+    put_run(p + 2467, s + 60, 2);
+    put_run(p + 2475, s + 62, 2);
+    put_run(p + 2691, s + 64, 1);
+    put_run(p + 2700, s + 65, 1);
+    put_run(p + 2914, s + 66, 2);
+    put_run(p + 2924, s + 68, 2);
+    put_run(p + 3139, s + 70, 1);
+    put_run(p + 3148, s + 71, 1);
+}
+
+static void k_0_rot_right(uint16_t p) {
+    const uint8_t *s = px_0_rot_right;
+
+    put_run(p + 450, s + 0, 1);
+    put_run(p + 460, s + 1, 1);
+    put_run(p + 673, s + 2, 4);
+    put_run(p + 682, s + 6, 4);
+    put_run(p + 900, s + 10, 2);
+    put_run(p + 905, s + 12, 1);
+    put_run(p + 1125, s + 13, 7);
+    put_run(p + 1349, s + 20, 8);
+    put_run(p + 1573, s + 28, 8);
+    put_run(p + 1797, s + 36, 8);
+    put_run(p + 2021, s + 44, 8);
+    put_run(p + 2245, s + 52, 7);
+    put_run(p + 2468, s + 59, 2);
+    put_run(p + 2473, s + 61, 1);
+    put_run(p + 2689, s + 62, 4);
+    put_run(p + 2698, s + 66, 4);
+    put_run(p + 2914, s + 70, 1);
+    put_run(p + 2924, s + 71, 1);
+}
+
+static void k_0_rot_180(uint16_t p) {
+    const uint8_t *s = px_0_rot_180;
+
+    put_run(p + 227, s + 0, 1);
+    put_run(p + 236, s + 1, 1);
+    put_run(p + 450, s + 2, 2);
+    put_run(p + 460, s + 4, 2);
+    put_run(p + 675, s + 6, 1);
+    put_run(p + 684, s + 7, 1);
+    put_run(p + 899, s + 8, 2);
+    put_run(p + 907, s + 10, 2);
+    put_run(p + 1124, s + 12, 8);
+    put_run(p + 1349, s + 20, 6);
+    put_run(p + 1573, s + 26, 6);
+    put_run(p + 1797, s + 32, 6);
+    put_run(p + 2020, s + 38, 8);
+    put_run(p + 2243, s + 46, 1);
+    put_run(p + 2245, s + 47, 6);
+    put_run(p + 2252, s + 53, 1);
+    put_run(p + 2467, s + 54, 1);
+    put_run(p + 2469, s + 55, 6);
+    put_run(p + 2476, s + 61, 1);
+    put_run(p + 2690, s + 62, 2);
+    put_run(p + 2694, s + 64, 4);
+    put_run(p + 2700, s + 68, 2);
+    put_run(p + 2915, s + 70, 1);
+    put_run(p + 2924, s + 71, 1);
+}
+
+static void k_0_rot_left(uint16_t p) {
+    const uint8_t *s = px_0_rot_left;
+
+    put_run(p + 451, s + 0, 1);
+    put_run(p + 461, s + 1, 1);
+    put_run(p + 674, s + 2, 4);
+    put_run(p + 683, s + 6, 4);
+    put_run(p + 902, s + 10, 1);
+    put_run(p + 906, s + 11, 2);
+    put_run(p + 1124, s + 13, 7);
+    put_run(p + 1347, s + 20, 8);
+    put_run(p + 1571, s + 28, 8);
+    put_run(p + 1795, s + 36, 8);
+    put_run(p + 2019, s + 44, 8);
+    put_run(p + 2244, s + 52, 7);
+    put_run(p + 2470, s + 59, 1);
+    put_run(p + 2474, s + 60, 2);
+    put_run(p + 2690, s + 62, 4);
+    put_run(p + 2699, s + 66, 4);
+    put_run(p + 2915, s + 70, 1);
+    put_run(p + 2925, s + 71, 1);
+}
+
+static void k_15_none(uint16_t p) {
+    const uint8_t *s = px_15_none;
+
+    put_run(p + 6, s + 0, 5);
+    put_run(p + 229, s + 5, 7);
+    put_run(p + 452, s + 12, 2);
+    put_run(p + 455, s + 14, 3);
+    put_run(p + 459, s + 17, 2);
+    put_run(p + 676, s + 19, 1);
+    put_run(p + 678, s + 20, 5);
+    put_run(p + 684, s + 25, 1);
+    put_run(p + 897, s + 26, 2);
+    put_run(p + 900, s + 28, 9);
+    put_run(p + 910, s + 37, 2);
+    put_run(p + 1121, s + 39, 2);
+    put_run(p + 1126, s + 41, 5);
+    put_run(p + 1134, s + 46, 2);
+    put_run(p + 1348, s + 48, 1);
+    put_run(p + 1356, s + 49, 1);
+    put_run(p + 1571, s + 50, 1);
+    put_run(p + 1575, s + 51, 3);
+    put_run(p + 1581, s + 54, 1);
+    put_run(p + 1797, s + 55, 1);
+    put_run(p + 1803, s + 56, 1);
+    put_run(p + 2022, s + 57, 1);
+    put_run(p + 2026, s + 58, 1);
+    put_run(p + 2247, s + 59, 1);
+    put_run(p + 2249, s + 60, 1);
+    put_run(p + 2472, s + 61, 1);
+    put_run(p + 2695, s + 62, 1);
+    put_run(p + 2697, s + 63, 1);
+    put_run(p + 2918, s + 64, 1);
+    put_run(p + 2922, s + 65, 1);
+    put_run(p + 3140, s + 66, 2);
+    put_run(p + 3147, s + 68, 2);
+    put_run(p + 3364, s + 70, 2);
+    put_run(p + 3371, s + 72, 2);
+}
+
+static void k_29_none(uint16_t p) {
+    const uint8_t *s = px_29_none;
+
+    put_run(p + 904, s + 0, 4);
+    put_run(p + 1127, s + 4, 4);
+    put_run(p + 1348, s + 8, 2);
+    put_run(p + 1351, s + 10, 5);
+    put_run(p + 1572, s + 15, 9);
+    put_run(p + 1795, s + 24, 11);
+    put_run(p + 2020, s + 35, 9);
+    put_run(p + 2244, s + 44, 2);
+    put_run(p + 2247, s + 46, 5);
+    put_run(p + 2471, s + 51, 4);
+    put_run(p + 2696, s + 55, 4);
+}
+
+static void k_30_none(uint16_t p) {
+    const uint8_t *s = px_30_none;
+
+    put_run(p + 3, s + 0, 2);
+    put_run(p + 11, s + 2, 2);
+    put_run(p + 226, s + 4, 1);
+    put_run(p + 229, s + 5, 1);
+    put_run(p + 234, s + 6, 1);
+    put_run(p + 237, s + 7, 1);
+    put_run(p + 450, s + 8, 12);
+    put_run(p + 675, s + 20, 10);
+    put_run(p + 901, s + 30, 6);
+    put_run(p + 1124, s + 36, 8);
+    put_run(p + 1345, s + 44, 1);
+    put_run(p + 1348, s + 45, 8);
+    put_run(p + 1358, s + 53, 1);
+    put_run(p + 1568, s + 54, 3);
+    put_run(p + 1572, s + 57, 8);
+    put_run(p + 1581, s + 65, 3);
+    put_run(p + 1792, s + 68, 16);
+    put_run(p + 2016, s + 84, 16);
+    put_run(p + 2240, s + 100, 16);
+    put_run(p + 2465, s + 116, 14);
+    put_run(p + 2689, s + 130, 14);
+    put_run(p + 2915, s + 144, 10);
+    put_run(p + 3138, s + 154, 4);
+    put_run(p + 3146, s + 158, 4);
+    put_run(p + 3361, s + 162, 3);
+    put_run(p + 3365, s + 165, 1);
+    put_run(p + 3370, s + 166, 1);
+    put_run(p + 3372, s + 167, 3);
+}
+
+static void k_31_none(uint16_t p) {
+    const uint8_t *s = px_31_none;
+
+    put_run(p + 3, s + 0, 2);
+    put_run(p + 11, s + 2, 2);
+    put_run(p + 226, s + 4, 1);
+    put_run(p + 229, s + 5, 1);
+    put_run(p + 234, s + 6, 4);
+    put_run(p + 450, s + 10, 12);
+    put_run(p + 675, s + 22, 10);
+    put_run(p + 901, s + 32, 6);
+    put_run(p + 1124, s + 38, 8);
+    put_run(p + 1345, s + 46, 1);
+    put_run(p + 1348, s + 47, 8);
+    put_run(p + 1358, s + 55, 1);
+    put_run(p + 1568, s + 56, 3);
+    put_run(p + 1572, s + 59, 8);
+    put_run(p + 1581, s + 67, 3);
+    put_run(p + 1792, s + 70, 16);
+    put_run(p + 2016, s + 86, 16);
+    put_run(p + 2240, s + 102, 16);
+    put_run(p + 2465, s + 118, 14);
+    put_run(p + 2689, s + 132, 14);
+    put_run(p + 2915, s + 146, 10);
+    put_run(p + 3138, s + 156, 4);
+    put_run(p + 3146, s + 160, 4);
+    put_run(p + 3361, s + 164, 3);
+    put_run(p + 3365, s + 167, 1);
+    put_run(p + 3370, s + 168, 1);
+    put_run(p + 3372, s + 169, 3);
+}
+
+static void k_46_none(uint16_t p) {
+    const uint8_t *s = px_46_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_47_none(uint16_t p) {
+    const uint8_t *s = px_47_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_48_none(uint16_t p) {
+    const uint8_t *s = px_48_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_22_none(uint16_t p) {
+    const uint8_t *s = px_22_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_23_none(uint16_t p) {
+    const uint8_t *s = px_23_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_24_none(uint16_t p) {
+    const uint8_t *s = px_24_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_25_none(uint16_t p) {
+    const uint8_t *s = px_25_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_26_none(uint16_t p) {
+    const uint8_t *s = px_26_none;
+
+    put_run(p + 0, s + 0, 16);
+    put_run(p + 224, s + 16, 16);
+    put_run(p + 448, s + 32, 16);
+    put_run(p + 672, s + 48, 16);
+    put_run(p + 896, s + 64, 16);
+    put_run(p + 1120, s + 80, 16);
+    put_run(p + 1344, s + 96, 16);
+    put_run(p + 1568, s + 112, 16);
+    put_run(p + 1792, s + 128, 16);
+    put_run(p + 2016, s + 144, 16);
+    put_run(p + 2240, s + 160, 16);
+    put_run(p + 2464, s + 176, 16);
+    put_run(p + 2688, s + 192, 16);
+    put_run(p + 2912, s + 208, 16);
+    put_run(p + 3136, s + 224, 16);
+    put_run(p + 3360, s + 240, 16);
+}
+
+static void k_3_none(uint16_t p) {
+    const uint8_t *s = px_3_none;
+
+    put_run(p + 235, s + 0, 5);
+    put_run(p + 451, s + 5, 5);
+    put_run(p + 459, s + 10, 5);
+    put_run(p + 675, s + 15, 5);
+    put_run(p + 683, s + 20, 5);
+    put_run(p + 901, s + 25, 1);
+    put_run(p + 909, s + 26, 1);
+    put_run(p + 1123, s + 27, 12);
+    put_run(p + 1344, s + 39, 1);
+    put_run(p + 1346, s + 40, 14);
+    put_run(p + 1569, s + 54, 15);
+    put_run(p + 1793, s + 69, 15);
+    put_run(p + 2016, s + 84, 1);
+    put_run(p + 2018, s + 85, 14);
+    put_run(p + 2243, s + 99, 12);
+    put_run(p + 2469, s + 111, 1);
+    put_run(p + 2477, s + 112, 1);
+    put_run(p + 2691, s + 113, 5);
+    put_run(p + 2699, s + 118, 5);
+    put_run(p + 2915, s + 123, 5);
+    put_run(p + 2923, s + 128, 5);
+    put_run(p + 3147, s + 133, 5);
+}
+
+static void k_4_none(uint16_t p) {
+    const uint8_t *s = px_4_none;
+
+    put_run(p + 449, s + 0, 7);
+    put_run(p + 460, s + 7, 3);
+    put_run(p + 673, s + 10, 7);
+    put_run(p + 684, s + 17, 2);
+    put_run(p + 898, s + 19, 1);
+    put_run(p + 902, s + 20, 1);
+    put_run(p + 905, s + 21, 6);
+    put_run(p + 1122, s + 27, 8);
+    put_run(p + 1132, s + 35, 2);
+    put_run(p + 1345, s + 37, 9);
+    put_run(p + 1356, s + 46, 3);
+    put_run(p + 1569, s + 49, 9);
+    put_run(p + 1580, s + 58, 2);
+    put_run(p + 1793, s + 60, 9);
+    put_run(p + 1804, s + 69, 2);
+    put_run(p + 2017, s + 71, 9);
+    put_run(p + 2028, s + 80, 3);
+    put_run(p + 2242, s + 83, 8);
+    put_run(p + 2252, s + 91, 2);
+    put_run(p + 2466, s + 93, 1);
+    put_run(p + 2470, s + 94, 1);
+    put_run(p + 2473, s + 95, 6);
+    put_run(p + 2689, s + 101, 7);
+    put_run(p + 2700, s + 108, 2);
+    put_run(p + 2913, s + 110, 7);
+    put_run(p + 2924, s + 117, 3);
+}
+
+static void k_5_none(uint16_t p) {
+    const uint8_t *s = px_5_none;
+
+    put_run(p + 678, s + 0, 3);
+    put_run(p + 683, s + 3, 4);
+    put_run(p + 900, s + 7, 5);
+    put_run(p + 906, s + 12, 6);
+    put_run(p + 1123, s + 18, 6);
+    put_run(p + 1130, s + 24, 6);
+    put_run(p + 1347, s + 30, 13);
+    put_run(p + 1571, s + 43, 13);
+    put_run(p + 1795, s + 56, 13);
+    put_run(p + 2019, s + 69, 13);
+    put_run(p + 2243, s + 82, 6);
+    put_run(p + 2250, s + 88, 6);
+    put_run(p + 2468, s + 94, 5);
+    put_run(p + 2474, s + 99, 6);
+    put_run(p + 2694, s + 105, 3);
+    put_run(p + 2699, s + 108, 3);
+}
+
+static void k_6_none(uint16_t p) {
+    const uint8_t *s = px_6_none;
+
+    put_run(p + 682, s + 0, 3);
+    put_run(p + 896, s + 3, 14);
+    put_run(p + 1120, s + 17, 14);
+    put_run(p + 1344, s + 31, 14);
+    put_run(p + 1568, s + 45, 14);
+    put_run(p + 1792, s + 59, 14);
+    put_run(p + 2016, s + 73, 14);
+    put_run(p + 2240, s + 87, 14);
+    put_run(p + 2464, s + 101, 14);
+    put_run(p + 2698, s + 115, 3);
+}
+
+static void k_7_none(uint16_t p) {
+    const uint8_t *s = px_7_none;
+
+    put_run(p + 676, s + 0, 2);
+    put_run(p + 683, s + 2, 3);
+    put_run(p + 898, s + 5, 6);
+    put_run(p + 906, s + 11, 5);
+    put_run(p + 1121, s + 16, 15);
+    put_run(p + 1345, s + 31, 14);
+    put_run(p + 1569, s + 45, 14);
+    put_run(p + 1793, s + 59, 14);
+    put_run(p + 2017, s + 73, 14);
+    put_run(p + 2241, s + 87, 15);
+    put_run(p + 2466, s + 102, 6);
+    put_run(p + 2474, s + 108, 5);
+    put_run(p + 2692, s + 113, 2);
+    put_run(p + 2699, s + 115, 3);
+}
+
+static void k_8_none(uint16_t p) {
+    const uint8_t *s = px_8_none;
+
+    put_run(p + 225, s + 0, 5);
+    put_run(p + 449, s + 5, 5);
+    put_run(p + 457, s + 10, 5);
+    put_run(p + 673, s + 15, 5);
+    put_run(p + 681, s + 20, 5);
+    put_run(p + 899, s + 25, 1);
+    put_run(p + 907, s + 26, 1);
+    put_run(p + 1121, s + 27, 13);
+    put_run(p + 1344, s + 40, 15);
+    put_run(p + 1570, s + 55, 3);
+    put_run(p + 1574, s + 58, 10);
+    put_run(p + 1793, s + 68, 15);
+    put_run(p + 2016, s + 83, 15);
+    put_run(p + 2241, s + 98, 13);
+    put_run(p + 2467, s + 111, 1);
+    put_run(p + 2475, s + 112, 1);
+    put_run(p + 2689, s + 113, 5);
+    put_run(p + 2697, s + 118, 5);
+    put_run(p + 2913, s + 123, 5);
+    put_run(p + 2921, s + 128, 5);
+    put_run(p + 3137, s + 133, 5);
+}
+
+static void (*const sprite_kernels[NUM_SPRITES][6])(uint16_t) = {
+    [2][0] = k_2_none,
+    [2][5] = k_2_rot_right,
+    [2][3] = k_2_rot_180,
+    [2][4] = k_2_rot_left,
+    [0][0] = k_0_none,
+    [0][5] = k_0_rot_right,
+    [0][3] = k_0_rot_180,
+    [0][4] = k_0_rot_left,
+    [15][0] = k_15_none,
+    [29][0] = k_29_none,
+    [30][0] = k_30_none,
+    [31][0] = k_31_none,
+    [46][0] = k_46_none,
+    [47][0] = k_47_none,
+    [48][0] = k_48_none,
+    [22][0] = k_22_none,
+    [23][0] = k_23_none,
+    [24][0] = k_24_none,
+    [25][0] = k_25_none,
+    [26][0] = k_26_none,
+    [3][0] = k_3_none,
+    [4][0] = k_4_none,
+    [5][0] = k_5_none,
+    [6][0] = k_6_none,
+    [7][0] = k_7_none,
+    [8][0] = k_8_none,
+};
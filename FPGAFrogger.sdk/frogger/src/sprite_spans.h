@@ -0,0 +1,415 @@
+// Auto-generated by frogger_host/spangen from sprites.h, do not edit.
+//
+// sprites[] as colour spans, see spangen.c for the format.
+#pragma once
+#include <stdint.h>
+
+#define SPRITE_SPANS 2125
+#define SPRITE_SPAN_BYTES 5222   // sprite_span_start[] and sprite_span_data[]
+
+static const uint16_t sprite_span_start[54] = {
+    0, 104, 208, 308, 412, 572, 652, 688, 804, 900, 1004, 1108,
+    1208, 1312, 1416, 1516, 1600, 1664, 1756, 1816, 1930, 2066, 2206, 2330,
+    2476, 2630, 2742, 2860, 2938, 3018, 3076, 3212, 3350, 3402, 3494, 3564,
+    3660, 3758, 3826, 3886, 3966, 4036, 4086, 4144, 4188, 4238, 4286, 4398,
+    4492, 4634, 4712, 4822, 4938, 5038,
+};
+
+static const uint8_t sprite_span_data[5114] = {
+  /* sprite  0 */
+    0x00, 0x00, 0x02, 0x30, 0x06, 0x80, 0x06, 0x05, 0x21, 0x06, 0x20, 0x04, 0x00, 0x06, 0x01, 0x04,
+    0x21, 0x06, 0x07, 0x30, 0x06, 0x10, 0x07, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x00, 0x07, 0x10,
+    0x06, 0x05, 0x30, 0x06, 0x11, 0x06, 0x01, 0x04, 0x01, 0x06, 0x10, 0x06, 0x03, 0x40, 0x06, 0x05,
+    0x04, 0x00, 0x06, 0x03, 0x50, 0x04, 0x00, 0x06, 0x03, 0x04, 0x03, 0x50, 0x04, 0x00, 0x06, 0x03,
+    0x04, 0x05, 0x50, 0x06, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x03, 0x42, 0x06, 0x01,
+    0x04, 0x02, 0x06, 0x02, 0x31, 0x06, 0x61, 0x06, 0x02, 0x30, 0x06, 0x80, 0x06, 0x02, 0x21, 0x06,
+    0x81, 0x06, 0x02, 0x30, 0x06, 0x80, 0x06, 0x00,
+  /* sprite  1 */
+    0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x05, 0x31, 0x06, 0x10, 0x04, 0x00, 0x06, 0x01, 0x04,
+    0x11, 0x06, 0x07, 0x40, 0x06, 0x00, 0x07, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x00, 0x07, 0x00,
+    0x06, 0x03, 0x42, 0x06, 0x01, 0x04, 0x02, 0x06, 0x03, 0x40, 0x06, 0x05, 0x04, 0x00, 0x06, 0x03,
+    0x50, 0x04, 0x00, 0x06, 0x03, 0x04, 0x03, 0x50, 0x04, 0x00, 0x06, 0x03, 0x04, 0x05, 0x50, 0x06,
+    0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x03, 0x42, 0x06, 0x01, 0x04, 0x02, 0x06, 0x02,
+    0x31, 0x06, 0x61, 0x06, 0x02, 0x41, 0x06, 0x41, 0x06, 0x02, 0x50, 0x06, 0x40, 0x06, 0x02, 0x60,
+    0x06, 0x20, 0x06, 0x02, 0x60, 0x06, 0x20, 0x06,
+  /* sprite  2 */
+    0x00, 0x00, 0x00, 0x05, 0x30, 0x06, 0x20, 0x04, 0x00, 0x06, 0x01, 0x04, 0x20, 0x06, 0x07, 0x21,
+    0x06, 0x10, 0x07, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x00, 0x07, 0x11, 0x06, 0x05, 0x30, 0x06,
+    0x11, 0x06, 0x01, 0x04, 0x01, 0x06, 0x10, 0x06, 0x03, 0x31, 0x06, 0x05, 0x04, 0x01, 0x06, 0x03,
+    0x50, 0x04, 0x00, 0x06, 0x03, 0x04, 0x05, 0x31, 0x06, 0x00, 0x04, 0x00, 0x06, 0x03, 0x04, 0x01,
+    0x06, 0x07, 0x30, 0x06, 0x10, 0x06, 0x00, 0x04, 0x00, 0x06, 0x01, 0x04, 0x00, 0x06, 0x10, 0x06,
+    0x05, 0x21, 0x06, 0x20, 0x06, 0x01, 0x04, 0x00, 0x06, 0x21, 0x06, 0x02, 0x30, 0x06, 0x80, 0x06,
+    0x00, 0x00, 0x00, 0x00,
+  /* sprite  3 */
+    0x00, 0x01, 0xB4, 0x0A, 0x02, 0x34, 0x0A, 0x34, 0x0A, 0x02, 0x34, 0x0A, 0x34, 0x0A, 0x02, 0x50,
+    0x08, 0x70, 0x08, 0x01, 0x3B, 0x04, 0x05, 0x00, 0x08, 0x13, 0x04, 0x02, 0x08, 0x01, 0x04, 0x04,
+    0x08, 0x09, 0x13, 0x04, 0x02, 0x08, 0x01, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x04,
+    0x00, 0x0A, 0x00, 0x04, 0x09, 0x13, 0x04, 0x02, 0x08, 0x01, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00,
+    0x0A, 0x00, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x05, 0x00, 0x08, 0x13, 0x04, 0x02, 0x08, 0x01, 0x04,
+    0x04, 0x08, 0x01, 0x3B, 0x04, 0x02, 0x50, 0x08, 0x70, 0x08, 0x02, 0x34, 0x0A, 0x34, 0x0A, 0x02,
+    0x34, 0x0A, 0x34, 0x0A, 0x01, 0xB4, 0x0A, 0x00,
+  /* sprite  4 */
+    0x00, 0x00, 0x08, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00,
+    0x0A, 0x42, 0x0D, 0x09, 0x10, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D,
+    0x00, 0x0A, 0x40, 0x0D, 0x00, 0x0A, 0x04, 0x20, 0x06, 0x30, 0x06, 0x22, 0x06, 0x02, 0x0D, 0x03,
+    0x27, 0x0D, 0x20, 0x0D, 0x00, 0x0A, 0x05, 0x14, 0x0D, 0x01, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x22,
+    0x0D, 0x07, 0x11, 0x0D, 0x02, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x01, 0x0D, 0x20, 0x0D, 0x00, 0x0A,
+    0x07, 0x11, 0x0D, 0x02, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x01, 0x0D, 0x20, 0x0D, 0x00, 0x0A, 0x05,
+    0x14, 0x0D, 0x01, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x22, 0x0D, 0x03, 0x27, 0x0D, 0x20, 0x0D, 0x00,
+    0x0A, 0x04, 0x20, 0x06, 0x30, 0x06, 0x22, 0x06, 0x02, 0x0D, 0x09, 0x10, 0x0D, 0x00, 0x0A, 0x00,
+    0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x40, 0x0D, 0x00, 0x0A, 0x08, 0x10, 0x0D,
+    0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x42, 0x0D, 0x00, 0x00,
+  /* sprite  5 */
+    0x00, 0x00, 0x00, 0x02, 0x62, 0x06, 0x23, 0x06, 0x03, 0x40, 0x0A, 0x03, 0x0D, 0x15, 0x0D, 0x03,
+    0x30, 0x0A, 0x04, 0x0D, 0x15, 0x0D, 0x04, 0x30, 0x0A, 0x04, 0x0D, 0x00, 0x0A, 0x05, 0x0D, 0x04,
+    0x30, 0x0A, 0x04, 0x0D, 0x00, 0x0A, 0x05, 0x0D, 0x04, 0x30, 0x0A, 0x04, 0x0D, 0x00, 0x0A, 0x05,
+    0x0D, 0x04, 0x30, 0x0A, 0x04, 0x0D, 0x00, 0x0A, 0x05, 0x0D, 0x03, 0x30, 0x0A, 0x04, 0x0D, 0x15,
+    0x0D, 0x03, 0x40, 0x0A, 0x03, 0x0D, 0x15, 0x0D, 0x02, 0x62, 0x06, 0x22, 0x06, 0x00, 0x00, 0x00,
+  /* sprite  6 */
+    0x00, 0x00, 0x00, 0x01, 0xA2, 0x06, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01,
+    0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0x0D, 0x0D, 0x01, 0xA2,
+    0x06, 0x00, 0x00, 0x00,
+  /* sprite  7 */
+    0x00, 0x00, 0x00, 0x02, 0x41, 0x05, 0x52, 0x05, 0x03, 0x20, 0x03, 0x04, 0x07, 0x24, 0x07, 0x07,
+    0x10, 0x03, 0x03, 0x07, 0x01, 0x03, 0x00, 0x07, 0x00, 0x03, 0x04, 0x07, 0x00, 0x03, 0x07, 0x10,
+    0x03, 0x00, 0x05, 0x01, 0x07, 0x01, 0x03, 0x03, 0x07, 0x02, 0x03, 0x00, 0x07, 0x06, 0x10, 0x03,
+    0x02, 0x07, 0x01, 0x03, 0x03, 0x07, 0x02, 0x03, 0x00, 0x07, 0x06, 0x10, 0x03, 0x02, 0x07, 0x01,
+    0x03, 0x03, 0x07, 0x02, 0x03, 0x00, 0x07, 0x07, 0x10, 0x03, 0x00, 0x05, 0x01, 0x07, 0x01, 0x03,
+    0x03, 0x07, 0x02, 0x03, 0x00, 0x07, 0x07, 0x10, 0x03, 0x03, 0x07, 0x01, 0x03, 0x00, 0x07, 0x00,
+    0x03, 0x04, 0x07, 0x00, 0x03, 0x03, 0x20, 0x03, 0x04, 0x07, 0x24, 0x07, 0x02, 0x41, 0x05, 0x52,
+    0x05, 0x00, 0x00, 0x00,
+  /* sprite  8 */
+    0x00, 0x01, 0x14, 0x0A, 0x02, 0x14, 0x0A, 0x34, 0x0A, 0x02, 0x14, 0x0A, 0x34, 0x0A, 0x02, 0x30,
+    0x06, 0x70, 0x06, 0x01, 0x1C, 0x0D, 0x04, 0x05, 0x06, 0x01, 0x0D, 0x02, 0x06, 0x03, 0x0D, 0x07,
+    0x20, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x10, 0x0A, 0x01, 0x0D, 0x02, 0x06, 0x03, 0x0D, 0x09, 0x10,
+    0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x01, 0x0D, 0x02, 0x06, 0x03,
+    0x0D, 0x04, 0x05, 0x06, 0x01, 0x0D, 0x02, 0x06, 0x03, 0x0D, 0x01, 0x1C, 0x0D, 0x02, 0x30, 0x06,
+    0x70, 0x06, 0x02, 0x14, 0x0A, 0x34, 0x0A, 0x02, 0x14, 0x0A, 0x34, 0x0A, 0x01, 0x14, 0x0A, 0x00,
+  /* sprite  9 */
+    0x00, 0x00, 0x02, 0x30, 0x03, 0x80, 0x03, 0x05, 0x21, 0x03, 0x20, 0x07, 0x00, 0x03, 0x01, 0x07,
+    0x21, 0x03, 0x07, 0x30, 0x03, 0x10, 0x05, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x00, 0x05, 0x10,
+    0x03, 0x05, 0x30, 0x03, 0x11, 0x03, 0x01, 0x07, 0x01, 0x03, 0x10, 0x03, 0x03, 0x40, 0x03, 0x05,
+    0x07, 0x00, 0x03, 0x03, 0x50, 0x07, 0x00, 0x03, 0x03, 0x07, 0x03, 0x50, 0x07, 0x00, 0x03, 0x03,
+    0x07, 0x05, 0x50, 0x03, 0x00, 0x07, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x03, 0x42, 0x03, 0x01,
+    0x07, 0x02, 0x03, 0x02, 0x31, 0x03, 0x61, 0x03, 0x02, 0x30, 0x03, 0x80, 0x03, 0x02, 0x21, 0x03,
+    0x81, 0x03, 0x02, 0x30, 0x03, 0x80, 0x03, 0x00,
+  /* sprite 10 */
+    0x00, 0x00, 0x02, 0x40, 0x03, 0x60, 0x03, 0x05, 0x31, 0x03, 0x10, 0x07, 0x00, 0x03, 0x01, 0x07,
+    0x11, 0x03, 0x07, 0x40, 0x03, 0x00, 0x05, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x00, 0x05, 0x00,
+    0x03, 0x03, 0x42, 0x03, 0x01, 0x07, 0x02, 0x03, 0x03, 0x40, 0x03, 0x05, 0x07, 0x00, 0x03, 0x03,
+    0x50, 0x07, 0x00, 0x03, 0x03, 0x07, 0x03, 0x50, 0x07, 0x00, 0x03, 0x03, 0x07, 0x05, 0x50, 0x03,
+    0x00, 0x07, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x03, 0x42, 0x03, 0x01, 0x07, 0x02, 0x03, 0x02,
+    0x31, 0x03, 0x61, 0x03, 0x02, 0x41, 0x03, 0x41, 0x03, 0x02, 0x50, 0x03, 0x40, 0x03, 0x02, 0x60,
+    0x03, 0x20, 0x03, 0x02, 0x60, 0x03, 0x20, 0x03,
+  /* sprite 11 */
+    0x00, 0x00, 0x00, 0x05, 0x30, 0x03, 0x20, 0x07, 0x00, 0x03, 0x01, 0x07, 0x20, 0x03, 0x07, 0x21,
+    0x03, 0x10, 0x05, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x00, 0x05, 0x11, 0x03, 0x05, 0x30, 0x03,
+    0x11, 0x03, 0x01, 0x07, 0x01, 0x03, 0x10, 0x03, 0x03, 0x31, 0x03, 0x05, 0x07, 0x01, 0x03, 0x03,
+    0x50, 0x07, 0x00, 0x03, 0x03, 0x07, 0x05, 0x31, 0x03, 0x00, 0x07, 0x00, 0x03, 0x03, 0x07, 0x01,
+    0x03, 0x07, 0x30, 0x03, 0x10, 0x03, 0x00, 0x07, 0x00, 0x03, 0x01, 0x07, 0x00, 0x03, 0x10, 0x03,
+    0x05, 0x21, 0x03, 0x20, 0x03, 0x01, 0x07, 0x00, 0x03, 0x21, 0x03, 0x02, 0x30, 0x03, 0x80, 0x03,
+    0x00, 0x00, 0x00, 0x00,
+  /* sprite 12 */
+    0x00, 0x00, 0x02, 0x30, 0x04, 0x80, 0x04, 0x05, 0x21, 0x04, 0x20, 0x08, 0x00, 0x04, 0x01, 0x08,
+    0x21, 0x04, 0x07, 0x30, 0x04, 0x10, 0x0A, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x00, 0x0A, 0x10,
+    0x04, 0x05, 0x30, 0x04, 0x11, 0x04, 0x01, 0x08, 0x01, 0x04, 0x10, 0x04, 0x03, 0x40, 0x04, 0x05,
+    0x08, 0x00, 0x04, 0x03, 0x50, 0x08, 0x00, 0x04, 0x03, 0x08, 0x03, 0x50, 0x08, 0x00, 0x04, 0x03,
+    0x08, 0x05, 0x50, 0x04, 0x00, 0x08, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x03, 0x42, 0x04, 0x01,
+    0x08, 0x02, 0x04, 0x02, 0x31, 0x04, 0x61, 0x04, 0x02, 0x30, 0x04, 0x80, 0x04, 0x02, 0x21, 0x04,
+    0x81, 0x04, 0x02, 0x30, 0x04, 0x80, 0x04, 0x00,
+  /* sprite 13 */
+    0x00, 0x00, 0x02, 0x40, 0x04, 0x60, 0x04, 0x05, 0x31, 0x04, 0x10, 0x08, 0x00, 0x04, 0x01, 0x08,
+    0x11, 0x04, 0x07, 0x40, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x00, 0x0A, 0x00,
+    0x04, 0x03, 0x42, 0x04, 0x01, 0x08, 0x02, 0x04, 0x03, 0x40, 0x04, 0x05, 0x08, 0x00, 0x04, 0x03,
+    0x50, 0x08, 0x00, 0x04, 0x03, 0x08, 0x03, 0x50, 0x08, 0x00, 0x04, 0x03, 0x08, 0x05, 0x50, 0x04,
+    0x00, 0x08, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x03, 0x42, 0x04, 0x01, 0x08, 0x02, 0x04, 0x02,
+    0x31, 0x04, 0x61, 0x04, 0x02, 0x41, 0x04, 0x41, 0x04, 0x02, 0x50, 0x04, 0x40, 0x04, 0x02, 0x60,
+    0x04, 0x20, 0x04, 0x02, 0x60, 0x04, 0x20, 0x04,
+  /* sprite 14 */
+    0x00, 0x00, 0x00, 0x05, 0x30, 0x04, 0x20, 0x08, 0x00, 0x04, 0x01, 0x08, 0x20, 0x04, 0x07, 0x21,
+    0x04, 0x10, 0x0A, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x00, 0x0A, 0x11, 0x04, 0x05, 0x30, 0x04,
+    0x11, 0x04, 0x01, 0x08, 0x01, 0x04, 0x10, 0x04, 0x03, 0x31, 0x04, 0x05, 0x08, 0x01, 0x04, 0x03,
+    0x50, 0x08, 0x00, 0x04, 0x03, 0x08, 0x05, 0x31, 0x04, 0x00, 0x08, 0x00, 0x04, 0x03, 0x08, 0x01,
+    0x04, 0x07, 0x30, 0x04, 0x10, 0x04, 0x00, 0x08, 0x00, 0x04, 0x01, 0x08, 0x00, 0x04, 0x10, 0x04,
+    0x05, 0x21, 0x04, 0x20, 0x04, 0x01, 0x08, 0x00, 0x04, 0x21, 0x04, 0x02, 0x30, 0x04, 0x80, 0x04,
+    0x00, 0x00, 0x00, 0x00,
+  /* sprite 15 */
+    0x01, 0x64, 0x04, 0x01, 0x56, 0x04, 0x03, 0x41, 0x04, 0x12, 0x04, 0x11, 0x04, 0x03, 0x40, 0x04,
+    0x14, 0x04, 0x10, 0x04, 0x03, 0x11, 0x04, 0x18, 0x04, 0x11, 0x04, 0x03, 0x11, 0x04, 0x34, 0x04,
+    0x31, 0x04, 0x02, 0x40, 0x04, 0x70, 0x04, 0x03, 0x30, 0x04, 0x32, 0x04, 0x30, 0x04, 0x02, 0x50,
+    0x04, 0x50, 0x04, 0x02, 0x60, 0x04, 0x30, 0x04, 0x02, 0x70, 0x04, 0x10, 0x04, 0x01, 0x80, 0x04,
+    0x02, 0x70, 0x04, 0x10, 0x04, 0x02, 0x60, 0x04, 0x30, 0x04, 0x02, 0x41, 0x04, 0x51, 0x04, 0x02,
+    0x41, 0x04, 0x51, 0x04,
+  /* sprite 16 */
+    0x00, 0x00, 0x02, 0x60, 0x04, 0x20, 0x04, 0x02, 0x40, 0x04, 0x60, 0x04, 0x03, 0x30, 0x04, 0x31,
+    0x08, 0x30, 0x04, 0x01, 0x55, 0x08, 0x03, 0x20, 0x04, 0x25, 0x08, 0x20, 0x04, 0x01, 0x47, 0x08,
+    0x01, 0x47, 0x08, 0x03, 0x20, 0x04, 0x25, 0x08, 0x20, 0x04, 0x01, 0x55, 0x08, 0x03, 0x30, 0x04,
+    0x31, 0x08, 0x30, 0x04, 0x02, 0x40, 0x04, 0x60, 0x04, 0x02, 0x60, 0x04, 0x20, 0x04, 0x00, 0x00,
+  /* sprite 17 */
+    0x00, 0x03, 0x50, 0x04, 0x11, 0x04, 0x10, 0x04, 0x02, 0x30, 0x04, 0x80, 0x04, 0x02, 0x20, 0x04,
+    0xA0, 0x04, 0x01, 0x71, 0x04, 0x05, 0x20, 0x04, 0x20, 0x04, 0x11, 0x08, 0x10, 0x04, 0x20, 0x04,
+    0x01, 0x63, 0x08, 0x05, 0x10, 0x04, 0x20, 0x04, 0x05, 0x08, 0x00, 0x04, 0x20, 0x04, 0x05, 0x10,
+    0x04, 0x20, 0x04, 0x05, 0x08, 0x00, 0x04, 0x20, 0x04, 0x01, 0x63, 0x08, 0x05, 0x20, 0x04, 0x20,
+    0x04, 0x11, 0x08, 0x10, 0x04, 0x20, 0x04, 0x01, 0x71, 0x04, 0x02, 0x20, 0x04, 0xA0, 0x04, 0x02,
+    0x30, 0x04, 0x80, 0x04, 0x03, 0x50, 0x04, 0x11, 0x04, 0x10, 0x04, 0x00,
+  /* sprite 18 */
+    0x02, 0x60, 0x04, 0x20, 0x04, 0x00, 0x02, 0x20, 0x04, 0xA0, 0x04, 0x00, 0x02, 0x60, 0x04, 0x20,
+    0x04, 0x00, 0x04, 0x00, 0x04, 0x30, 0x04, 0x60, 0x04, 0x30, 0x04, 0x01, 0x71, 0x08, 0x01, 0x71,
+    0x08, 0x04, 0x00, 0x04, 0x30, 0x04, 0x60, 0x04, 0x30, 0x04, 0x00, 0x02, 0x60, 0x04, 0x20, 0x04,
+    0x00, 0x02, 0x20, 0x04, 0xA0, 0x04, 0x00, 0x02, 0x60, 0x04, 0x20, 0x04,
+  /* sprite 19 */
+    0x00, 0x02, 0x40, 0x04, 0x60, 0x04, 0x02, 0x32, 0x04, 0x42, 0x04, 0x03, 0x22, 0x04, 0x05, 0x08,
+    0x02, 0x04, 0x07, 0x30, 0x04, 0x00, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x00, 0x08, 0x00,
+    0x04, 0x05, 0x40, 0x08, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x0A, 0x00, 0x08, 0x05, 0x30, 0x08, 0x02,
+    0x04, 0x01, 0x08, 0x02, 0x04, 0x00, 0x08, 0x05, 0x30, 0x08, 0x01, 0x04, 0x03, 0x08, 0x01, 0x04,
+    0x00, 0x08, 0x02, 0x30, 0x0A, 0x08, 0x08, 0x04, 0x30, 0x0A, 0x00, 0x08, 0x00, 0x04, 0x06, 0x08,
+    0x03, 0x40, 0x0A, 0x00, 0x04, 0x05, 0x08, 0x04, 0x41, 0x08, 0x00, 0x04, 0x04, 0x08, 0x00, 0x04,
+    0x03, 0x31, 0x04, 0x05, 0x08, 0x02, 0x04, 0x02, 0x42, 0x04, 0x32, 0x04, 0x02, 0x50, 0x04, 0x50,
+    0x04, 0x00,
+  /* sprite 20 */
+    0x00, 0x03, 0x21, 0x04, 0x23, 0x08, 0x21, 0x04, 0x07, 0x12, 0x04, 0x00, 0x08, 0x00, 0x04, 0x03,
+    0x08, 0x00, 0x04, 0x00, 0x08, 0x02, 0x04, 0x07, 0x11, 0x04, 0x00, 0x08, 0x02, 0x04, 0x01, 0x08,
+    0x02, 0x04, 0x00, 0x08, 0x01, 0x04, 0x07, 0x30, 0x08, 0x01, 0x0A, 0x00, 0x04, 0x01, 0x08, 0x00,
+    0x04, 0x01, 0x0A, 0x00, 0x08, 0x09, 0x20, 0x08, 0x00, 0x04, 0x00, 0x0A, 0x01, 0x04, 0x01, 0x08,
+    0x01, 0x04, 0x00, 0x0A, 0x00, 0x04, 0x00, 0x08, 0x05, 0x20, 0x08, 0x02, 0x04, 0x03, 0x08, 0x02,
+    0x04, 0x00, 0x08, 0x05, 0x20, 0x08, 0x01, 0x04, 0x05, 0x08, 0x01, 0x04, 0x00, 0x08, 0x01, 0x2B,
+    0x08, 0x03, 0x21, 0x08, 0x00, 0x04, 0x08, 0x08, 0x03, 0x30, 0x08, 0x00, 0x04, 0x07, 0x08, 0x05,
+    0x12, 0x04, 0x00, 0x08, 0x00, 0x04, 0x05, 0x08, 0x02, 0x04, 0x03, 0x13, 0x04, 0x05, 0x08, 0x03,
+    0x04, 0x02, 0x31, 0x04, 0x61, 0x04, 0x00, 0x00,
+  /* sprite 21 */
+    0x02, 0x22, 0x04, 0x62, 0x04, 0x03, 0x12, 0x04, 0x15, 0x08, 0x12, 0x04, 0x03, 0x02, 0x04, 0x09,
+    0x08, 0x02, 0x04, 0x07, 0x00, 0x04, 0x11, 0x08, 0x02, 0x04, 0x01, 0x08, 0x02, 0x04, 0x01, 0x08,
+    0x10, 0x04, 0x05, 0x20, 0x08, 0x03, 0x04, 0x01, 0x08, 0x03, 0x04, 0x00, 0x08, 0x07, 0x20, 0x08,
+    0x00, 0x0A, 0x02, 0x04, 0x01, 0x08, 0x02, 0x04, 0x00, 0x0A, 0x00, 0x08, 0x07, 0x11, 0x08, 0x01,
+    0x0A, 0x01, 0x04, 0x01, 0x08, 0x01, 0x04, 0x01, 0x0A, 0x01, 0x08, 0x07, 0x11, 0x08, 0x01, 0x0A,
+    0x00, 0x04, 0x03, 0x08, 0x00, 0x04, 0x01, 0x0A, 0x01, 0x08, 0x01, 0x1D, 0x08, 0x01, 0x1D, 0x08,
+    0x03, 0x20, 0x08, 0x00, 0x04, 0x09, 0x08, 0x03, 0x20, 0x08, 0x00, 0x04, 0x09, 0x08, 0x05, 0x10,
+    0x04, 0x01, 0x08, 0x00, 0x04, 0x08, 0x08, 0x01, 0x04, 0x03, 0x11, 0x04, 0x09, 0x08, 0x02, 0x04,
+    0x03, 0x21, 0x04, 0x15, 0x08, 0x11, 0x04, 0x02, 0x22, 0x04, 0x62, 0x04,
+  /* sprite 22 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x05, 0x03, 0x01, 0x00,
+    0x06, 0x04, 0x01, 0x00, 0x06, 0x04, 0x01, 0x05, 0x02, 0x01, 0x01, 0x06, 0x04, 0x0A, 0x01, 0x06,
+    0x03, 0x01, 0x03, 0x03, 0x01, 0x06, 0x0A, 0x04, 0x01, 0x04, 0x01, 0x01, 0x00, 0x0D, 0x08, 0x0A,
+    0x03, 0x01, 0x05, 0x00, 0x01, 0x01, 0x06, 0x09, 0x0A, 0x00, 0x06, 0x01, 0x01, 0x06, 0x01, 0x01,
+    0x00, 0x0D, 0x06, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x03, 0x01, 0x07, 0x03, 0x01, 0x00, 0x0A, 0x00,
+    0x0D, 0x02, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x04, 0x01, 0x07, 0x02, 0x01, 0x01, 0x06, 0x00, 0x0A,
+    0x02, 0x0D, 0x00, 0x0A, 0x01, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x00, 0x06, 0x04, 0x01, 0x00,
+    0x06, 0x04, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 23 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x05, 0x02, 0x01, 0x00, 0x06, 0x06, 0x01,
+    0x00, 0x06, 0x03, 0x01, 0x05, 0x01, 0x01, 0x02, 0x06, 0x04, 0x01, 0x02, 0x06, 0x02, 0x01, 0x05,
+    0x03, 0x01, 0x00, 0x06, 0x04, 0x0A, 0x00, 0x06, 0x04, 0x01, 0x03, 0x03, 0x01, 0x06, 0x0A, 0x04,
+    0x01, 0x07, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x06, 0x08, 0x0A, 0x01, 0x01, 0x00, 0x06, 0x00, 0x01,
+    0x04, 0x02, 0x06, 0x09, 0x0A, 0x00, 0x06, 0x01, 0x01, 0x07, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x06,
+    0x06, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x03, 0x01, 0x07, 0x03, 0x01, 0x00, 0x0A, 0x00, 0x0D, 0x02,
+    0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x04, 0x01, 0x07, 0x03, 0x01, 0x00, 0x06, 0x00, 0x0A, 0x02, 0x0D,
+    0x00, 0x0A, 0x00, 0x06, 0x04, 0x01, 0x05, 0x01, 0x01, 0x02, 0x06, 0x04, 0x01, 0x02, 0x06, 0x02,
+    0x01, 0x05, 0x02, 0x01, 0x00, 0x06, 0x06, 0x01, 0x00, 0x06, 0x03, 0x01, 0x01, 0x0F, 0x01, 0x01,
+    0x0F, 0x01,
+  /* sprite 24 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x05, 0x04, 0x01, 0x00, 0x0D, 0x04, 0x01,
+    0x00, 0x0D, 0x03, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x00, 0x0D, 0x02, 0x01, 0x00, 0x06, 0x01,
+    0x0D, 0x02, 0x01, 0x05, 0x03, 0x01, 0x00, 0x06, 0x04, 0x0A, 0x00, 0x06, 0x04, 0x01, 0x03, 0x03,
+    0x01, 0x06, 0x0A, 0x04, 0x01, 0x05, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x06, 0x08, 0x0A, 0x03, 0x01,
+    0x04, 0x02, 0x06, 0x09, 0x0A, 0x00, 0x06, 0x01, 0x01, 0x09, 0x00, 0x01, 0x00, 0x0D, 0x00, 0x06,
+    0x06, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x01, 0x01, 0x00, 0x06, 0x00, 0x01, 0x07, 0x03, 0x01, 0x00,
+    0x0A, 0x00, 0x0D, 0x02, 0x0A, 0x00, 0x0D, 0x00, 0x0A, 0x04, 0x01, 0x07, 0x03, 0x01, 0x00, 0x06,
+    0x00, 0x0A, 0x02, 0x0D, 0x00, 0x0A, 0x00, 0x06, 0x04, 0x01, 0x07, 0x03, 0x01, 0x01, 0x06, 0x00,
+    0x0D, 0x02, 0x01, 0x00, 0x06, 0x01, 0x0D, 0x02, 0x01, 0x05, 0x04, 0x01, 0x00, 0x0D, 0x04, 0x01,
+    0x00, 0x0D, 0x03, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 25 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x03, 0x03, 0x01, 0x00, 0x0D, 0x0A, 0x01,
+    0x05, 0x02, 0x01, 0x00, 0x0D, 0x06, 0x01, 0x00, 0x0D, 0x03, 0x01, 0x05, 0x05, 0x01, 0x03, 0x06,
+    0x01, 0x01, 0x00, 0x0D, 0x02, 0x01, 0x03, 0x04, 0x01, 0x05, 0x06, 0x04, 0x01, 0x03, 0x03, 0x01,
+    0x07, 0x06, 0x03, 0x01, 0x05, 0x03, 0x01, 0x05, 0x06, 0x00, 0x0D, 0x00, 0x06, 0x03, 0x01, 0x05,
+    0x04, 0x01, 0x01, 0x06, 0x02, 0x0D, 0x00, 0x06, 0x04, 0x01, 0x03, 0x05, 0x01, 0x03, 0x06, 0x05,
+    0x01, 0x05, 0x02, 0x01, 0x00, 0x0D, 0x07, 0x01, 0x00, 0x0D, 0x02, 0x01, 0x05, 0x03, 0x01, 0x00,
+    0x0D, 0x05, 0x01, 0x00, 0x0D, 0x03, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 26 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x03, 0x06, 0x01, 0x01, 0x0D, 0x06, 0x01, 0x01, 0x0F, 0x01,
+    0x01, 0x0F, 0x01, 0x05, 0x04, 0x01, 0x00, 0x0D, 0x02, 0x01, 0x00, 0x0D, 0x05, 0x01, 0x05, 0x03,
+    0x01, 0x00, 0x0D, 0x04, 0x01, 0x00, 0x0D, 0x04, 0x01, 0x07, 0x00, 0x01, 0x00, 0x0D, 0x03, 0x01,
+    0x02, 0x06, 0x04, 0x01, 0x00, 0x0D, 0x00, 0x01, 0x07, 0x00, 0x01, 0x00, 0x0D, 0x02, 0x01, 0x04,
+    0x06, 0x03, 0x01, 0x00, 0x0D, 0x00, 0x01, 0x04, 0x05, 0x01, 0x01, 0x06, 0x00, 0x0D, 0x06, 0x01,
+    0x05, 0x03, 0x01, 0x00, 0x0D, 0x04, 0x01, 0x00, 0x0D, 0x04, 0x01, 0x05, 0x04, 0x01, 0x00, 0x0D,
+    0x02, 0x01, 0x00, 0x0D, 0x05, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x03, 0x06, 0x01, 0x01,
+    0x0D, 0x06, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 27 */
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x20, 0x04, 0x32, 0x04, 0x32, 0x04, 0x05, 0x11, 0x04, 0x20, 0x04,
+    0x30, 0x04, 0x10, 0x04, 0x30, 0x04, 0x05, 0x20, 0x04, 0x20, 0x04, 0x30, 0x04, 0x10, 0x04, 0x30,
+    0x04, 0x05, 0x20, 0x04, 0x20, 0x04, 0x30, 0x04, 0x10, 0x04, 0x30, 0x04, 0x05, 0x20, 0x04, 0x20,
+    0x04, 0x30, 0x04, 0x10, 0x04, 0x30, 0x04, 0x05, 0x20, 0x04, 0x20, 0x04, 0x30, 0x04, 0x10, 0x04,
+    0x30, 0x04, 0x03, 0x12, 0x04, 0x22, 0x04, 0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* sprite 28 */
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x22, 0x04, 0x31, 0x04, 0x31, 0x04, 0x06, 0x10, 0x04, 0x30, 0x04,
+    0x10, 0x04, 0x20, 0x04, 0x10, 0x04, 0x20, 0x04, 0x05, 0x50, 0x04, 0x10, 0x04, 0x20, 0x04, 0x10,
+    0x04, 0x20, 0x04, 0x05, 0x40, 0x04, 0x20, 0x04, 0x20, 0x04, 0x10, 0x04, 0x20, 0x04, 0x05, 0x30,
+    0x04, 0x30, 0x04, 0x20, 0x04, 0x10, 0x04, 0x20, 0x04, 0x05, 0x20, 0x04, 0x40, 0x04, 0x20, 0x04,
+    0x10, 0x04, 0x20, 0x04, 0x03, 0x14, 0x04, 0x21, 0x04, 0x31, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  /* sprite 29 */
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x03, 0x01, 0x73, 0x03, 0x03, 0x41, 0x09, 0x12, 0x03, 0x01,
+    0x09, 0x04, 0x40, 0x09, 0x01, 0x06, 0x01, 0x03, 0x03, 0x09, 0x03, 0x32, 0x06, 0x06, 0x09, 0x00,
+    0x03, 0x04, 0x40, 0x09, 0x01, 0x06, 0x01, 0x03, 0x03, 0x09, 0x03, 0x41, 0x09, 0x12, 0x03, 0x01,
+    0x09, 0x01, 0x73, 0x03, 0x01, 0x83, 0x03, 0x00, 0x00, 0x00,
+  /* sprite 30 */
+    0x02, 0x31, 0x06, 0x61, 0x06, 0x04, 0x20, 0x06, 0x20, 0x06, 0x40, 0x06, 0x20, 0x06, 0x05, 0x20,
+    0x06, 0x01, 0x09, 0x05, 0x06, 0x01, 0x09, 0x00, 0x06, 0x01, 0x39, 0x06, 0x01, 0x55, 0x06, 0x05,
+    0x41, 0x06, 0x00, 0x09, 0x01, 0x06, 0x00, 0x09, 0x01, 0x06, 0x05, 0x10, 0x06, 0x22, 0x06, 0x01,
+    0x09, 0x02, 0x06, 0x20, 0x06, 0x05, 0x02, 0x06, 0x10, 0x03, 0x05, 0x06, 0x00, 0x03, 0x12, 0x06,
+    0x05, 0x03, 0x06, 0x00, 0x03, 0x05, 0x06, 0x00, 0x03, 0x03, 0x06, 0x05, 0x03, 0x06, 0x01, 0x03,
+    0x03, 0x06, 0x01, 0x03, 0x03, 0x06, 0x03, 0x04, 0x06, 0x05, 0x03, 0x04, 0x06, 0x05, 0x13, 0x06,
+    0x00, 0x03, 0x02, 0x09, 0x01, 0x03, 0x03, 0x06, 0x05, 0x13, 0x06, 0x00, 0x03, 0x02, 0x09, 0x01,
+    0x03, 0x03, 0x06, 0x03, 0x32, 0x06, 0x03, 0x03, 0x02, 0x06, 0x02, 0x23, 0x06, 0x43, 0x06, 0x04,
+    0x12, 0x06, 0x10, 0x06, 0x40, 0x06, 0x12, 0x06,
+  /* sprite 31 */
+    0x02, 0x31, 0x06, 0x61, 0x06, 0x05, 0x20, 0x06, 0x20, 0x06, 0x40, 0x06, 0x01, 0x09, 0x00, 0x06,
+    0x05, 0x20, 0x06, 0x01, 0x09, 0x05, 0x06, 0x01, 0x09, 0x00, 0x06, 0x01, 0x39, 0x06, 0x01, 0x55,
+    0x06, 0x03, 0x41, 0x06, 0x03, 0x09, 0x01, 0x06, 0x05, 0x10, 0x06, 0x21, 0x06, 0x03, 0x09, 0x01,
+    0x06, 0x20, 0x06, 0x07, 0x02, 0x06, 0x10, 0x03, 0x01, 0x06, 0x01, 0x09, 0x01, 0x06, 0x00, 0x03,
+    0x12, 0x06, 0x05, 0x03, 0x06, 0x00, 0x03, 0x05, 0x06, 0x00, 0x03, 0x03, 0x06, 0x05, 0x03, 0x06,
+    0x01, 0x03, 0x03, 0x06, 0x01, 0x03, 0x03, 0x06, 0x03, 0x04, 0x06, 0x05, 0x03, 0x04, 0x06, 0x05,
+    0x13, 0x06, 0x00, 0x03, 0x02, 0x09, 0x01, 0x03, 0x03, 0x06, 0x05, 0x13, 0x06, 0x00, 0x03, 0x02,
+    0x09, 0x01, 0x03, 0x03, 0x06, 0x03, 0x32, 0x06, 0x03, 0x03, 0x02, 0x06, 0x02, 0x23, 0x06, 0x43,
+    0x06, 0x04, 0x12, 0x06, 0x10, 0x06, 0x40, 0x06, 0x12, 0x06,
+  /* sprite 32 */
+    0x01, 0x11, 0x09, 0x02, 0x00, 0x09, 0x11, 0x09, 0x01, 0x03, 0x09, 0x02, 0x02, 0x09, 0x00, 0x06,
+    0x03, 0x00, 0x09, 0x00, 0x06, 0x10, 0x06, 0x01, 0x10, 0x06, 0x00, 0x00, 0x00, 0x01, 0x10, 0x06,
+    0x03, 0x01, 0x09, 0x10, 0x06, 0x10, 0x06, 0x01, 0x06, 0x09, 0x00, 0x01, 0x10, 0x06, 0x01, 0x20,
+    0x06, 0x01, 0x01, 0x06,
+  /* sprite 33 */
+    0x00, 0x00, 0x01, 0x83, 0x09, 0x02, 0x73, 0x09, 0x00, 0x06, 0x03, 0x62, 0x09, 0x00, 0x06, 0x10,
+    0x06, 0x03, 0x21, 0x06, 0x03, 0x09, 0x10, 0x06, 0x03, 0x21, 0x06, 0x02, 0x09, 0x00, 0x06, 0x02,
+    0x05, 0x09, 0x10, 0x06, 0x03, 0x00, 0x09, 0x01, 0x06, 0x01, 0x09, 0x05, 0x01, 0x09, 0x00, 0x06,
+    0x01, 0x09, 0x20, 0x06, 0x10, 0x06, 0x06, 0x00, 0x03, 0x05, 0x09, 0x00, 0x06, 0x01, 0x09, 0x10,
+    0x06, 0x10, 0x06, 0x01, 0x0E, 0x09, 0x01, 0x03, 0x09, 0x03, 0x03, 0x09, 0x10, 0x06, 0x30, 0x06,
+    0x03, 0x02, 0x09, 0x30, 0x06, 0x30, 0x06, 0x02, 0x14, 0x06, 0x21, 0x06,
+  /* sprite 34 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x0B, 0x03, 0x10, 0x0B, 0x80, 0x0B, 0x30, 0x0B,
+    0x03, 0x11, 0x0B, 0x30, 0x0C, 0x26, 0x0B, 0x07, 0x21, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x00, 0x0D,
+    0x01, 0x0B, 0x00, 0x0C, 0x01, 0x0B, 0x05, 0x42, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x00, 0x0D, 0x01,
+    0x0B, 0x04, 0x01, 0x0D, 0x60, 0x0B, 0x00, 0x0C, 0x05, 0x0B, 0x01, 0x23, 0x0D, 0x01, 0xA3, 0x0D,
+    0x01, 0x34, 0x0D, 0x01, 0xC3, 0x0D,
+  /* sprite 35 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x0B, 0x40, 0x0B, 0x05, 0x20, 0x0B, 0x42, 0x0B, 0x20,
+    0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x01, 0x1E, 0x0B, 0x05, 0x06, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x00,
+    0x0C, 0x01, 0x0B, 0x06, 0x01, 0x0B, 0x00, 0x0D, 0x00, 0x0C, 0x04, 0x0B, 0x00, 0x0C, 0x05, 0x0B,
+    0x03, 0x09, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x04, 0x00, 0x0D, 0x00, 0x0C, 0x0A, 0x0B, 0x11, 0x0B,
+    0x03, 0x40, 0x0C, 0x00, 0x0D, 0x01, 0x0B, 0x06, 0x02, 0x0D, 0x12, 0x0B, 0x00, 0x0C, 0x10, 0x0D,
+    0x21, 0x0D, 0x10, 0x0B, 0x03, 0x33, 0x0B, 0x30, 0x0D, 0x31, 0x0B, 0x02, 0x45, 0x0D, 0x41, 0x0D,
+  /* sprite 36 */
+    0x01, 0x91, 0x0B, 0x02, 0x80, 0x0B, 0x11, 0x0B, 0x01, 0x83, 0x0B, 0x02, 0x73, 0x0B, 0x00, 0x0D,
+    0x03, 0x62, 0x0B, 0x00, 0x0D, 0x10, 0x0D, 0x03, 0x21, 0x0D, 0x03, 0x0B, 0x10, 0x0D, 0x03, 0x21,
+    0x0D, 0x02, 0x0B, 0x00, 0x0D, 0x02, 0x05, 0x0B, 0x10, 0x0D, 0x03, 0x00, 0x0B, 0x01, 0x0D, 0x01,
+    0x0B, 0x05, 0x01, 0x0B, 0x00, 0x0D, 0x01, 0x0B, 0x20, 0x0D, 0x10, 0x0D, 0x06, 0x00, 0x0C, 0x05,
+    0x0B, 0x00, 0x0D, 0x01, 0x0B, 0x10, 0x0D, 0x10, 0x0D, 0x01, 0x0E, 0x0B, 0x01, 0x03, 0x0B, 0x03,
+    0x03, 0x0B, 0x10, 0x0D, 0x30, 0x0D, 0x03, 0x02, 0x0B, 0x30, 0x0D, 0x30, 0x0D, 0x02, 0x14, 0x0D,
+    0x21, 0x0D,
+  /* sprite 37 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x21, 0x0D, 0x01, 0x0B, 0x04, 0x01, 0x0B, 0x01, 0x0D,
+    0x03, 0x0B, 0x51, 0x0B, 0x02, 0x0C, 0x0B, 0x10, 0x0B, 0x05, 0x00, 0x0B, 0x00, 0x0C, 0x03, 0x0B,
+    0x01, 0x0D, 0x06, 0x0B, 0x03, 0x00, 0x0C, 0x06, 0x0B, 0x06, 0x0D, 0x01, 0x0E, 0x0B, 0x01, 0x03,
+    0x0B, 0x03, 0x03, 0x0B, 0x10, 0x0D, 0x30, 0x0D, 0x03, 0x02, 0x0B, 0x30, 0x0D, 0x30, 0x0D, 0x02,
+    0x14, 0x0D, 0x21, 0x0D,
+  /* sprite 38 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA2, 0x0B, 0x03, 0x91, 0x0B, 0x01, 0x0D, 0x00, 0x0B, 0x02,
+    0x86, 0x0B, 0x00, 0x0D, 0x01, 0x87, 0x0B, 0x03, 0x70, 0x0B, 0x01, 0x0D, 0x04, 0x0B, 0x03, 0x54,
+    0x0B, 0x01, 0x0D, 0x00, 0x0B, 0x02, 0x1A, 0x0B, 0x10, 0x0D, 0x03, 0x01, 0x0D, 0x53, 0x0D, 0x30,
+    0x0D, 0x02, 0x32, 0x0D, 0x70, 0x0D, 0x01, 0xA2, 0x0D, 0x01, 0x12, 0x0D,
+  /* sprite 39 */
+    0x01, 0xA2, 0x0B, 0x03, 0x91, 0x0B, 0x01, 0x0D, 0x00, 0x0B, 0x01, 0x95, 0x0B, 0x01, 0x86, 0x0B,
+    0x03, 0x82, 0x0B, 0x00, 0x0D, 0x10, 0x0D, 0x01, 0x74, 0x0B, 0x01, 0x57, 0x0B, 0x02, 0x01, 0x0D,
+    0x18, 0x0B, 0x01, 0x29, 0x0B, 0x03, 0x18, 0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x07, 0x00, 0x0D, 0x05,
+    0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x01, 0x0D, 0x02, 0x23, 0x0D, 0x60, 0x0D,
+    0x02, 0x74, 0x0D, 0x20, 0x0D, 0x02, 0x14, 0x0D, 0x70, 0x0D, 0x01, 0xA2, 0x0D, 0x01, 0x53, 0x0D,
+  /* sprite 40 */
+    0x00, 0x00, 0x02, 0x50, 0x07, 0x01, 0x05, 0x01, 0x44, 0x05, 0x01, 0x36, 0x05, 0x01, 0x63, 0x05,
+    0x04, 0x50, 0x07, 0x02, 0x05, 0x00, 0x03, 0x00, 0x05, 0x02, 0x40, 0x07, 0x05, 0x05, 0x03, 0x30,
+    0x07, 0x00, 0x05, 0x42, 0x05, 0x05, 0x20, 0x07, 0x60, 0x05, 0x00, 0x03, 0x01, 0x05, 0x20, 0x05,
+    0x02, 0xA4, 0x05, 0x00, 0x03, 0x03, 0xB0, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0xC1, 0x05, 0x00,
+    0x03, 0x00, 0x05, 0x00, 0x00, 0x00,
+  /* sprite 41 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x04, 0x05, 0x05, 0x00, 0x05, 0x00, 0x03,
+    0x01, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0x01, 0x05, 0x22, 0x05, 0x60, 0x05, 0x05, 0x00, 0x05,
+    0x40, 0x05, 0x00, 0x03, 0x00, 0x05, 0x40, 0x03, 0x03, 0x62, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00,
+    0x00, 0x00,
+  /* sprite 42 */
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x07, 0x01, 0x05, 0x01, 0x34, 0x05, 0x01, 0x26, 0x05, 0x01,
+    0x54, 0x05, 0x04, 0x22, 0x07, 0x01, 0x05, 0x00, 0x03, 0x02, 0x05, 0x03, 0x32, 0x05, 0x15, 0x05,
+    0x20, 0x05, 0x05, 0x80, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x03, 0x00, 0x05, 0x03, 0xA0, 0x05,
+    0x00, 0x03, 0x03, 0x05, 0x01, 0xC3, 0x05, 0x00, 0x00, 0x00,
+  /* sprite 43 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31, 0x05, 0x00, 0x03, 0x01, 0x05, 0x05,
+    0x01, 0x05, 0x00, 0x03, 0x03, 0x05, 0x00, 0x03, 0x01, 0x05, 0x03, 0x03, 0x05, 0x51, 0x05, 0x00,
+    0x03, 0x02, 0x01, 0x05, 0x91, 0x05, 0x01, 0xD0, 0x05, 0x00, 0x00, 0x00,
+  /* sprite 44 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x30, 0x07, 0x01, 0x05, 0x03, 0x24, 0x05, 0x61,
+    0x05, 0x00, 0x03, 0x02, 0x16, 0x05, 0x34, 0x05, 0x04, 0x41, 0x05, 0x00, 0x03, 0x05, 0x05, 0x00,
+    0x03, 0x03, 0x27, 0x05, 0x00, 0x03, 0x01, 0x05, 0x03, 0x61, 0x05, 0x00, 0x03, 0x01, 0x05, 0x00,
+    0x00, 0x00,
+  /* sprite 45 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0xA0, 0x05, 0x00, 0x03, 0x00,
+    0x05, 0x03, 0x01, 0x05, 0x70, 0x03, 0x01, 0x05, 0x04, 0x00, 0x05, 0x00, 0x03, 0x01, 0x05, 0x32,
+    0x05, 0x03, 0x11, 0x05, 0x00, 0x03, 0x03, 0x05, 0x02, 0x32, 0x05, 0x00, 0x03, 0x00, 0x00, 0x00,
+  /* sprite 46 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x04, 0x05, 0x01, 0x06, 0x0B, 0x00, 0x01,
+    0x01, 0x0B, 0x04, 0x03, 0x01, 0x05, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x04, 0x03, 0x01, 0x01, 0x0B,
+    0x01, 0x0D, 0x07, 0x0B, 0x02, 0x02, 0x01, 0x0C, 0x0B, 0x03, 0x02, 0x01, 0x0A, 0x0B, 0x01, 0x0D,
+    0x06, 0x02, 0x01, 0x01, 0x0B, 0x01, 0x0D, 0x03, 0x0B, 0x00, 0x0D, 0x03, 0x0B, 0x04, 0x02, 0x01,
+    0x07, 0x0B, 0x00, 0x0D, 0x03, 0x0B, 0x06, 0x03, 0x01, 0x06, 0x0B, 0x00, 0x01, 0x00, 0x0C, 0x00,
+    0x0D, 0x01, 0x0C, 0x04, 0x05, 0x01, 0x00, 0x0C, 0x00, 0x01, 0x07, 0x0C, 0x05, 0x04, 0x01, 0x02,
+    0x0B, 0x02, 0x0C, 0x00, 0x01, 0x03, 0x0C, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 47 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x0B, 0x00, 0x01, 0x08, 0x0B,
+    0x00, 0x01, 0x02, 0x0B, 0x02, 0x00, 0x0D, 0x0E, 0x0B, 0x03, 0x08, 0x0B, 0x01, 0x0D, 0x04, 0x0B,
+    0x05, 0x04, 0x0B, 0x00, 0x0D, 0x07, 0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x01, 0x0F, 0x0B, 0x03, 0x01,
+    0x0B, 0x00, 0x0D, 0x0C, 0x0B, 0x03, 0x09, 0x0B, 0x02, 0x0D, 0x02, 0x0B, 0x03, 0x08, 0x0C, 0x05,
+    0x0B, 0x00, 0x0C, 0x03, 0x03, 0x0C, 0x02, 0x0D, 0x08, 0x0C, 0x05, 0x02, 0x0C, 0x00, 0x01, 0x06,
+    0x0C, 0x00, 0x01, 0x03, 0x0C, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 48 */
+    0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x05, 0x01, 0x0B, 0x00, 0x01, 0x04, 0x0B,
+    0x02, 0x0D, 0x04, 0x01, 0x05, 0x03, 0x0B, 0x00, 0x0D, 0x01, 0x0B, 0x04, 0x0D, 0x03, 0x01, 0x05,
+    0x06, 0x0B, 0x00, 0x0D, 0x02, 0x0B, 0x00, 0x0D, 0x03, 0x01, 0x05, 0x06, 0x0B, 0x00, 0x0D, 0x02,
+    0x0B, 0x01, 0x0D, 0x02, 0x01, 0x05, 0x05, 0x0B, 0x00, 0x0D, 0x04, 0x0B, 0x00, 0x0D, 0x02, 0x01,
+    0x07, 0x05, 0x0B, 0x00, 0x0D, 0x01, 0x0B, 0x00, 0x0D, 0x01, 0x0B, 0x00, 0x0D, 0x02, 0x01, 0x09,
+    0x01, 0x0B, 0x01, 0x0D, 0x00, 0x0B, 0x02, 0x0D, 0x00, 0x0B, 0x00, 0x0D, 0x00, 0x0B, 0x01, 0x0D,
+    0x02, 0x01, 0x05, 0x06, 0x0C, 0x00, 0x0D, 0x02, 0x0B, 0x00, 0x0D, 0x03, 0x01, 0x05, 0x06, 0x0C,
+    0x00, 0x0D, 0x01, 0x0B, 0x01, 0x0D, 0x03, 0x01, 0x06, 0x03, 0x0C, 0x00, 0x01, 0x02, 0x0C, 0x00,
+    0x0B, 0x01, 0x0D, 0x04, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01, 0x01, 0x0F, 0x01,
+  /* sprite 49 */
+    0x01, 0x2D, 0x06, 0x02, 0x10, 0x07, 0x0D, 0x06, 0x03, 0x10, 0x07, 0x03, 0x06, 0x08, 0x04, 0x02,
+    0x10, 0x07, 0x03, 0x06, 0x02, 0x10, 0x07, 0x03, 0x06, 0x02, 0x10, 0x07, 0x03, 0x06, 0x02, 0x10,
+    0x07, 0x0B, 0x06, 0x02, 0x10, 0x07, 0x0B, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x05, 0x04, 0x00,
+    0x06, 0x02, 0x10, 0x07, 0x03, 0x06, 0x02, 0x10, 0x07, 0x03, 0x06, 0x02, 0x10, 0x07, 0x03, 0x06,
+    0x02, 0x10, 0x07, 0x03, 0x06, 0x02, 0x10, 0x07, 0x03, 0x06, 0x01, 0x13, 0x04, 0x00,
+  /* sprite 50 */
+    0x01, 0x2B, 0x06, 0x02, 0x10, 0x07, 0x0D, 0x06, 0x05, 0x10, 0x07, 0x03, 0x06, 0x04, 0x04, 0x00,
+    0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03,
+    0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x03, 0x10,
+    0x07, 0x03, 0x06, 0x45, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x30, 0x07, 0x05, 0x06, 0x03, 0x10,
+    0x07, 0x09, 0x06, 0x02, 0x04, 0x02, 0x10, 0x07, 0x09, 0x06, 0x02, 0x10, 0x07, 0x0B, 0x06, 0x02,
+    0x10, 0x07, 0x0B, 0x06, 0x05, 0x10, 0x07, 0x03, 0x06, 0x02, 0x04, 0x00, 0x07, 0x05, 0x06, 0x04,
+    0x10, 0x07, 0x03, 0x06, 0x30, 0x07, 0x05, 0x06, 0x02, 0x13, 0x04, 0x45, 0x04, 0x00,
+  /* sprite 51 */
+    0x01, 0x49, 0x06, 0x02, 0x30, 0x07, 0x09, 0x06, 0x04, 0x23, 0x06, 0x04, 0x04, 0x00, 0x07, 0x03,
+    0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50,
+    0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03,
+    0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10,
+    0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06,
+    0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07,
+    0x03, 0x06, 0x04, 0x11, 0x04, 0x00, 0x07, 0x09, 0x06, 0x00, 0x04, 0x02, 0x30, 0x07, 0x09, 0x06,
+    0x01, 0x39, 0x04, 0x00,
+  /* sprite 52 */
+    0x01, 0x69, 0x06, 0x02, 0x50, 0x07, 0x09, 0x06, 0x02, 0x43, 0x06, 0x06, 0x04, 0x02, 0x30, 0x07,
+    0x03, 0x06, 0x02, 0x23, 0x06, 0x00, 0x04, 0x02, 0x10, 0x07, 0x03, 0x06, 0x03, 0x10, 0x07, 0x03,
+    0x06, 0x45, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x30, 0x07, 0x05, 0x06, 0x05, 0x10, 0x07, 0x03,
+    0x06, 0x31, 0x04, 0x00, 0x07, 0x03, 0x06, 0x04, 0x10, 0x07, 0x03, 0x06, 0x50, 0x07, 0x03, 0x06,
+    0x05, 0x11, 0x04, 0x00, 0x07, 0x03, 0x06, 0x30, 0x07, 0x03, 0x06, 0x04, 0x30, 0x07, 0x03, 0x06,
+    0x30, 0x07, 0x03, 0x06, 0x03, 0x31, 0x04, 0x00, 0x07, 0x09, 0x06, 0x02, 0x50, 0x07, 0x09, 0x06,
+    0x01, 0x59, 0x04, 0x00,
+  /* sprite 53 */
+    0x01, 0x4B, 0x06, 0x02, 0x30, 0x07, 0x0B, 0x06, 0x03, 0x30, 0x07, 0x03, 0x06, 0x06, 0x04, 0x02,
+    0x30, 0x07, 0x03, 0x06, 0x02, 0x30, 0x07, 0x03, 0x06, 0x02, 0x30, 0x07, 0x03, 0x06, 0x02, 0x30,
+    0x07, 0x09, 0x06, 0x02, 0x30, 0x07, 0x09, 0x06, 0x03, 0x30, 0x07, 0x03, 0x06, 0x04, 0x04, 0x02,
+    0x30, 0x07, 0x03, 0x06, 0x02, 0x30, 0x07, 0x03, 0x06, 0x02, 0x30, 0x07, 0x03, 0x06, 0x02, 0x30,
+    0x07, 0x0B, 0x06, 0x02, 0x30, 0x07, 0x0B, 0x06, 0x01, 0x3B, 0x04, 0x00,
+};
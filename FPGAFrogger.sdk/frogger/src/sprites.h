@@ -1,17 +1,19 @@
-// Auto-generated from .\frog_sheet.png
+// Auto-generated by frogger_host/assetgen from frog_sheet.png and
+// palette.mem, do not edit.
 #pragma once
 #include <stdint.h>
 
 #define NUM_SPRITES   54
 #define SPR_W         16
 #define SPR_H         16
-#define PALETTE_SIZE  14
+#define PALETTE_SIZE  16
 
+// palette.mem, each RGB444 digit doubled
 static const uint32_t palette[PALETTE_SIZE] = {
-    0x000000, 0x000047, 0x0000F7, 0x00DEF7, 
-    0xFFFF00, 0x97FF00, 0x21DE00, 0xFF00F7, 
-    0x9700F7, 0xFF4700, 0xFF0000, 0xDE684F, 
-    0x97684F, 0xDEDEF7
+    0x000000, 0x000044, 0x0000FF, 0x00DDFF, 
+    0xFFFF00, 0x99FF00, 0x22DD00, 0xFF00FF, 
+    0x9900FF, 0xFF4400, 0xFF0000, 0xDD6644, 
+    0x996644, 0xDDDDFF, 0xFFFFFF, 0x000000
 };
 
 static const uint8_t sprites[NUM_SPRITES][SPR_W*SPR_H] = {
@@ -0,0 +1,486 @@
+// Converts the PNG sprite sheets into the asset headers of the firmware and
+// the frame buffer's $readmemh image, all against one palette.
+//
+//   assetgen [-v] src_dir hdr_dir      PNGs to headers and background.mem
+//   assetgen -x src_dir                sheets back out of the built-in headers
+//
+// src_dir (../../FPGAFrogger.srcs/sources_1/imports/sprites2c) holds
+//
+//   palette.mem              the palette: 16 RGB444 entries, one per line,
+//                            as vga_framebuffer_top loads it
+//   frog_sheet.png           sprites, 16x16 cells left to right, top to
+//                            bottom; trailing empty cells are not sprites
+//   frogger_background.png   the 224x256 screen; its distinct 16x16 tiles in
+//                            order of appearance and the tilemap
+//   letters.png              glyphs A-Z, 8x8 cells
+//   numbers.png              glyphs 0-9, 8x8 cells
+//
+// Every pixel must be a palette colour at RGB444 precision, or transparent
+// (alpha below 128, index 0); anything else is reported and nothing is
+// written. A colour that is in the palette twice maps to its first entry.
+//
+// hdr_dir gets sprites.h, background.h, letters.h and numbers.h, one byte
+// per pixel, the palette of sprites.h from palette.mem, and src_dir the
+// INIT_F image of bram_sdp, background.mem (the screen, one digit per pixel).
+// The other layouts are built from those headers by the generators the
+// Makefile runs after this one (make assets): romgen (sprite and tile ROMs),
+// packgen (4bpp), spangen (spans) and kerngen (kernels).
+//
+// The report gives, per sheet and for each layout, the bytes and the decode
+// work per 16 pixels in the OP_PX units render.c charges: a pixel load per
+// pixel as bytes, a load per byte (two pixels) packed, two per span as
+// spans; the ROM images are read by the hardware, at no CPU cost but with
+// the BRAM36s given. -v adds a line per image with its cheapest layout.
+//
+// -x writes the sheets from the headers assetgen was built with; that is how
+// the PNGs were recovered from the headers of the original converter.
+#include "background.h"
+#include "letters.h"
+#include "numbers.h"
+#include "sprites.h"
+#include <png.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SHEET_COLS 8   // sprites per row of frog_sheet.png
+#define FB_W 224
+#define FB_H 256
+#define MAX_IMAGES 64
+
+static uint16_t pal[16];   // RGB444
+
+struct sheet {
+    const char *name, *header;
+    int w, h, count;
+    uint8_t px[MAX_IMAGES][SPR_W * SPR_H];
+};
+
+static struct sheet spr = {.name = "sprites", .header = "sprites.h", .w = SPR_W, .h = SPR_H};
+static struct sheet tiles = {.name = "background", .header = "background.h", .w = SPR_W,
+                             .h = SPR_H};
+static struct sheet let = {.name = "letters", .header = "letters.h", .w = LETTER_W, .h = LETTER_H};
+static struct sheet dig = {.name = "numbers", .header = "numbers.h", .w = DIGIT_W, .h = DIGIT_H};
+static uint8_t screen[FB_H][FB_W];
+static uint8_t tilemap[TILES_Y][TILES_X];
+
+static FILE *open_in(const char *dir, const char *name, const char *mode, char *path) {
+    sprintf(path, "%s/%s", dir, name);
+    FILE *f = fopen(path, mode);
+    if (!f)
+        perror(path);
+    return f;
+}
+
+static int read_palette(const char *dir) {
+    char path[512];
+    FILE *f = open_in(dir, "palette.mem", "r", path);
+    if (!f)
+        return -1;
+    int n = 0;
+    unsigned v;
+    while (n < 16 && fscanf(f, "%x", &v) == 1)
+        pal[n++] = (uint16_t)(v & 0xFFF);
+    fclose(f);
+    if (n != 16) {
+        fprintf(stderr, "%s: %d entries, need 16\n", path, n);
+        return -1;
+    }
+    return 0;
+}
+
+// Indexed pixels of a PNG; NULL if it cannot be read or has a colour off
+// the palette
+static uint8_t *read_png(const char *dir, const char *name, int *w, int *h) {
+    char path[512];
+    png_image img;
+
+    sprintf(path, "%s/%s", dir, name);
+    memset(&img, 0, sizeof(img));
+    img.version = PNG_IMAGE_VERSION;
+    if (!png_image_begin_read_from_file(&img, path)) {
+        fprintf(stderr, "%s: %s\n", path, img.message);
+        return NULL;
+    }
+    img.format = PNG_FORMAT_RGBA;
+    uint8_t *rgba = malloc(PNG_IMAGE_SIZE(img));
+    uint8_t *px = malloc(img.width * img.height);
+    if (!rgba || !px || !png_image_finish_read(&img, NULL, rgba, 0, NULL)) {
+        fprintf(stderr, "%s: %s\n", path, img.message);
+        free(rgba);
+        free(px);
+        return NULL;
+    }
+
+    int bad = 0;
+    for (unsigned i = 0; i < img.width * img.height; ++i) {
+        const uint8_t *p = &rgba[i * 4];
+        uint16_t c = (uint16_t)((p[0] >> 4) << 8 | (p[1] >> 4) << 4 | p[2] >> 4);
+        int k = 0;
+        if (p[3] >= 128)
+            while (k < 16 && pal[k] != c)
+                ++k;
+        if (k == 16) {
+            if (!bad++)
+                fprintf(stderr, "%s: (%u, %u) is #%02X%02X%02X, not in palette.mem\n", path,
+                        i % img.width, i / img.width, p[0], p[1], p[2]);
+            k = 0;
+        }
+        px[i] = (uint8_t)k;
+    }
+    free(rgba);
+    if (bad) {
+        fprintf(stderr, "%s: %d pixels off the palette\n", path, bad);
+        free(px);
+        return NULL;
+    }
+    *w = (int)img.width;
+    *h = (int)img.height;
+    return px;
+}
+
+static int empty(const uint8_t *px, int n) {
+    for (int i = 0; i < n; ++i)
+        if (px[i])
+            return 0;
+    return 1;
+}
+
+// Cells of s->w x s->h from left to right, top to bottom, up to the last
+// one that is not empty
+static int cut_sheet(struct sheet *s, const uint8_t *px, int w, int h) {
+    int cols = w / s->w, n = cols * (h / s->h);
+    if (n > MAX_IMAGES) {
+        fprintf(stderr, "%s: more than %d cells\n", s->name, MAX_IMAGES);
+        return -1;
+    }
+    for (int i = 0; i < n; ++i)
+        for (int y = 0; y < s->h; ++y)
+            memcpy(&s->px[i][y * s->w], &px[(i / cols * s->h + y) * w + i % cols * s->w], s->w);
+    s->count = n;
+    while (s->count && empty(s->px[s->count - 1], s->w * s->h))
+        --s->count;
+    return 0;
+}
+
+static int cut_background(const uint8_t *px, int w, int h) {
+    if (w != FB_W || h != FB_H) {
+        fprintf(stderr, "frogger_background.png: %dx%d, need %dx%d\n", w, h, FB_W, FB_H);
+        return -1;
+    }
+    memcpy(screen, px, sizeof(screen));
+    for (int ty = 0; ty < TILES_Y; ++ty)
+        for (int tx = 0; tx < TILES_X; ++tx) {
+            uint8_t t[SPR_W * SPR_H];
+            for (int y = 0; y < SPR_H; ++y)
+                memcpy(&t[y * SPR_W], &screen[ty * SPR_H + y][tx * SPR_W], SPR_W);
+            int i = 0;
+            while (i < tiles.count && memcmp(tiles.px[i], t, sizeof(t)))
+                ++i;
+            if (i == tiles.count) {
+                if (i == MAX_IMAGES) {
+                    fprintf(stderr, "frogger_background.png: more than %d tiles\n", i);
+                    return -1;
+                }
+                memcpy(tiles.px[tiles.count++], t, sizeof(t));
+            }
+            tilemap[ty][tx] = (uint8_t)i;
+        }
+    return 0;
+}
+
+static void put_image(FILE *f, const struct sheet *s, int i, const char *label, const char *sep) {
+    fprintf(f, "  /* %s */ {\n", label);
+    for (int y = 0; y < s->h; ++y) {
+        fprintf(f, "    ");
+        for (int x = 0; x + 1 < s->w; ++x)
+            fprintf(f, "0x%X%s", s->px[i][y * s->w + x], sep);
+        fprintf(f, "0x%X%s", s->px[i][y * s->w + s->w - 1], y + 1 < s->h ? "," : "");
+        fprintf(f, "\n");
+    }
+    fprintf(f, "  }%s\n", i + 1 < s->count ? "," : "");
+}
+
+static FILE *open_out(const char *dir, const char *name, char *path) {
+    return open_in(dir, name, "w", path);
+}
+
+static int close_out(FILE *f, const char *path) {
+    if (fclose(f)) {
+        perror(path);
+        return -1;
+    }
+    return 0;
+}
+
+static int write_sprites(const char *dir) {
+    char path[512];
+    FILE *f = open_out(dir, spr.header, path);
+    if (!f)
+        return -1;
+    fprintf(f, "// Auto-generated by frogger_host/assetgen from frog_sheet.png and\n"
+               "// palette.mem, do not edit.\n"
+               "#pragma once\n#include <stdint.h>\n\n");
+    fprintf(f, "#define NUM_SPRITES   %d\n#define SPR_W         %d\n#define SPR_H         %d\n"
+               "#define PALETTE_SIZE  16\n\n", spr.count, SPR_W, SPR_H);
+    fprintf(f, "// palette.mem, each RGB444 digit doubled\n"
+               "static const uint32_t palette[PALETTE_SIZE] = {\n");
+    for (int i = 0; i < 16; ++i) {
+        uint32_t c = (uint32_t)(pal[i] >> 8) * 0x110000 + (uint32_t)(pal[i] >> 4 & 15) * 0x1100 +
+                     (uint32_t)(pal[i] & 15) * 0x11;
+        const char *sep = i == 15 ? "\n" : i % 4 == 3 ? ", \n" : ", ";
+        fprintf(f, "%s0x%06X%s", i % 4 ? "" : "    ", c, sep);
+    }
+    fprintf(f, "};\n\nstatic const uint8_t sprites[NUM_SPRITES][SPR_W*SPR_H] = {\n");
+    for (int i = 0; i < spr.count; ++i) {
+        char label[32];
+        sprintf(label, "sprite %2d", i);
+        put_image(f, &spr, i, label, ",");
+    }
+    fprintf(f, "};\n");
+    return close_out(f, path);
+}
+
+static int write_background(const char *dir) {
+    char path[512];
+    FILE *f = open_out(dir, tiles.header, path);
+    if (!f)
+        return -1;
+    fprintf(f, "// Auto-generated by frogger_host/assetgen from frogger_background.png,\n"
+               "// do not edit.\n"
+               "#pragma once\n#include <stdint.h>\n\n");
+    fprintf(f, "#define BG_NUM_SPRITES   %d\n#define SPR_W         %d\n#define SPR_H         %d\n"
+               "#define PALETTE_SIZE  16\n#define TILES_X       %d\n#define TILES_Y       %d\n\n\n",
+            tiles.count, SPR_W, SPR_H, TILES_X, TILES_Y);
+    fprintf(f, "static const uint8_t background[BG_NUM_SPRITES][SPR_W*SPR_H] = {\n");
+    for (int i = 0; i < tiles.count; ++i) {
+        char label[32];
+        sprintf(label, "sprite %2d", i);
+        put_image(f, &tiles, i, label, ",");
+    }
+    fprintf(f, "};\n\nstatic const uint8_t bg_tilemap[TILES_Y][TILES_X] = {\n");
+    for (int y = 0; y < TILES_Y; ++y) {
+        fprintf(f, "  {");
+        for (int x = 0; x < TILES_X; ++x)
+            fprintf(f, " %2d%s", tilemap[y][x], x + 1 < TILES_X ? "," : " },\n");
+    }
+    fprintf(f, "};\n");
+    return close_out(f, path);
+}
+
+static int write_glyphs(const char *dir, const struct sheet *s, const char *count,
+                        const char *wdef, const char *hdef, const char *what, char first) {
+    char path[512];
+    FILE *f = open_out(dir, s->header, path);
+    if (!f)
+        return -1;
+    fprintf(f, "// Auto-generated by frogger_host/assetgen from %s.png, do not edit.\n"
+               "#pragma once\n#include <stdint.h>\n\n", s->name);
+    fprintf(f, "#define %s %d\n#define %s %d\n#define %s %d\n\n", count, s->count, wdef, s->w,
+            hdef, s->h);
+    fprintf(f, "// Using color 0xE for the %s pixels (bright/white) and 0x0 for background "
+               "(transparent/black)\n", what);
+    fprintf(f, "static const uint8_t %s[%s][%s * %s] = {\n", s->name, count, wdef, hdef);
+    for (int i = 0; i < s->count; ++i) {
+        char label[32];
+        sprintf(label, "%s %c", first == 'A' ? "letter" : "digit", first + i);
+        put_image(f, s, i, label, ", ");
+    }
+    fprintf(f, "};\n");
+    return close_out(f, path);
+}
+
+static int write_screen(const char *dir) {
+    char path[512];
+    FILE *f = open_out(dir, "background.mem", path);
+    if (!f)
+        return -1;
+    for (int i = 0; i < FB_W * FB_H; ++i)
+        fprintf(f, i + 1 < FB_W * FB_H ? "%X\n" : "%X", screen[i / FB_W][i % FB_W]);
+    return close_out(f, path);
+}
+
+// Bytes of one image in each layout, and its spans
+struct cost {
+    int bytes, packed, span_bytes, spans, rows;
+};
+
+static void image_cost(const struct sheet *s, int i, struct cost *c) {
+    memset(c, 0, sizeof(*c));
+    c->rows = s->h;
+    c->bytes = s->w * s->h;
+    c->packed = s->w / 2 * s->h + s->w / 8 * s->h;   // pixels and opacity masks
+    for (int y = 0; y < s->h; ++y) {
+        const uint8_t *row = &s->px[i][y * s->w];
+        c->span_bytes++;
+        for (int x = 0; x < s->w;) {
+            if (!row[x]) {
+                ++x;
+                continue;
+            }
+            int st = x;
+            while (x < s->w && row[x] == row[st])
+                ++x;
+            c->span_bytes += 2;
+            c->spans++;
+        }
+    }
+    c->span_bytes += 2;   // its start offset
+}
+
+// Decode work of the span form per 16 pixels, in tenths of OP_PX
+static int ops_spans(const struct cost *c, int w) {
+    return 10 * 2 * c->spans * 16 / (c->rows * w);
+}
+
+static void report(const struct sheet *s, int verbose) {
+    struct cost t = {0}, c;
+    int best[3] = {0};
+    static const char *const name[3] = {"bytes", "packed", "spans"};
+
+    for (int i = 0; i < s->count; ++i) {
+        image_cost(s, i, &c);
+        int o[3] = {160, 80, ops_spans(&c, s->w)};
+        int b = 0;
+        for (int k = 1; k < 3; ++k)
+            if (o[k] < o[b])
+                b = k;
+        best[b]++;
+        if (verbose)
+            printf("    %-10s %2d  spans %3d B %4.1f op/16px  -> %s\n", s->name, i, c.span_bytes,
+                   o[2] / 10.0, name[b]);
+        t.bytes += c.bytes;
+        t.packed += c.packed;
+        t.span_bytes += c.span_bytes;
+        t.spans += c.spans;
+        t.rows += c.rows;
+    }
+
+    int pixels = s->count * s->w * s->h;
+    printf("  %-11s %3d x %2dx%-2d  bytes %6d B  16.0 op | packed %5d B   8.0 op | "
+           "spans %5d B %4.1f op | rom %2d BRAM36 | fastest: bytes %d, packed %d, spans %d\n",
+           s->name, s->count, s->w, s->h, t.bytes, t.packed, t.span_bytes,
+           2.0 * t.spans * 16 / pixels, (pixels * 4 + 32767) / 32768, best[0], best[1], best[2]);
+}
+
+// The built-in headers as PNGs, index 0 opaque black
+static int write_png(const char *dir, const char *name, const uint8_t *px, int w, int h) {
+    char path[512];
+    png_image img;
+    uint8_t *rgb = malloc(w * h * 3);
+
+    if (!rgb)
+        return -1;
+    for (int i = 0; i < w * h; ++i) {
+        uint16_t c = pal[px[i] & 15];
+        rgb[i * 3] = (uint8_t)((c >> 8) * 0x11);
+        rgb[i * 3 + 1] = (uint8_t)((c >> 4 & 15) * 0x11);
+        rgb[i * 3 + 2] = (uint8_t)((c & 15) * 0x11);
+    }
+    sprintf(path, "%s/%s", dir, name);
+    memset(&img, 0, sizeof(img));
+    img.version = PNG_IMAGE_VERSION;
+    img.width = (png_uint_32)w;
+    img.height = (png_uint_32)h;
+    img.format = PNG_FORMAT_RGB;
+    int ok = png_image_write_to_file(&img, path, 0, rgb, 0, NULL);
+    if (!ok)
+        fprintf(stderr, "%s: %s\n", path, img.message);
+    free(rgb);
+    return ok ? 0 : -1;
+}
+
+static void put_cells(uint8_t *out, int w, const uint8_t *px, int count, int cw, int ch) {
+    int cols = w / cw;
+    for (int i = 0; i < count; ++i)
+        for (int y = 0; y < ch; ++y)
+            memcpy(&out[(i / cols * ch + y) * w + i % cols * cw], &px[(i * ch + y) * cw], cw);
+}
+
+static int export_sheets(const char *dir) {
+    static uint8_t sheet[FB_H * FB_W];
+    int rows = (NUM_SPRITES + SHEET_COLS - 1) / SHEET_COLS, err = 0;
+
+    memset(sheet, 0, sizeof(sheet));
+    put_cells(sheet, SHEET_COLS * SPR_W, &sprites[0][0], NUM_SPRITES, SPR_W, SPR_H);
+    err |= write_png(dir, "frog_sheet.png", sheet, SHEET_COLS * SPR_W, rows * SPR_H);
+
+    for (int y = 0; y < FB_H; ++y)
+        for (int x = 0; x < FB_W; ++x)
+            sheet[y * FB_W + x] = background[bg_tilemap[y / SPR_H][x / SPR_W]][y % SPR_H * SPR_W +
+                                                                               x % SPR_W];
+    err |= write_png(dir, "frogger_background.png", sheet, FB_W, FB_H);
+
+    put_cells(sheet, NUM_LETTERS * LETTER_W, &letters[0][0], NUM_LETTERS, LETTER_W, LETTER_H);
+    err |= write_png(dir, "letters.png", sheet, NUM_LETTERS * LETTER_W, LETTER_H);
+    put_cells(sheet, NUM_DIGITS * DIGIT_W, &numbers[0][0], NUM_DIGITS, DIGIT_W, DIGIT_H);
+    err |= write_png(dir, "numbers.png", sheet, NUM_DIGITS * DIGIT_W, DIGIT_H);
+    return err;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [-v] src_dir hdr_dir\n       %s -x src_dir\n", prog, prog);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    int opt, export = 0, verbose = 0;
+
+    while ((opt = getopt(argc, argv, "xvh")) != -1) {
+        switch (opt) {
+        case 'x':
+            export = 1;
+            break;
+        case 'v':
+            verbose = 1;
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (argc - optind != (export ? 1 : 2))
+        usage(argv[0]);
+    const char *src = argv[optind], *hdr = argv[optind + 1];
+
+    if (read_palette(src))
+        return 1;
+    if (export)
+        return export_sheets(src) ? 1 : 0;
+
+    static const struct {
+        const char *png;
+        struct sheet *s;
+    } in[4] = {
+        {"frog_sheet.png", &spr},
+        {"frogger_background.png", &tiles},
+        {"letters.png", &let},
+        {"numbers.png", &dig},
+    };
+    for (int k = 0; k < 4; ++k) {
+        int w, h;
+        uint8_t *px = read_png(src, in[k].png, &w, &h);
+        if (!px)
+            return 1;
+        int err = in[k].s == &tiles ? cut_background(px, w, h) : cut_sheet(in[k].s, px, w, h);
+        free(px);
+        if (err)
+            return 1;
+    }
+
+    if (write_sprites(hdr) || write_background(hdr) ||
+        write_glyphs(hdr, &let, "NUM_LETTERS", "LETTER_W", "LETTER_H", "letter", 'A') ||
+        write_glyphs(hdr, &dig, "NUM_DIGITS", "DIGIT_W", "DIGIT_H", "number", '0') ||
+        write_screen(src))
+        return 1;
+
+    printf("assetgen: %d sprites, %d tiles, %d letters, %d digits; op = OP_PX per 16 pixels\n",
+           spr.count, tiles.count, let.count, dig.count);
+    report(&spr, verbose);
+    report(&tiles, verbose);
+    report(&let, verbose);
+    report(&dig, verbose);
+    printf("  %-11s %d pixels: INIT_F of bram_sdp, %d BRAM36 per buffer\n", "screen",
+           FB_W * FB_H, (FB_W * FB_H * 4 + 32767) / 32768);
+    return 0;
+}
@@ -0,0 +1,537 @@
+// Per-frame cost benchmark of the renderer in ../frogger/src/main.c.
+//
+// main.c is included directly so the fixed scenarios can set up game state
+// and call its static draw routines. Each scenario is rendered through the
+// host HAL handshake; the transactions of every measured frame are turned
+// into an estimated MicroBlaze cycle count and checked against a limit, so
+// a renderer change that costs more fails the run, and against the frame
+// budget. Every scenario is run on each framebuffer variant (hal_fb_caps())
+// the renderer supports.
+//
+// With -k the scenarios are instead run with the renderer's generated sprite
+// kernels on and off, on the variants that draw sprites on the CPU, next to
+// an estimate of the code the kernels take. -s compares the span writes
+// (variant span) with the same port without them (variant axi8), next to
+// the size of the span-coded sprites. -a runs the selected scenarios with
+// the renderer's row addresses multiplied out and from its row table, each
+// costed for the soft-math core and for the hardware-math one
+// (../frogger_hwmath): four estimates per frame.
+#define main frogger_main
+#include "main.c"
+#undef main
+
+#include "hal_host.h"
+#include "opcount.h"
+#include "sprite_spans.h"
+#include "sprites.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// CPU cycles per frame at 75 MHz and the 59.94 Hz display_480p refresh
+#define FRAME_BUDGET ((uint64_t)FBEMU_FRAME_CLKS * FBEMU_CPU_HZ / FBEMU_PIX_HZ)
+
+// Latency model: CPU cycles charged per event
+static struct {
+    uint32_t write;   // AXI write incl. driver call
+    uint32_t read;    // AXI read incl. driver call
+    uint32_t mul;     // __mulsi3 / shift-add chain
+    uint32_t div;     // __divsi3 / __modsi3
+    uint32_t pixel;   // loop work around each framebuffer write
+    uint32_t px;      // pixel composed in RAM (OP_PX)
+} cost = {24, 24, 40, 200, 20, 8};
+
+// MicroBlaze code size model of the sprite kernels: a put_run() call is three
+// argument loads and brlid, one load in its delay slot; a kernel adds its
+// prologue, epilogue and the pixel pointer
+#define KERNEL_RUN_BYTES 16
+#define KERNEL_BYTES 32
+
+// Multiply on the hardware-math core: one mul, its result three cycles on
+#define HW_MUL_CYCLES 3
+
+struct sample {
+    uint64_t pixels, writes, reads, muls, divs, px;
+    uint64_t stall;   // CPU cycles waiting for the blitter
+};
+
+static const struct variant {
+    const char *name;
+    uint32_t fb_caps;
+    int reference;    // earlier port, kept for comparison: may overrun the budget
+} variants[] = {
+    {"clear", 0, 1},
+    {"keep", HAL_FB_KEEP_BACK, 1},
+    {"wide", HAL_FB_WIDE, 1},
+    {"keep8", HAL_FB_KEEP_BACK | HAL_FB_WIDE, 0},
+    {"stream", HAL_FB_STREAM, 1},
+    {"keep_s", HAL_FB_KEEP_BACK | HAL_FB_STREAM, 0},
+    {"axi8", HAL_FB_STREAM | HAL_FB_WIDE, 0},
+    {"keep_axi8", HAL_FB_KEEP_BACK | HAL_FB_STREAM | HAL_FB_WIDE, 0},
+    {"blit", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT, 0},
+    {"oam", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT | HAL_FB_OAM, 0},
+    {"keep_oam", HAL_FB_KEEP_BACK | HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_OAM, 0},
+    {"tiles", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT | HAL_FB_OAM | HAL_FB_TILES, 0},
+    {"keep_tiles", HAL_FB_KEEP_BACK | HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_OAM | HAL_FB_TILES, 0},
+    {"fill", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT | HAL_FB_FILL, 0},
+    {"lanes", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_BLIT | HAL_FB_OAM | HAL_FB_TILES | HAL_FB_FILL |
+                  HAL_FB_LANES, 0},
+    {"keep_lanes", HAL_FB_KEEP_BACK | HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_OAM | HAL_FB_TILES |
+                       HAL_FB_LANES, 0},
+    {"span", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_SPAN, 0},
+    {"triple", HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_TRIPLE, 0},
+    {"keep_tri", HAL_FB_KEEP_BACK | HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_TRIPLE, 0},
+};
+#define NUM_VARIANTS (int)(sizeof(variants) / sizeof(variants[0]))
+
+struct limit {
+    uint64_t pixels, writes, cycles;
+};
+
+// A scenario's limit for one variant, by name so variants[] can be reordered
+struct variant_limit {
+    const char *variant;
+    struct limit limit;
+};
+
+struct scenario {
+    const char *name;
+    void (*setup)(void);
+    int warmup;              // gameplay frames drawn before measuring
+    void (*enter)(void);     // state change after warm-up (optional)
+    int frames;              // measured frames
+    void (*step)(void);      // per-frame update (optional)
+    void (*draw)(void);
+    int first_frame;         // measures the first frame after hal_init()
+    struct variant_limit limit[NUM_VARIANTS];
+};
+
+static void step_play(void) {
+    update_animation();
+    update_fly_system();
+    update_turtle_animation();
+    save_positions();
+    move_lanes();
+}
+
+// ---------------------------------------------------------------------------
+// Scenarios
+// ---------------------------------------------------------------------------
+static void setup_start(void) {
+    start_new_game();
+}
+
+static void spread(struct Obj *o, int n, int pitch) {
+    for (int i = 0; i < n; ++i)
+        o[i].x = i * pitch;
+}
+
+static void setup_lanes_full(void) {
+    start_new_game();
+    score = 123450;
+    for (int i = 0; i < 4; ++i)
+        targets[i].filled = 1;
+    fly_visible = 1;
+    fly_target = 4;
+
+    spread(log_row0, LOGS_ROW0, 80);
+    spread(log_row1, LOGS_ROW1, 112);
+    spread(log_row2, LOGS_ROW2, 80);
+    spread(cars_208, 3, 80);
+    spread(cars_192, 3, 80);
+    spread(cars_176, 3, 80);
+    spread(cars_160, 2, 112);
+    spread(cars_144, 2, 112);
+    for (int c = 0; c < CLUSTERS_ROW0; ++c)
+        for (int t = 0; t < TPC_ROW0; ++t)
+            turtle_row0[c * TPC_ROW0 + t].x = c * 56 + t * TILE_W;
+    for (int c = 0; c < CLUSTERS_ROW1; ++c)
+        for (int t = 0; t < TPC_ROW1; ++t)
+            turtle_row1[c * TPC_ROW1 + t].x = c * 56 + t * TILE_W;
+}
+
+static void setup_on_turtles(void) {
+    start_new_game();
+    frog.y = 112;
+    frog.x = turtle_row1[TPC_ROW1 + 1].x;
+    frog_dir = DIR_LEFT;
+    start_animation();
+}
+
+static void step_on_turtles(void) {
+    step_play();
+    int dx = check_frog_on_log(frog.x, frog.y);
+    if (dx != -999)
+        frog.x += dx;
+}
+
+static void enter_game_over(void) {
+    game_over = 1;
+}
+
+static void enter_death(void) {
+    frog.y = 176;
+    frog.x = cars_176[0].x;
+}
+
+static void draw_play(void) {
+    draw_complete_frame();
+}
+
+static void draw_game_over_frame(void) {
+    draw_complete_frame();
+    draw_game_over();
+}
+
+static struct scenario scenarios[] = {
+    // After hal_init() the keep-back renderer knows nothing of what the buffers
+    // hold, so the first frame writes every pixel once: a one-off at power-on,
+    // behind the logo, that may overrun the budget; only their limits hold it
+    {"start", setup_start, 0, NULL, 1, NULL, draw_play, 1,
+     {{"clear", {27800, 111200, 3300000}}, {"keep", {57344, 229400, 7235000}},
+      {"wide", {27800, 20350, 1055000}}, {"keep8", {57344, 35850, 2590000}},
+      {"stream", {27800, 30000, 1350000}}, {"keep_s", {57344, 57350, 3105000}},
+      {"axi8", {27800, 7500, 745000}}, {"keep_axi8", {57344, 7200, 1900000}},
+      {"blit", {14850, 3250, 390000}}, {"oam", {14850, 3250, 375000}},
+      {"keep_oam", {57344, 7250, 1790000}}, {"tiles", {1000, 500, 35000}},
+      {"keep_tiles", {57344, 7500, 1335000}}, {"fill", {13900, 3100, 370000}},
+      {"lanes", {50, 6650, 300000}}, {"keep_lanes", {57344, 13750, 1625000}},
+      {"span", {14850, 6100, 490000}}, {"triple", {27800, 7500, 745000}},
+      {"keep_tri", {57344, 7200, 1900000}}}},
+    {"lanes_full", setup_lanes_full, 2, NULL, 4, step_play, draw_play, 0,
+     {{"clear", {31200, 124700, 3700000}}, {"keep", {6250, 24950, 1170000}},
+      {"wide", {31200, 25750, 1260000}}, {"keep8", {6250, 9450, 795000}},
+      {"stream", {31200, 33700, 1515000}}, {"keep_s", {6250, 8500, 775000}},
+      {"axi8", {31200, 10650, 900000}}, {"keep_axi8", {6250, 4200, 665000}},
+      {"blit", {15000, 3450, 405000}}, {"oam", {15000, 3450, 390000}},
+      {"keep_oam", {850, 650, 85000}}, {"tiles", {1150, 450, 40000}},
+      {"keep_tiles", {850, 650, 60000}}, {"fill", {14050, 3300, 385000}},
+      {"lanes", {200, 1000, 75000}}, {"keep_lanes", {0, 800, 60000}},
+      {"span", {15000, 7250, 540000}}, {"triple", {31000, 10650, 895000}},
+      {"keep_tri", {7650, 4400, 705000}}}},
+    {"on_turtles", setup_on_turtles, 2, NULL, 4, step_on_turtles, draw_play, 0,
+     {{"clear", {27600, 110300, 3285000}}, {"keep", {5450, 21800, 1005000}},
+      {"wide", {27600, 22050, 1100000}}, {"keep8", {5400, 8100, 680000}},
+      {"stream", {27600, 29800, 1350000}}, {"keep_s", {5400, 7300, 660000}},
+      {"axi8", {27600, 8950, 785000}}, {"keep_axi8", {5400, 3600, 570000}},
+      {"blit", {14850, 3250, 390000}}, {"oam", {14850, 3250, 375000}},
+      {"keep_oam", {0, 100, 5000}}, {"tiles", {1000, 250, 30000}},
+      {"keep_tiles", {0, 100, 5000}}, {"fill", {13900, 3150, 370000}},
+      {"lanes", {50, 900, 65000}}, {"keep_lanes", {0, 850, 65000}},
+      {"span", {14950, 6300, 505000}}, {"triple", {27400, 8850, 785000}},
+      {"keep_tri", {6650, 3650, 600000}}}},
+    {"game_over", setup_start, 2, enter_game_over, 2, NULL, draw_game_over_frame, 0,
+     {{"clear", {28800, 115150, 3435000}}, {"keep", {4450, 17700, 1345000}},
+      {"wide", {28800, 22050, 1125000}}, {"keep8", {4450, 7800, 1105000}},
+      {"stream", {28800, 31400, 1425000}}, {"keep_s", {4450, 6550, 1075000}},
+      {"axi8", {28800, 8550, 800000}}, {"keep_axi8", {4450, 3450, 1005000}},
+      {"blit", {16000, 3950, 430000}}, {"oam", {16000, 4000, 420000}},
+      {"keep_oam", {2500, 950, 140000}}, {"tiles", {2150, 1000, 70000}},
+      {"keep_tiles", {2500, 950, 105000}}, {"fill", {15050, 3850, 410000}},
+      {"lanes", {1200, 800, 45000}}, {"keep_lanes", {1150, 600, 75000}},
+      {"span", {16000, 6800, 535000}}, {"triple", {28700, 9650, 825000}},
+      {"keep_tri", {6300, 3900, 1050000}}}},
+    {"death", setup_start, 2, enter_death, 1, NULL, draw_death_frame, 0,
+     {{"clear", {27750, 110900, 3300000}}, {"keep", {3600, 14350, 785000}},
+      {"wide", {27750, 20850, 1075000}}, {"keep8", {3600, 7100, 615000}},
+      {"stream", {27750, 29950, 1360000}}, {"keep_s", {3600, 5500, 575000}},
+      {"axi8", {27750, 7900, 765000}}, {"keep_axi8", {3600, 3200, 520000}},
+      {"blit", {14850, 3250, 390000}}, {"oam", {14850, 3250, 375000}},
+      {"keep_oam", {0, 100, 5000}}, {"tiles", {1000, 250, 30000}},
+      {"keep_tiles", {0, 100, 5000}}, {"fill", {13900, 3150, 370000}},
+      {"lanes", {50, 100, 5000}}, {"keep_lanes", {0, 50, 5000}},
+      {"span", {14850, 6100, 495000}}, {"triple", {27650, 9000, 790000}},
+      {"keep_tri", {5500, 3650, 575000}}}},
+};
+
+// ---------------------------------------------------------------------------
+// Measurement
+// ---------------------------------------------------------------------------
+static void snapshot(struct sample *s) {
+    s->pixels = hal_host_stats.pixel_writes;
+    s->writes = hal_host_stats.bus_writes;
+    s->reads = hal_host_stats.bus_reads;
+    s->muls = op_count_mul;
+    s->divs = op_count_div;
+    s->px = op_count_px;
+    s->stall = hal_host_stats.stall_cycles;
+}
+
+static uint64_t estimate(const struct sample *s) {
+    return s->writes * cost.write + s->reads * cost.read + s->muls * cost.mul +
+           s->divs * cost.div + s->pixels * cost.pixel + s->px * cost.px + s->stall;
+}
+
+// One frame through the real handshake; returns the draw-phase counters
+static struct sample run_frame(void (*draw)(void)) {
+    struct sample a, b, d;
+
+    begin_frame();
+    snapshot(&a);
+    draw();
+    render_end();
+    snapshot(&b);
+    finish_frame();
+
+    d.pixels = b.pixels - a.pixels;
+    d.writes = b.writes - a.writes;
+    d.reads = b.reads - a.reads;
+    d.muls = b.muls - a.muls;
+    d.divs = b.divs - a.divs;
+    d.px = b.px - a.px;
+    d.stall = b.stall - a.stall;
+    return d;
+}
+
+// Runs scenario sc on variant v; returns the worst measured frame in *worst
+// and its estimated cycles
+static uint64_t measure(const struct scenario *sc, int v, const char *ppm_dir,
+                        struct sample *worst) {
+    uint64_t worst_cycles = 0;
+
+    hal_host_cfg.fb_caps = variants[v].fb_caps;
+    hal_init();
+    render_init();
+    // Power-on values of state start_new_game() leaves alone, so scenarios
+    // do not depend on which ran before
+    fly_visible = 1;
+    fly_target = -1;
+    sc->setup();
+    // A third buffer takes one more warm-up frame before the keep renderer
+    // knows what every buffer holds
+    int warmup = sc->warmup && (variants[v].fb_caps & HAL_FB_TRIPLE) ? sc->warmup + 1 : sc->warmup;
+    for (int i = 0; i < warmup; ++i) {
+        step_play();
+        run_frame(draw_play);
+    }
+    if (sc->enter)
+        sc->enter();
+
+    for (int i = 0; i < sc->frames; ++i) {
+        if (sc->step)
+            sc->step();
+        struct sample s = run_frame(sc->draw);
+        uint64_t cyc = estimate(&s);
+        if (cyc >= worst_cycles) {
+            *worst = s;
+            worst_cycles = cyc;
+        }
+    }
+
+    if (ppm_dir) {
+        static uint8_t screen[FBEMU_DEPTH];
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s_%s.ppm", ppm_dir, sc->name, variants[v].name);
+        fbemu_compose(&hal_host_fb, hal_host_fb.fb_front, hal_host_fb.bank, screen);
+        if (fbemu_write_ppm(screen, hal_host_fb.pal_shown, path))
+            perror(path);
+    }
+    return worst_cycles;
+}
+
+static const struct limit *find_limit(const struct scenario *sc, int v) {
+    for (int i = 0; i < NUM_VARIANTS; ++i)
+        if (sc->limit[i].variant && !strcmp(sc->limit[i].variant, variants[v].name))
+            return &sc->limit[i].limit;
+    return NULL;
+}
+
+static int run_scenario(const struct scenario *sc, int v, const char *ppm_dir) {
+    const struct limit *lim = find_limit(sc, v);
+    struct sample worst = {0};
+    uint64_t worst_cycles = measure(sc, v, ppm_dir, &worst);
+
+    int exempt = variants[v].reference ||
+                 (sc->first_frame && (variants[v].fb_caps & HAL_FB_KEEP_BACK));
+    int over = worst_cycles > FRAME_BUDGET;
+    int fail = worst.pixels > lim->pixels || worst.writes > lim->writes ||
+               worst_cycles > lim->cycles || (over && !exempt);
+    printf("%-12s %-9s %8llu %8llu %6llu %6llu %5llu %7llu %6llu %10llu %6.1f%%  %s\n",
+           sc->name, variants[v].name, (unsigned long long)worst.pixels,
+           (unsigned long long)worst.writes, (unsigned long long)worst.reads,
+           (unsigned long long)worst.muls, (unsigned long long)worst.divs,
+           (unsigned long long)worst.px, (unsigned long long)worst.stall,
+           (unsigned long long)worst_cycles,
+           worst_cycles * 100.0 / FRAME_BUDGET, fail ? "FAIL" : over ? "exempt" : "ok");
+    if (fail)
+        printf("  limit: pixels %llu, axi writes %llu, cycles %llu\n",
+               (unsigned long long)lim->pixels, (unsigned long long)lim->writes,
+               (unsigned long long)lim->cycles);
+    if (over && !exempt)
+        printf("  over the frame budget\n");
+    return fail;
+}
+
+// Sprite kernels against the generic loop
+static void compare_kernels(void) {
+    printf("%-12s %-9s %10s %10s %7s\n", "scenario", "fb", "loop", "kernels", "saved");
+    for (int v = 0; v < NUM_VARIANTS; ++v) {
+        if (variants[v].fb_caps & (HAL_FB_KEEP_BACK | HAL_FB_BLIT))
+            continue;   // sprites composed in RAM or blitted
+        for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i) {
+            struct sample s;
+            render_kernels = 0;
+            uint64_t loop = measure(&scenarios[i], v, NULL, &s);
+            render_kernels = 1;
+            uint64_t kern = measure(&scenarios[i], v, NULL, &s);
+            printf("%-12s %-9s %10llu %10llu %6.1f%%\n", scenarios[i].name, variants[v].name,
+                   (unsigned long long)loop, (unsigned long long)kern,
+                   (loop - kern) * 100.0 / loop);
+        }
+    }
+    printf("\n%d kernels, %d runs: ~%d bytes of code, %d bytes of pre-transformed pixels\n",
+           render_kernel_size[0], render_kernel_size[1],
+           render_kernel_size[1] * KERNEL_RUN_BYTES + render_kernel_size[0] * KERNEL_BYTES,
+           render_kernel_size[2]);
+}
+
+// Row table against y * FB_W, on both cores
+static void compare_math(const struct scenario *sc, int v) {
+    struct sample m, t;
+    uint32_t soft = cost.mul;
+
+    render_row_table = 0;
+    measure(sc, v, NULL, &m);
+    render_row_table = 1;
+    measure(sc, v, NULL, &t);
+
+    uint64_t ms = estimate(&m), ts = estimate(&t);
+    cost.mul = HW_MUL_CYCLES;
+    uint64_t mh = estimate(&m), th = estimate(&t);
+    cost.mul = soft;
+    printf("%-12s %-9s %6llu %6llu %10llu %10llu %10llu %10llu %6.1f%%\n", sc->name,
+           variants[v].name, (unsigned long long)m.muls, (unsigned long long)t.muls,
+           (unsigned long long)ms, (unsigned long long)mh, (unsigned long long)ts,
+           (unsigned long long)th, ((double)ms - (double)ts) * 100.0 / ms);
+}
+
+static int find_variant(const char *name) {
+    for (int v = 0; v < NUM_VARIANTS; ++v)
+        if (!strcmp(variants[v].name, name))
+            return v;
+    return -1;
+}
+
+// Span writes against packed writes on the same port
+static void compare_spans(void) {
+    int vf = find_variant("axi8"), vs = find_variant("span");
+
+    printf("%-12s %10s %10s %10s %10s %7s\n", "scenario", "axi8_wr", "span_wr", "axi8_cyc",
+           "span_cyc", "saved");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i) {
+        struct sample a, b;
+        uint64_t ca = measure(&scenarios[i], vf, NULL, &a);
+        uint64_t cb = measure(&scenarios[i], vs, NULL, &b);
+        printf("%-12s %10llu %10llu %10llu %10llu %6.1f%%\n", scenarios[i].name,
+               (unsigned long long)a.writes, (unsigned long long)b.writes,
+               (unsigned long long)ca, (unsigned long long)cb,
+               ((double)a.writes - (double)b.writes) * 100.0 / a.writes);
+    }
+    printf("\nsprites[%d][256]: %d bytes, as %d spans: %d bytes (%d saved)\n", NUM_SPRITES,
+           NUM_SPRITES * SPR_W * SPR_H, SPRITE_SPANS, SPRITE_SPAN_BYTES,
+           NUM_SPRITES * SPR_W * SPR_H - SPRITE_SPAN_BYTES);
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-w cyc] [-r cyc] [-m cyc] [-d cyc] [-p cyc] [-x cyc] [-o ppm_dir]\n"
+            "       [-k|-s|-a] [scenario|variant...]\n"
+            "  latency model in CPU cycles: -w AXI write (%u), -r AXI read (%u),\n"
+            "  -m multiply (%u), -d divide (%u), -p per-pixel loop work (%u),\n"
+            "  -x pixel composed in RAM (%u)\n"
+            "  -k  compare the sprite kernels with the generic loop instead\n"
+            "  -s  compare span writes with packed writes instead\n"
+            "  -a  compare row-table addressing with multiplies, soft and hardware math\n",
+            prog, cost.write, cost.read, cost.mul, cost.div, cost.pixel, cost.px);
+    exit(2);
+}
+
+int main(int argc, char **argv) {
+    const char *ppm_dir = NULL;
+    int opt;
+
+    int kernels = 0, spans = 0, math = 0;
+    while ((opt = getopt(argc, argv, "w:r:m:d:p:x:o:ksah")) != -1) {
+        uint32_t v = optarg ? (uint32_t)strtoul(optarg, NULL, 0) : 0;
+        switch (opt) {
+        case 'w': cost.write = v; break;
+        case 'r': cost.read = v; break;
+        case 'm': cost.mul = v; break;
+        case 'd': cost.div = v; break;
+        case 'p': cost.pixel = v; break;
+        case 'x': cost.px = v; break;
+        case 'o': ppm_dir = optarg; break;
+        case 'k': kernels = 1; break;
+        case 's': spans = 1; break;
+        case 'a': math = 1; break;
+        default: usage(argv[0]);
+        }
+    }
+    if (!cost.read)
+        usage(argv[0]);
+    hal_host_cfg.bus_write_cycles = cost.write;
+    // Every variant needs a limit in every scenario, and every limit a variant
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i)
+        for (int v = 0; v < NUM_VARIANTS; ++v) {
+            const char *lv = scenarios[i].limit[v].variant;
+            if (!find_limit(&scenarios[i], v) || !lv || find_variant(lv) < 0) {
+                fprintf(stderr, "%s: limits do not match the variants (%s)\n",
+                        scenarios[i].name, variants[v].name);
+                return 2;
+            }
+        }
+    hal_host_cfg.bus_read_cycles = cost.read;
+
+    printf("frame budget %llu cycles (75 MHz, 59.94 Hz)\n\n", (unsigned long long)FRAME_BUDGET);
+    if (kernels) {
+        compare_kernels();
+        return 0;
+    }
+    if (spans) {
+        compare_spans();
+        return 0;
+    }
+    if (math)
+        printf("%-12s %-9s %6s %6s %10s %10s %10s %10s %7s\n", "scenario", "fb", "mul",
+               "tab_mul", "mul_soft", "mul_hw", "tab_soft", "tab_hw", "saved");
+    else
+        printf("%-12s %-9s %8s %8s %6s %6s %5s %7s %6s %10s %7s\n", "scenario", "fb", "pixels",
+               "axi_wr", "axi_rd", "mul", "div", "ram_px", "stall", "est_cycles", "budget");
+
+    // Positional arguments select scenarios and/or variants by name
+    int any_sc = 0, any_v = 0;
+    for (int a = optind; a < argc; ++a) {
+        int sc = 0, v = 0;
+        for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); ++i)
+            sc |= !strcmp(argv[a], scenarios[i].name);
+        for (int i = 0; i < NUM_VARIANTS; ++i)
+            v |= !strcmp(argv[a], variants[i].name);
+        if (!sc && !v)
+            usage(argv[0]);
+        any_sc |= sc;
+        any_v |= v;
+    }
+
+    int failed = 0, ran = 0;
+    for (int v = 0; v < NUM_VARIANTS; ++v) {
+        int v_sel = !any_v;
+        for (int a = optind; a < argc; ++a)
+            v_sel |= !strcmp(argv[a], variants[v].name);
+        for (size_t i = 0; v_sel && i < sizeof(scenarios) / sizeof(scenarios[0]); ++i) {
+            int selected = !any_sc;
+            for (int a = optind; a < argc; ++a)
+                selected |= !strcmp(argv[a], scenarios[i].name);
+            if (!selected)
+                continue;
+            if (math)
+                compare_math(&scenarios[i], v);
+            else
+                failed += run_scenario(&scenarios[i], v, ppm_dir);
+            ran++;
+        }
+    }
+    if (!ran)
+        usage(argv[0]);
+    return failed ? 1 : 0;
+}
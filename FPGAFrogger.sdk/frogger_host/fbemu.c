@@ -0,0 +1,520 @@
+#include "fbemu.h"
+#include "background.h"
+#include "hal.h"
+#include "sprites.h"
+#include <stdio.h>
+#include <string.h>
+
+void fbemu_reset(struct fbemu *fb, int keep_back, int buffers) {
+    memset(fb, 0, sizeof(*fb));
+    fb->state = FBEMU_S_IDLE;
+    fb->keep_back = keep_back;
+    fb->buffers = buffers;
+    fb->fb_draw = 1;
+    fb->clr_buf = -1;
+    // palette[] of sprites.h is palette.mem, which palette_regs loads, each
+    // RGB444 digit doubled
+    for (int i = 0; i < 16; ++i)
+        fb->pal[i] = fb->pal_shown[i] =
+            (uint16_t)((palette[i] >> 12 & 0xF00) | (palette[i] >> 8 & 0xF0) |
+                       (palette[i] >> 4 & 0xF));
+}
+
+// clk_axi cycle at or after pixel clock pix, and the other way round
+// (clk_pix / clk_axi = 1007 / 3000, as in hal_host_spend())
+static uint64_t axi_at(uint64_t pix) {
+    return pix == UINT64_MAX ? UINT64_MAX : (pix * 3000 + 1006) / 1007;
+}
+
+static uint64_t pix_at(uint64_t axi) {
+    return (axi * 1007 + 2999) / 3000;
+}
+
+// IRQ_STATUS event e of axi_fb_slave
+static void irq_event(struct fbemu *fb, int e) {
+    fb->irqs[e]++;
+    fb->irq_t[e] = fb->now;
+}
+
+// Edges of frame_ready, checked after everything that can move it
+static void ready_edges(struct fbemu *fb) {
+    int r = fbemu_frame_ready(fb);
+
+    if (r != fb->ready_q)
+        irq_event(fb, r ? FBEMU_IRQ_READY_RISE : FBEMU_IRQ_READY_FALL);
+    fb->ready_q = r;
+}
+
+// State changes go through here to keep the frame-pacing counts
+static void set_state(struct fbemu *fb, int state) {
+    if (fb->state == FBEMU_S_DRAW && state != FBEMU_S_DRAW &&
+        fb->now - fb->draw_start > fb->draw_max)
+        fb->draw_max = (uint32_t)(fb->now - fb->draw_start);
+    if (fb->state != FBEMU_S_DRAW && state == FBEMU_S_DRAW)
+        fb->draw_start = fb->now;
+    if (fb->state != FBEMU_S_CLEAR && state == FBEMU_S_CLEAR)
+        fb->clear_start = fb->now;
+    if (fb->state == FBEMU_S_CLEAR && state != FBEMU_S_CLEAR)
+        fb->clear_clks += (uint32_t)(fb->now - fb->clear_start);
+    // The CPU may write any line of the buffer it draws
+    if (state == FBEMU_S_DRAW)
+        memset(fb->clean[fb->fb_draw], 0, FBEMU_H);
+    fb->state = state;
+}
+
+// Line clearer: runs up to pixel clock `until`, line by line, on clr_buf.
+// Outside S_CLEAR it clears a front buffer behind the beam, so only lines
+// already scanned in this frame; that never goes on past a frame pulse.
+static void clr_run(struct fbemu *fb, uint64_t until) {
+    if (fb->clr_buf < 0)
+        return;
+    uint8_t *clean = fb->clean[fb->clr_buf];
+    int gated = fb->state != FBEMU_S_CLEAR;
+    uint64_t frame = fb->now ? (fb->now - 1) / FBEMU_FRAME_CLKS * FBEMU_FRAME_CLKS : 0;
+
+    until = axi_at(until);
+    while (fb->clr_y < FBEMU_H) {
+        if (clean[fb->clr_y]) {
+            if (fb->clr_t + 1 > until)   // one clock per line skipped
+                break;
+            fb->clr_t++;
+            fb->clr_y++;
+            continue;
+        }
+        uint64_t start = fb->clr_t;
+        uint64_t past = axi_at(frame + (uint64_t)(FBEMU_LINE_Y0 + 1 + fb->clr_y) * FBEMU_H_TOTAL);
+        if (gated && past > start)
+            start = past;
+        if (start + FBEMU_W > until)
+            break;
+        memset(fb->bram[fb->clr_buf] + fb->clr_y * FBEMU_W, 0, FBEMU_W);
+        clean[fb->clr_y++] = 1;
+        fb->clr_t = start + FBEMU_W;
+    }
+}
+
+// Points the clearer at the buffer it works on now; it starts over from
+// line 0 when that changes
+static void clr_retarget(struct fbemu *fb) {
+    int b = -1;
+
+    if (fb->keep_back)
+        ;
+    else if (fb->state == FBEMU_S_CLEAR)
+        b = fb->fb_draw;
+    else if (fb->buffers == 3 ? fb->ready_valid : fb->state == FBEMU_S_WAIT)
+        b = fb->fb_front;   // swapped out at the next frame pulse
+    if (b != fb->clr_buf) {
+        fb->clr_buf = b;
+        fb->clr_y = 0;
+        fb->clr_t = axi_at(fb->now);
+    }
+}
+
+// The counts are copied out one clock after the pulse they include; a
+// stay in S_DRAW that is still going counts with its length so far
+static void latch_stats(struct fbemu *fb) {
+    uint32_t draw_max = fb->draw_max;
+
+    if (fb->state == FBEMU_S_DRAW && fb->now - fb->draw_start > draw_max)
+        draw_max = (uint32_t)(fb->now - fb->draw_start);
+    fb->stat[0] = fb->frame_pulses;
+    fb->stat[1] = fb->swaps;
+    fb->stat[2] = fb->missed;
+    fb->stat[3] = (uint32_t)axi_at(draw_max);   // the counters run on clk_axi
+    fb->stat[4] = (uint32_t)axi_at(fb->clear_clks);
+}
+
+// Hands fb_draw to the CPU: cleared first, or straight away with its old
+// frame
+static void start_frame(struct fbemu *fb) {
+    if (fb->keep_back) {
+        // cpu_done still high from the last frame must not end S_DRAW
+        set_state(fb, FBEMU_S_DRAW);
+        fb->done_armed = !fb->cpu_done;
+        return;
+    }
+    // Nothing can observe the clear before S_DRAW, so the lines still to
+    // clear are cleared up front
+    set_state(fb, FBEMU_S_CLEAR);
+    clr_retarget(fb);
+    if (fb->clr_t < axi_at(fb->now))
+        fb->clr_t = axi_at(fb->now);
+    clr_run(fb, UINT64_MAX);
+    fb->clear_end = pix_at(fb->clr_t + 1);   // clear_done, then S_DRAW
+}
+
+// cpu_done seen and the engines idle: with a free third buffer the frame
+// becomes fb_ready and the CPU goes on, otherwise it waits for the swap.
+// Going through S_WAIT ends the stay in S_DRAW for the statistics either way
+static void frame_taken(struct fbemu *fb) {
+    clr_run(fb, fb->now);
+    set_state(fb, FBEMU_S_WAIT);
+    if (fb->buffers == 3 && !fb->ready_valid) {
+        fb->fb_ready = fb->fb_draw;
+        fb->ready_valid = 1;
+        fb->fb_draw = 3 - fb->fb_front - fb->fb_draw;
+        start_frame(fb);
+    }
+    clr_retarget(fb);
+}
+
+static void swap_roles(struct fbemu *fb) {
+    if (fb->buffers == 3) {
+        if (!fb->ready_valid) {
+            if (fb->state == FBEMU_S_DRAW || fb->state == FBEMU_S_CLEAR)
+                fb->missed++;
+            else if (fb->state == FBEMU_S_IDLE)
+                start_frame(fb);
+            return;
+        }
+        // Show the ready frame; one waiting in S_WAIT takes its place
+        int old_front = fb->fb_front;
+        fb->fb_front = fb->fb_ready;
+        fb->ready_valid = 0;
+        fb->bank ^= 1;
+        fb->swaps++;
+        if (fb->state == FBEMU_S_WAIT) {
+            fb->fb_ready = fb->fb_draw;
+            fb->ready_valid = 1;
+            fb->fb_draw = old_front;
+            start_frame(fb);
+        }
+        return;
+    }
+
+    switch (fb->state) {
+    case FBEMU_S_IDLE:
+        break;
+    case FBEMU_S_WAIT:
+        fb->fb_front ^= 1;   // swap now
+        fb->fb_draw ^= 1;
+        fb->bank ^= 1;
+        fb->swaps++;
+        break;
+    case FBEMU_S_DRAW:
+        fb->missed++;        // late: the front buffer is shown again
+        return;
+    default:
+        return;
+    }
+    start_frame(fb);
+}
+
+// The cycle slots step in order, then pal_shown takes the result
+static void palette_pulse(struct fbemu *fb) {
+    for (int k = 0; k < FBEMU_PAL_CYCLES; ++k) {
+        uint32_t cfg = fb->pal_cycle[k];
+        int first = cfg & 0xF, last = cfg >> 4 & 0xF, rate = cfg >> 8 & 0xFF;
+
+        if (!rate)
+            continue;
+        if (++fb->pal_cnt[k] != rate)
+            continue;
+        fb->pal_cnt[k] = 0;
+        if (first >= last)
+            continue;
+        if (cfg & HAL_PAL_DOWN) {
+            uint16_t c = fb->pal[first];
+            memmove(&fb->pal[first], &fb->pal[first + 1], (size_t)(last - first) * 2);
+            fb->pal[last] = c;
+        } else {
+            uint16_t c = fb->pal[last];
+            memmove(&fb->pal[first + 1], &fb->pal[first], (size_t)(last - first) * 2);
+            fb->pal[first] = c;
+        }
+    }
+    memcpy(fb->pal_shown, fb->pal, sizeof(fb->pal));
+}
+
+static void fbemu_frame_pulse(struct fbemu *fb) {
+    fb->frame_pulses++;
+    irq_event(fb, FBEMU_IRQ_FRAME);
+    // OAM_DROP latches the count of the frame that was just shown
+    fb->oam_dropped = fbemu_compose(fb, fb->fb_front, fb->bank, NULL);
+    fb->oam_dropped_total += fb->oam_dropped;
+    clr_run(fb, fb->now);
+    swap_roles(fb);
+    clr_retarget(fb);
+    palette_pulse(fb);
+}
+
+void fbemu_advance(struct fbemu *fb, uint64_t clks) {
+    uint64_t target = fb->now + clks;
+
+    while (fb->now < target) {
+        uint64_t next = (fb->now / FBEMU_FRAME_CLKS + 1) * FBEMU_FRAME_CLKS;
+        if (fb->state == FBEMU_S_CLEAR && fb->clear_end < next)
+            next = fb->clear_end;
+        int done_wait = fb->state == FBEMU_S_DRAW && fb->cpu_done && fb->done_armed;
+        uint64_t engines_end = fb->blit_end > fb->fill_end ? fb->blit_end : fb->fill_end;
+        if (done_wait && engines_end > fb->now && engines_end < next)
+            next = engines_end;
+        if (next > target) {
+            fb->now = target;
+            break;
+        }
+        fb->now = next;
+
+        if (fb->state == FBEMU_S_CLEAR && fb->now == fb->clear_end) {
+            // A cpu_done still high from the last frame must be dropped first
+            set_state(fb, FBEMU_S_DRAW);
+            fb->done_armed = !fb->cpu_done;
+            clr_retarget(fb);
+        }
+        if (done_wait && fb->now == engines_end)
+            frame_taken(fb);   // last queued sprite or fill drawn
+        if (fb->now % FBEMU_FRAME_CLKS == 0) {
+            fbemu_frame_pulse(fb);
+            latch_stats(fb);
+        }
+        ready_edges(fb);
+    }
+}
+
+void fbemu_write(struct fbemu *fb, uint16_t addr, uint8_t c) {
+    if (fb->state != FBEMU_S_DRAW || addr >= FBEMU_DEPTH) {
+        fb->dropped++;
+        return;
+    }
+    fb->bram[fb->fb_draw][addr] = c & 0xF;
+    fb->writes++;
+}
+
+void fbemu_write8(struct fbemu *fb, uint16_t group, uint32_t pix, uint8_t mask) {
+    for (int k = 0; k < 8; ++k, pix >>= 4, mask >>= 1)
+        if (mask & 1)
+            fbemu_write(fb, (uint16_t)(group * 8 + k), pix & 0xF);
+}
+
+void fbemu_blit(struct fbemu *fb, uint32_t cmd) {
+    // The FIFO only starts commands in S_DRAW; the CPU never queues any
+    // outside it, so the model drops them like pixel writes
+    if (fb->state != FBEMU_S_DRAW) {
+        fb->dropped++;
+        return;
+    }
+    const uint8_t *spr = sprites[cmd & 0x3F];
+    int x0 = (int)((cmd >> 6) & 0x1FF), y0 = (int)((cmd >> 15) & 0x1FF);
+    int key = cmd & HAL_BLIT_OPAQUE ? -1 : (int)((cmd >> 27) & 0xF);
+    if (x0 & 0x100)
+        x0 -= 0x200;
+    if (y0 & 0x100)
+        y0 -= 0x200;
+
+    for (int dy = 0; dy < 16; ++dy)
+        for (int dx = 0; dx < 16; ++dx) {
+            // flips on the screen position, then the rotation
+            int fx = cmd & HAL_BLIT_FLIP_H ? 15 - dx : dx;
+            int fy = cmd & HAL_BLIT_FLIP_V ? 15 - dy : dy;
+            int sx = cmd & HAL_BLIT_ROT ? 15 - fy : fx;
+            int sy = cmd & HAL_BLIT_ROT ? fx : fy;
+            int x = x0 + dx, y = y0 + dy;
+            uint8_t c = spr[sy * 16 + sx];
+            if (x >= 0 && x < FBEMU_W && y >= 0 && y < FBEMU_H && c != key)
+                fb->bram[fb->fb_draw][y * FBEMU_W + x] = c & 0xF;
+        }
+
+    fb->blits++;
+    fb->blit_end = (fb->blit_end > fb->now ? fb->blit_end : fb->now) + pix_at(FBEMU_BLIT_CLKS);
+}
+
+uint64_t fbemu_blit_busy(const struct fbemu *fb) {
+    return fb->blit_end > fb->now ? fb->blit_end - fb->now : 0;
+}
+
+uint64_t fbemu_blit_full(const struct fbemu *fb) {
+    uint64_t busy = fbemu_blit_busy(fb);
+    uint64_t room = FBEMU_BLIT_SLOTS * pix_at(FBEMU_BLIT_CLKS);
+    return busy > room ? busy - room : 0;
+}
+
+void fbemu_fill(struct fbemu *fb, int x, int y, int w, int h, uint8_t c) {
+    if (fb->state != FBEMU_S_DRAW) {
+        fb->dropped++;
+        return;
+    }
+    for (int py = y; py < y + h && py < FBEMU_H; ++py)
+        for (int px = x; px < x + w && px < FBEMU_W; ++px)
+            fb->bram[fb->fb_draw][py * FBEMU_W + px] = c & 0xF;
+
+    uint64_t start = fb->fill_end > fb->now ? fb->fill_end : fb->now;
+    fb->fill_start[fb->fill_jobs++ % FBEMU_FILL_SLOTS] = start;
+    fb->fill_end = start + pix_at(FBEMU_FILL_SETUP + (uint64_t)w * h);
+    fb->fills++;
+}
+
+void fbemu_span(struct fbemu *fb, int idx, int n, uint8_t c) {
+    if (fb->state != FBEMU_S_DRAW) {
+        fb->dropped++;
+        return;
+    }
+    for (int i = idx; i < idx + n && i < FBEMU_DEPTH; ++i)
+        fb->bram[fb->fb_draw][i] = c & 0xF;
+
+    uint64_t start = fb->fill_end > fb->now ? fb->fill_end : fb->now;
+    fb->fill_start[fb->fill_jobs++ % FBEMU_FILL_SLOTS] = start;
+    fb->fill_end = start + pix_at(FBEMU_FILL_SETUP + (uint64_t)n);
+    fb->fills++;
+}
+
+uint64_t fbemu_fill_busy(const struct fbemu *fb) {
+    return fb->fill_end > fb->now ? fb->fill_end - fb->now : 0;
+}
+
+uint64_t fbemu_fill_full(const struct fbemu *fb) {
+    // Full while the job FBEMU_FILL_SLOTS back has not left the FIFO
+    if (fb->fill_jobs < FBEMU_FILL_SLOTS)
+        return 0;
+    uint64_t start = fb->fill_start[fb->fill_jobs % FBEMU_FILL_SLOTS];
+    return start > fb->now ? start - fb->now : 0;
+}
+
+void fbemu_set_cpu_done(struct fbemu *fb, int done) {
+    fb->cpu_done = done;
+    if (fb->state == FBEMU_S_DRAW) {
+        if (!done)
+            fb->done_armed = 1;
+        else if (fb->done_armed && !fbemu_blit_busy(fb) && !fbemu_fill_busy(fb))
+            frame_taken(fb);
+    }
+    ready_edges(fb);
+}
+
+void fbemu_oam_write(struct fbemu *fb, int i, uint32_t entry) {
+    fb->oam[fb->bank ^ 1][i & (FBEMU_OAM_ENTRIES - 1)] = entry;
+}
+
+void fbemu_tile_write(struct fbemu *fb, int i, uint8_t tile) {
+    if ((unsigned)i < FBEMU_TILES_X * FBEMU_TILES_Y)
+        fb->tiles[fb->bank ^ 1][i] = tile & 0xF;
+}
+
+void fbemu_lane_write8(struct fbemu *fb, int b, int row, int group, uint32_t pix, uint8_t mask) {
+    if (fb->state != FBEMU_S_DRAW) {
+        fb->dropped++;
+        return;
+    }
+    if (b < FBEMU_LANE_FIRST || b > FBEMU_LANE_LAST)
+        return;
+    uint8_t *px = &fb->lanes[fb->bank ^ 1][b][row & 15][(group & 63) * 8];
+    for (int k = 0; k < 8; ++k, pix >>= 4, mask >>= 1)
+        if (mask & 1)
+            px[k] = pix & 0xF;
+}
+
+void fbemu_lane_scroll(struct fbemu *fb, int b, uint32_t reg) {
+    fb->scroll[fb->bank ^ 1][b & 15] = reg & 0x3FFFF;
+}
+
+void fbemu_palette_write(struct fbemu *fb, int i, uint16_t rgb) {
+    fb->pal[i & 15] = rgb & 0xFFF;
+}
+
+void fbemu_palette_cycle(struct fbemu *fb, int k, uint32_t cfg) {
+    if ((unsigned)k < FBEMU_PAL_CYCLES) {
+        fb->pal_cycle[k] = cfg & 0x1FFFF;
+        fb->pal_cnt[k] = 0;
+    }
+}
+
+int fbemu_frame_ready(const struct fbemu *fb) {
+    // With three buffers it also falls while a taken frame's cpu_done is up
+    return fb->state == FBEMU_S_DRAW && (fb->done_armed || fb->buffers < 3);
+}
+
+int fbemu_vsync(const struct fbemu *fb) {
+    uint64_t t = fb->now % FBEMU_FRAME_CLKS;
+    return !(t >= FBEMU_VSYNC_START && t < FBEMU_VSYNC_END);   // active low
+}
+
+const uint8_t *fbemu_back(const struct fbemu *fb) {
+    return fb->bram[fb->fb_draw];
+}
+
+const uint8_t *fbemu_front(const struct fbemu *fb) {
+    return fb->bram[fb->fb_front];
+}
+
+uint32_t fbemu_compose(const struct fbemu *fb, int b, int bank, uint8_t *out) {
+    const uint32_t *oam = fb->oam[bank];
+    uint8_t line[FBEMU_W];     // colour | 0x10 for behind, 0 = no object
+    uint32_t dropped = 0;
+
+    for (int y = 0; y < FBEMU_H; ++y) {
+        int hits = 0;
+        memset(line, 0, sizeof(line));
+        for (int i = 0; i < FBEMU_OAM_ENTRIES; ++i) {
+            uint32_t e = oam[i];
+            int ey = (int)((e >> 15) & 0x1FF), dy;
+            if (ey & 0x100)
+                ey -= 0x200;
+            dy = y - ey;
+            if (!(e & HAL_OAM_ENABLE) || dy < 0 || dy >= 16)
+                continue;
+            if (hits++ == FBEMU_OAM_PER_LINE) {
+                hits--;
+                dropped++;
+                continue;
+            }
+            if (!out)
+                continue;
+
+            const uint8_t *spr = sprites[e & 0x3F];
+            int x0 = (int)((e >> 6) & 0x1FF);
+            if (x0 & 0x100)
+                x0 -= 0x200;
+            for (int dx = 0; dx < 16; ++dx) {
+                int fx = e & HAL_BLIT_FLIP_H ? 15 - dx : dx;
+                int fy = e & HAL_BLIT_FLIP_V ? 15 - dy : dy;
+                int sx = e & HAL_BLIT_ROT ? 15 - fy : fx;
+                int sy = e & HAL_BLIT_ROT ? fx : fy;
+                int x = x0 + dx;
+                uint8_t c = spr[sy * 16 + sx] & 0xF;
+                if (c && x >= 0 && x < FBEMU_W)
+                    line[x] = c | (e & HAL_OAM_BEHIND ? 0x10 : 0);
+            }
+        }
+        if (!out)
+            continue;
+        const uint8_t *fbrow = fb->bram[b] + y * FBEMU_W;
+        const uint8_t *tmap = fb->tiles[bank] + y / 16 * FBEMU_TILES_X;
+        int band = y / 16, width = (int)(fb->scroll[bank][band] >> 9);
+        int scroll = (int)(fb->scroll[bank][band] & 0x1FF);
+        const uint8_t *lane = fb->lanes[bank][band][y % 16];
+        if (band < FBEMU_LANE_FIRST || band > FBEMU_LANE_LAST)
+            width = 0;
+        uint8_t *row = out + y * FBEMU_W;
+        for (int x = 0; x < FBEMU_W; ++x) {
+            uint8_t tid = tmap[x / 16];
+            uint8_t c = fbrow[x];
+            if (line[x] && (!(line[x] & 0x10) || !c)) {
+                c = line[x] & 0xF;
+            } else if (!c) {
+                int lx = x + scroll;
+                if (width && (c = lane[lx >= width ? lx - width : lx]))
+                    ;
+                else if (tid && tid < BG_NUM_SPRITES)
+                    c = background[tid][y % 16 * 16 + x % 16] & 0xF;
+            }
+            row[x] = c;
+        }
+    }
+    return dropped;
+}
+
+int fbemu_write_ppm(const uint8_t *buf, const uint16_t *pal, const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f)
+        return -1;
+
+    fprintf(f, "P6\n%d %d\n255\n", FBEMU_W, FBEMU_H);
+    for (int i = 0; i < FBEMU_DEPTH; ++i) {
+        // RGB444 digits doubled, as palette[] of sprites.h has them
+        uint16_t rgb = pal[buf[i] & 0xF];
+        uint8_t px[3] = {(uint8_t)((rgb >> 8) * 0x11), (uint8_t)((rgb >> 4 & 0xF) * 0x11),
+                         (uint8_t)((rgb & 0xF) * 0x11)};
+        fwrite(px, 1, sizeof(px), f);
+    }
+    return fclose(f);
+}
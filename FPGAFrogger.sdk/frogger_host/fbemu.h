@@ -0,0 +1,156 @@
+// Cycle-level model of vga_framebuffer_top as seen from the CPU side:
+// the S_IDLE/S_CLEAR/S_DRAW/S_WAIT double- or triple-buffer machine and its
+// line clearer, the 4bpp BRAMs, the frame_ready/cpu_done handshake, the
+// sprite blitter, the fill engine, the object, lane and tile layers, the
+// palette registers and the display_480p timing.
+#pragma once
+#include <stdint.h>
+
+#define FBEMU_W 224
+#define FBEMU_H 256
+#define FBEMU_DEPTH (FBEMU_W * FBEMU_H)
+
+// display_480p: 800 x 525 pixel clocks, frame pulse at the first front-porch
+// line, vsync low V_FP lines later for V_SYNC lines
+#define FBEMU_H_TOTAL 800
+#define FBEMU_V_TOTAL 525
+#define FBEMU_FRAME_CLKS (FBEMU_H_TOTAL * FBEMU_V_TOTAL)
+#define FBEMU_VSYNC_START (10 * FBEMU_H_TOTAL)
+#define FBEMU_VSYNC_END (12 * FBEMU_H_TOTAL)
+// lines from the frame pulse to the first window line
+#define FBEMU_LINE_Y0 (FBEMU_V_TOTAL - 480 + (480 - FBEMU_H) / 2)
+
+// The blitter, the fill engine and the line clearer run on clk_axi (the
+// CPU clock); their clocks below are that clock's, the model converts them.
+// sprite_blitter: clocks per command, commands queued before blit_full
+#define FBEMU_BLIT_CLKS 257
+#define FBEMU_BLIT_SLOTS 14
+
+// fill_engine: setup clocks per job (then one clock per pixel), jobs queued
+// before fill_full
+#define FBEMU_FILL_SETUP 2
+#define FBEMU_FILL_SLOTS 6
+
+// oam_layer: entries per bank, entries drawn per line
+#define FBEMU_OAM_ENTRIES 64
+#define FBEMU_OAM_PER_LINE 32
+
+// lane_layer: bands with a lane buffer, lane buffer width
+#define FBEMU_LANE_FIRST 3
+#define FBEMU_LANE_LAST 13
+#define FBEMU_LANE_W 512
+
+// tile_layer: 14x16 tilemap of 16x16 tiles
+#define FBEMU_TILES_X 14
+#define FBEMU_TILES_Y 16
+
+// palette_regs: palette-cycle slots (PAL_CYCLES)
+#define FBEMU_PAL_CYCLES 4
+
+// clk_pix = 25.175 MHz, CPU/AXI clock = 75 MHz
+#define FBEMU_PIX_HZ 25175000u
+#define FBEMU_CPU_HZ 75000000u
+
+enum { FBEMU_S_IDLE, FBEMU_S_CLEAR, FBEMU_S_DRAW, FBEMU_S_WAIT };
+
+// IRQ_STATUS events of axi_fb_slave, in the order of its bits
+enum { FBEMU_IRQ_READY_RISE, FBEMU_IRQ_READY_FALL, FBEMU_IRQ_FRAME, FBEMU_NUM_IRQS };
+
+struct fbemu {
+    uint8_t bram[3][FBEMU_DEPTH];
+    uint32_t oam[2][FBEMU_OAM_ENTRIES];   // oam[bank] is shown with fb_front
+    uint8_t tiles[2][FBEMU_TILES_X * FBEMU_TILES_Y];   // likewise
+    uint8_t lanes[2][16][16][FBEMU_LANE_W];           // likewise, [band][row]
+    uint32_t scroll[2][16];                            // scroll | width << 9
+    uint16_t pal[16];         // RGB444 palette as written and cycled
+    uint16_t pal_shown[16];   // copy of pal taken at each frame pulse
+    uint32_t pal_cycle[FBEMU_PAL_CYCLES];   // cycle slots, HAL_PAL_CYCLE()
+    uint8_t pal_cnt[FBEMU_PAL_CYCLES];      // frame pulses since their last step
+    int state;
+    int buffers;         // NUM_BUFFERS: 2, or 3 for triple buffering
+    int fb_front;        // bram on screen
+    int fb_draw;         // bram the CPU draws into
+    int fb_ready;        // finished bram shown at the next frame pulse (3 only)
+    int ready_valid;
+    int bank;            // layer bank on screen, flips at each swap
+    uint8_t clean[3][FBEMU_H];   // line holds only the clear colour
+    int clr_buf;         // buffer the line clearer works on, -1 = idle
+    int clr_y;           // its next line
+    uint64_t clr_t;      // clk_axi cycle at which it is done with the last one
+    int cpu_done;
+    int keep_back;       // CLEAR_BACK = 0: swap hands the old frame to the CPU
+    int done_armed;      // cpu_done was seen low since S_DRAW was entered
+    uint64_t now;        // pixel clocks since reset
+    uint64_t clear_start;   // pixel clock at which S_CLEAR was entered
+    uint64_t clear_end;  // pixel clock at which S_CLEAR finishes
+    uint64_t blit_end;   // pixel clock at which the blitter goes idle
+    uint64_t fill_end;   // likewise the fill engine
+    uint64_t fill_start[FBEMU_FILL_SLOTS];   // start clocks of the last jobs
+    uint32_t fill_jobs;
+    uint64_t draw_start; // pixel clock at which S_DRAW was entered
+
+    // statistics
+    uint32_t frame_pulses;
+    uint32_t swaps;
+    uint32_t missed;     // frame pulses with nothing to swap in while drawing
+    uint32_t draw_max;   // longest stay in S_DRAW, pixel clocks
+    uint32_t clear_clks; // pixel clocks spent in S_CLEAR
+    uint32_t stat[5];    // VSYNCS..CLEAR_CLKS of the slave, as of the last frame pulse
+    uint32_t writes;     // pixel writes accepted in S_DRAW
+    uint32_t dropped;    // pixel writes outside S_DRAW or out of range
+    uint32_t blits;      // blitter commands drawn
+    uint32_t fills;      // fill jobs drawn
+    uint32_t oam_dropped;        // OAM_DROP: entries over the line limit, last frame
+    uint64_t oam_dropped_total;  // summed over all frames shown
+    int ready_q;                      // frame_ready at the last edge check
+    uint32_t irqs[FBEMU_NUM_IRQS];    // IRQ_STATUS events since reset
+    uint64_t irq_t[FBEMU_NUM_IRQS];   // pixel clock of the last one
+};
+
+// keep_back selects the CLEAR_BACK = 0 variant, buffers NUM_BUFFERS
+void fbemu_reset(struct fbemu *fb, int keep_back, int buffers);
+void fbemu_advance(struct fbemu *fb, uint64_t clks);
+
+void fbemu_write(struct fbemu *fb, uint16_t addr, uint8_t c);
+// Packed write port: pixels of 8-pixel group `group` selected by mask
+void fbemu_write8(struct fbemu *fb, uint16_t group, uint32_t pix, uint8_t mask);
+// Sprite blitter command (HAL_BLIT_* word). The sprite is drawn at once;
+// blit_end tracks when the hardware would be done with it
+void fbemu_blit(struct fbemu *fb, uint32_t cmd);
+// Pixel clocks until the blitter is idle / has room for another command
+uint64_t fbemu_blit_busy(const struct fbemu *fb);
+uint64_t fbemu_blit_full(const struct fbemu *fb);
+// Fill job; drawn at once, fill_end tracks the hardware like blit_end
+void fbemu_fill(struct fbemu *fb, int x, int y, int w, int h, uint8_t c);
+// Span job: n pixels from idx on in colour c, timed like a fill
+void fbemu_span(struct fbemu *fb, int idx, int n, uint8_t c);
+uint64_t fbemu_fill_busy(const struct fbemu *fb);
+uint64_t fbemu_fill_full(const struct fbemu *fb);
+void fbemu_set_cpu_done(struct fbemu *fb, int done);
+// Write entry i of the OAM bank that goes with the back buffer
+void fbemu_oam_write(struct fbemu *fb, int i, uint32_t entry);
+// Write tilemap entry i of the bank that goes with the back buffer
+void fbemu_tile_write(struct fbemu *fb, int i, uint8_t tile);
+// Lane buffer packed write and scroll register, same bank
+void fbemu_lane_write8(struct fbemu *fb, int b, int row, int group, uint32_t pix, uint8_t mask);
+void fbemu_lane_scroll(struct fbemu *fb, int b, uint32_t reg);
+// Palette entry i and cycle slot k; both reach pal_shown at the next frame
+// pulse
+void fbemu_palette_write(struct fbemu *fb, int i, uint16_t rgb);
+void fbemu_palette_cycle(struct fbemu *fb, int k, uint32_t cfg);
+int fbemu_frame_ready(const struct fbemu *fb);
+int fbemu_vsync(const struct fbemu *fb);
+
+const uint8_t *fbemu_back(const struct fbemu *fb);
+const uint8_t *fbemu_front(const struct fbemu *fb);
+
+// What the display shows for buffer b with layer bank `bank`: bram[b] over
+// the lanes of that bank over its tiles, with its objects composited the
+// way oam_layer does it.
+// out may be NULL; returns the number of entries dropped by the per-line
+// limit
+uint32_t fbemu_compose(const struct fbemu *fb, int b, int bank, uint8_t *out);
+
+// Write a buffer through a 16-entry RGB444 palette (pal or pal_shown) as
+// binary PPM
+int fbemu_write_ppm(const uint8_t *buf, const uint16_t *pal, const char *path);
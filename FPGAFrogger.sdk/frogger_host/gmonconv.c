@@ -0,0 +1,195 @@
+// Turns the profile of the -pg firmware (../frogger_profile) into a gmon.out
+// for mb-gprof.
+//
+//   gmonconv uart.log gmon.out             from gmon_dump() on the UART
+//   gmonconv -k kcount.bin [-r hz] gmon.out
+//
+// The UART log may hold anything else around the dump (see gmon.c for its
+// format); the last complete dump in it is used. -k takes the histogram
+// read over JTAG instead, e.g. with xsct after stopping the CPU:
+//
+//   mrd -bin -file kcount.bin <address of kcount from mb-nm> 2048
+//
+// as raw little-endian 16-bit bins of 16 bytes of code each from address 0,
+// sampled at hz (default 100000, SAMPLE_FREQ_HZ of the BSP). That gives the
+// flat profile only; the call arcs come with the UART dump.
+//
+// gmon.out is the GNU format, version 1, in the byte order and address size
+// of the MicroBlaze: little-endian, 32 bits.
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_BINS 16384
+#define MAX_ARCS 4096
+
+static uint32_t lowpc, highpc, nbins, rate = 100000;
+static uint16_t bins[MAX_BINS];
+static uint32_t arcs[MAX_ARCS][3];   // frompc, selfpc, count
+static int narcs;
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s uart.log gmon.out\n"
+            "       %s -k kcount.bin [-r hz] gmon.out\n",
+            prog, prog);
+    exit(2);
+}
+
+static int read_uart(const char *path) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    char line[256];
+    int in_dump = 0, done = 0;
+    uint32_t lo = 0, hi = 0, n = 0, hz = 0, a, b, c;
+    static uint16_t cur[MAX_BINS];
+    static uint32_t cur_arcs[MAX_ARCS][3];
+    int cur_narcs = 0;
+
+    while (fgets(line, sizeof(line), f)) {
+        if (sscanf(line, "gmon %x %x %x %x", &lo, &hi, &n, &hz) == 4) {
+            if (n > MAX_BINS || hi - lo != n * 16) {
+                fprintf(stderr, "%s: bad dump header: %s", path, line);
+                fclose(f);
+                return -1;
+            }
+            memset(cur, 0, sizeof(cur));
+            cur_narcs = 0;
+            in_dump = 1;
+        } else if (!in_dump) {
+            continue;
+        } else if (sscanf(line, "h %x %x", &a, &b) == 2) {
+            if (a < n)
+                cur[a] = (uint16_t)b;
+        } else if (sscanf(line, "a %x %x %x", &a, &b, &c) == 3) {
+            if (cur_narcs < MAX_ARCS) {
+                cur_arcs[cur_narcs][0] = a;
+                cur_arcs[cur_narcs][1] = b;
+                cur_arcs[cur_narcs][2] = c;
+                cur_narcs++;
+            }
+        } else if (sscanf(line, "overflow %x %x", &a, &b) == 2) {
+            fprintf(stderr, "%s: warning: call tables overflowed (%u call sites, %u arcs), "
+                            "the arcs are incomplete\n", path, a, b);
+        } else if (!strncmp(line, "end", 3)) {
+            lowpc = lo;
+            highpc = hi;
+            nbins = n;
+            rate = hz;
+            memcpy(bins, cur, sizeof(bins));
+            memcpy(arcs, cur_arcs, sizeof(arcs));
+            narcs = cur_narcs;
+            in_dump = 0;
+            done = 1;
+        }
+    }
+    fclose(f);
+    if (!done) {
+        fprintf(stderr, "%s: no complete gmon dump\n", path);
+        return -1;
+    }
+    return 0;
+}
+
+static int read_kcount(const char *path) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        perror(path);
+        return -1;
+    }
+
+    uint8_t b[2];
+    while (nbins < MAX_BINS && fread(b, 1, 2, f) == 2)
+        bins[nbins++] = (uint16_t)(b[0] | b[1] << 8);
+    fclose(f);
+    if (!nbins) {
+        fprintf(stderr, "%s: empty\n", path);
+        return -1;
+    }
+    lowpc = 0;
+    highpc = nbins * 16;
+    return 0;
+}
+
+static void put32(FILE *f, uint32_t v) {
+    uint8_t b[4] = {(uint8_t)v, (uint8_t)(v >> 8), (uint8_t)(v >> 16), (uint8_t)(v >> 24)};
+    fwrite(b, 1, 4, f);
+}
+
+static void put16(FILE *f, uint16_t v) {
+    uint8_t b[2] = {(uint8_t)v, (uint8_t)(v >> 8)};
+    fwrite(b, 1, 2, f);
+}
+
+int main(int argc, char **argv) {
+    const char *kcount = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "k:r:h")) != -1) {
+        switch (opt) {
+        case 'k':
+            kcount = optarg;
+            break;
+        case 'r':
+            rate = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (argc - optind != (kcount ? 1 : 2) || !rate)
+        usage(argv[0]);
+    if (kcount ? read_kcount(kcount) : read_uart(argv[optind]))
+        return 1;
+
+    const char *out = argv[argc - 1];
+    FILE *f = fopen(out, "wb");
+    if (!f) {
+        perror(out);
+        return 1;
+    }
+
+    // Header: cookie, version, 12 spare bytes
+    static const char spare[12];
+    fwrite("gmon", 1, 4, f);
+    put32(f, 1);
+    fwrite(spare, 1, sizeof(spare), f);
+
+    // Histogram record
+    static const char dimen[15] = "seconds";
+    fputc(0, f);
+    put32(f, lowpc);
+    put32(f, highpc);
+    put32(f, nbins);
+    put32(f, rate);
+    fwrite(dimen, 1, sizeof(dimen), f);
+    fputc('s', f);
+    for (uint32_t i = 0; i < nbins; ++i)
+        put16(f, bins[i]);
+
+    // Call-graph arcs
+    for (int i = 0; i < narcs; ++i) {
+        fputc(1, f);
+        put32(f, arcs[i][0]);
+        put32(f, arcs[i][1]);
+        put32(f, arcs[i][2]);
+    }
+
+    if (fclose(f)) {
+        perror(out);
+        return 1;
+    }
+
+    uint64_t samples = 0;
+    for (uint32_t i = 0; i < nbins; ++i)
+        samples += bins[i];
+    printf("%s: %u bins 0x%x..0x%x, %llu samples (%.2f s), %d arcs\n", out, nbins, lowpc,
+           highpc, (unsigned long long)samples, (double)samples / rate, narcs);
+    return 0;
+}
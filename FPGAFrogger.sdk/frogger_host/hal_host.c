@@ -0,0 +1,512 @@
+// Headless backend of hal.h. Every call is charged as the AXI transactions the
+// board backend issues for it, CPU time is derived from those transactions
+// and the framebuffer model is advanced in lock step, so a run is fully
+// deterministic for a given configuration and keypad script.
+#include "hal_host.h"
+#include "hal.h"
+#include "opcount.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_KEY_EVENTS 256
+
+// Frame interrupt: the entry and exit and the intc's handler around the
+// one of hal_board.c, whose two slave reads and one write are charged as
+// bus transactions
+#define IRQ_CYCLES 120
+// hal_idle() is modelled in steps of this many cycles, so it wakes within
+// 1 us of an interrupt
+#define IDLE_STEP 75
+
+struct hal_host_cfg hal_host_cfg = {
+    .frames = 0,
+    .ppm_dir = NULL,
+    .ppm_every = 1,
+    .keys = NULL,
+    .bus_write_cycles = 24,
+    .bus_read_cycles = 24,
+    .fb_caps = 0,
+    .trace_path = NULL,
+};
+struct hal_host_stats hal_host_stats;
+struct fbemu hal_host_fb;
+uint32_t op_count_mul, op_count_div, op_count_px;
+
+static struct {
+    uint32_t frame;
+    uint8_t key;
+} key_events[MAX_KEY_EVENTS];
+static int num_key_events;
+
+// Shadows of the axi_fb_slave FB_ADDR / FB_MASK registers (HAL_FB_STREAM)
+static uint16_t fb_cursor;
+static uint8_t fb_mask;
+static uint8_t fb_fill_col;
+static uint16_t lane_cursor;
+
+// GPIO write-port trace for tb_vga_framebuffer_top
+static FILE *trace;
+
+// Frame interrupts as the handler has counted them, with the CPU cycle of
+// the event, and the model's events handled so far / when hal_idle() last
+// returned
+static uint32_t irq_counts[HAL_NUM_IRQS], irq_stamps[HAL_NUM_IRQS];
+static uint32_t irqs_handled, irqs_idle;
+
+void hal_host_spend(uint64_t cycles) {
+    hal_host_stats.cycles += cycles;
+
+    // clk_pix / clk_cpu = 25.175 / 75 = 1007 / 3000
+    uint64_t c = hal_host_stats.cycles;
+    uint64_t pix = c / 3000 * 1007 + c % 3000 * 1007 / 3000;
+    if (pix > hal_host_fb.now)
+        fbemu_advance(&hal_host_fb, pix - hal_host_fb.now);
+}
+
+static void bus_write(void) {
+    hal_host_stats.bus_writes++;
+    hal_host_spend(hal_host_cfg.bus_write_cycles);
+}
+
+// One line per GPIO write, "<cpu cycle> <signal> <hex value>", stamped
+// with the cycle the write completes in: A cpu_addr, D cpu_dat, W cpu_we,
+// P cpu_dat8, M cpu_mask8, E cpu_we8, C cpu_done
+static void trace_write(char sig, uint32_t v) {
+    bus_write();
+    if (trace)
+        fprintf(trace, "%llu %c %x\n", (unsigned long long)hal_host_stats.cycles, sig, v);
+}
+
+// Hold the CPU for clks pixel clocks, as axi_fb_slave does while the blitter
+// or fill engine is busy or its FIFO full
+static void blit_stall(uint64_t clks) {
+    if (!clks)
+        return;
+    uint64_t cycles = (clks * 3000 + 1006) / 1007;
+    hal_host_stats.stall_cycles += cycles;
+    hal_host_spend(cycles);
+}
+
+static uint64_t max_clks(uint64_t a, uint64_t b) {
+    return a > b ? a : b;
+}
+
+static void blit_sync(void) {
+    if (hal_host_cfg.fb_caps & (HAL_FB_BLIT | HAL_FB_FILL | HAL_FB_SPAN))
+        blit_stall(max_clks(fbemu_blit_busy(&hal_host_fb), fbemu_fill_busy(&hal_host_fb)));
+}
+
+static void bus_read(void) {
+    hal_host_stats.bus_reads++;
+    hal_host_spend(hal_host_cfg.bus_read_cycles);
+}
+
+static void parse_keys(const char *script) {
+    while (script && *script && num_key_events < MAX_KEY_EVENTS) {
+        char *end;
+        unsigned long frame = strtoul(script, &end, 10);
+        if (end == script || *end != ':' || !end[1]) {
+            fprintf(stderr, "hal_host: bad key script at '%s'\n", script);
+            exit(2);
+        }
+        key_events[num_key_events].frame = (uint32_t)frame;
+        key_events[num_key_events].key = (uint8_t)end[1];
+        num_key_events++;
+
+        script = strchr(end, ',');
+        if (script)
+            script++;
+    }
+}
+
+void hal_init(void) {
+    fbemu_reset(&hal_host_fb, (hal_host_cfg.fb_caps & HAL_FB_KEEP_BACK) != 0,
+                hal_host_cfg.fb_caps & HAL_FB_TRIPLE ? 3 : 2);
+    memset(&hal_host_stats, 0, sizeof(hal_host_stats));
+    op_count_mul = op_count_div = op_count_px = 0;
+    num_key_events = 0;
+    parse_keys(hal_host_cfg.keys);
+    if (hal_host_cfg.trace_path && !trace) {
+        trace = fopen(hal_host_cfg.trace_path, "w");
+        if (!trace) {
+            perror(hal_host_cfg.trace_path);
+            exit(1);
+        }
+    }
+
+    // Same setup writes as the board: six GPIO tri-state registers (or
+    // FB_ADDR, FB_MASK, FILL_COL and three tri-state registers with the
+    // slave), cpu_done low and the keypad tri-state register
+    int n = 8;
+    for (int i = 0; i < n; ++i)
+        bus_write();
+    fb_cursor = 0;
+    fb_mask = 0xFF;
+    fb_fill_col = 0;
+    lane_cursor = 0xFFFF;
+    memset(irq_counts, 0, sizeof(irq_counts));
+    memset(irq_stamps, 0, sizeof(irq_stamps));
+    irqs_handled = irqs_idle = 0;
+
+    // IRQ_STATUS cleared and IRQ_ENABLE set; the intc setup is not
+    // charged
+    if (hal_host_cfg.fb_caps & HAL_FB_IRQ) {
+        bus_write();
+        bus_write();
+    }
+}
+
+uint32_t hal_fb_caps(void) {
+    return hal_host_cfg.fb_caps;
+}
+
+void hal_fb_write(uint16_t idx, uint8_t c) {
+    hal_host_stats.pixel_writes++;
+    if (hal_host_cfg.fb_caps & HAL_FB_STREAM) {
+        blit_sync();
+        // FB_DATA when idx continues the stream, else one window store
+        if (idx == fb_cursor)
+            fb_cursor++;
+        fbemu_write(&hal_host_fb, idx, c);
+        bus_write();
+        return;
+    }
+    trace_write('A', idx);
+    trace_write('D', c & 0xF);
+    trace_write('W', 1);
+    fbemu_write(&hal_host_fb, idx, c);
+    trace_write('W', 0);
+}
+
+void hal_fb_stream(uint16_t idx, const uint8_t *px, int n) {
+    if (!(hal_host_cfg.fb_caps & HAL_FB_STREAM)) {
+        for (int i = 0; i < n; ++i)
+            hal_fb_write((uint16_t)(idx + i), px[i]);
+        return;
+    }
+
+    hal_host_stats.streams++;
+    blit_sync();
+    if (idx != fb_cursor)
+        bus_write();   // FB_ADDR
+    for (int i = 0; i < n; ++i) {
+        hal_host_stats.pixel_writes++;
+        fbemu_write(&hal_host_fb, (uint16_t)(idx + i), px[i]);
+        bus_write();   // FB_DATA
+    }
+    fb_cursor = (uint16_t)(idx + n);
+}
+
+void hal_fb_write8(uint16_t group, uint32_t pix, uint8_t mask) {
+    if (!(hal_host_cfg.fb_caps & HAL_FB_WIDE)) {
+        // Same fallback as the board backend without the packed port
+        for (int k = 0; k < 8; ++k, pix >>= 4, mask >>= 1)
+            if (mask & 1)
+                hal_fb_write((uint16_t)(group * 8 + k), pix & 0xF);
+        return;
+    }
+
+    for (uint8_t m = mask; m; m &= m - 1)
+        hal_host_stats.pixel_writes++;
+    hal_host_stats.wide_writes++;
+
+    if (hal_host_cfg.fb_caps & HAL_FB_STREAM) {
+        uint16_t idx = (uint16_t)(group * 8);
+        if (mask != fb_mask) {
+            bus_write();   // FB_MASK
+            fb_mask = mask;
+        }
+        if (idx != fb_cursor)
+            bus_write();   // FB_ADDR
+        blit_sync();
+        fbemu_write8(&hal_host_fb, group, pix, mask);
+        bus_write();       // FB_DATA8
+        fb_cursor = (uint16_t)(idx + 8);
+        return;
+    }
+
+    trace_write('A', group);
+    trace_write('P', pix);
+    trace_write('M', mask);
+    trace_write('E', 1);
+    fbemu_write8(&hal_host_fb, group, pix, mask);
+    trace_write('E', 0);
+}
+
+void hal_fb_blit(uint32_t cmd) {
+    hal_host_stats.blits++;
+    blit_stall(max_clks(fbemu_blit_full(&hal_host_fb), fbemu_fill_busy(&hal_host_fb)));
+    fbemu_blit(&hal_host_fb, cmd);
+    bus_write();   // FB_BLIT
+}
+
+void hal_fb_fill(int x, int y, int w, int h, uint8_t c) {
+    hal_host_stats.fills++;
+    if (c != fb_fill_col) {
+        bus_write();   // FILL_COL
+        fb_fill_col = c;
+    }
+    blit_stall(max_clks(fbemu_fill_full(&hal_host_fb), fbemu_blit_busy(&hal_host_fb)));
+    fbemu_fill(&hal_host_fb, x, y, w, h, c);
+    bus_write();   // FB_FILL
+}
+
+void hal_fb_span(uint16_t idx, int n, uint8_t c) {
+    hal_host_stats.spans++;
+    blit_stall(max_clks(fbemu_fill_full(&hal_host_fb), fbemu_blit_busy(&hal_host_fb)));
+    fbemu_span(&hal_host_fb, idx, n, c);
+    bus_write();   // FB_SPAN
+}
+
+void hal_oam_write(int i, uint32_t entry) {
+    hal_host_stats.oam_writes++;
+    fbemu_oam_write(&hal_host_fb, i, entry);
+    bus_write();
+}
+
+void hal_lane_write8(int b, int row, int group, uint32_t pix, uint8_t mask) {
+    uint16_t addr = (uint16_t)(b << 10 | row << 6 | group);
+
+    hal_host_stats.lane_writes++;
+    if (mask != fb_mask) {
+        bus_write();   // FB_MASK
+        fb_mask = mask;
+    }
+    if (addr != lane_cursor)
+        bus_write();   // LANE_ADDR
+    fbemu_lane_write8(&hal_host_fb, b, row, group, pix, mask);
+    bus_write();       // LANE_DATA8
+    lane_cursor = (uint16_t)(addr + 1);
+}
+
+void hal_lane_scroll(int b, int scroll, int width) {
+    hal_host_stats.scroll_writes++;
+    fbemu_lane_scroll(&hal_host_fb, b, (uint32_t)(scroll | width << 9));
+    bus_write();
+}
+
+void hal_tile_write(int i, uint8_t tile) {
+    hal_host_stats.tile_writes++;
+    fbemu_tile_write(&hal_host_fb, i, tile);
+    bus_write();
+}
+
+void hal_palette_write(int i, uint16_t rgb) {
+    hal_host_stats.palette_writes++;
+    fbemu_palette_write(&hal_host_fb, i, rgb);
+    bus_write();
+}
+
+void hal_palette_cycle(int k, uint32_t cfg) {
+    hal_host_stats.palette_writes++;
+    fbemu_palette_cycle(&hal_host_fb, k, cfg);
+    bus_write();
+}
+
+uint32_t hal_oam_dropped(void) {
+    bus_read();
+    return hal_host_fb.oam_dropped;
+}
+
+// back: the buffer just finished, which cpu_done may already have handed on
+static void frame_done(int back) {
+    static uint8_t screen[FBEMU_DEPTH];
+    uint32_t n = hal_host_stats.frames++;
+
+    if (hal_host_cfg.ppm_dir && n % hal_host_cfg.ppm_every == 0) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%05u.ppm", hal_host_cfg.ppm_dir, n);
+        // with the palette written so far, which the next frame pulse shows
+        fbemu_compose(&hal_host_fb, back, hal_host_fb.bank ^ 1, screen);
+        if (fbemu_write_ppm(screen, hal_host_fb.pal, path)) {
+            perror(path);
+            exit(1);
+        }
+    }
+    if (hal_host_cfg.frames && hal_host_stats.frames >= hal_host_cfg.frames)
+        exit(0);
+}
+
+void hal_set_cpu_done(int done) {
+    int rising = done && !hal_host_fb.cpu_done;
+    int back = hal_host_fb.fb_draw;
+
+    trace_write('C', done != 0);
+    fbemu_set_cpu_done(&hal_host_fb, done);
+    if (rising)
+        frame_done(back);
+}
+
+int hal_frame_ready(void) {
+    hal_host_stats.wait_reads++;
+    bus_read();
+    return fbemu_frame_ready(&hal_host_fb);
+}
+
+int hal_vsync(void) {
+    hal_host_stats.wait_reads++;
+    bus_read();
+    return fbemu_vsync(&hal_host_fb);
+}
+
+uint16_t hal_key_states(void) {
+    // KYPD_getKeyStates sweeps 16 column patterns: one write, one read each
+    for (int i = 0; i < 16; ++i) {
+        bus_write();
+        bus_read();
+    }
+    hal_host_stats.key_scans++;
+
+    uint16_t ks = 0;
+    for (int i = 0; i < num_key_events; ++i) {
+        if (key_events[i].frame != hal_host_stats.frames)
+            continue;
+        const char *k = strchr(HAL_KEYTABLE, key_events[i].key);
+        if (k && key_events[i].key)
+            ks |= 1u << (k - HAL_KEYTABLE);
+    }
+    return ks;
+}
+
+uint32_t hal_key_pressed(uint16_t ks, uint8_t *key) {
+    int count = 0, ci = 0;
+    for (int i = 0; i < 16; ++i)
+        if (ks & (1u << i)) {
+            count++;
+            ci = i;
+        }
+
+    if (count > 1)
+        return HAL_KEY_MULTI;
+    if (count == 0)
+        return HAL_KEY_NONE;
+    *key = (uint8_t)HAL_KEYTABLE[ci];
+    return HAL_KEY_SINGLE;
+}
+
+static uint32_t irq_events(void) {
+    const uint32_t *n = hal_host_fb.irqs;
+    return n[FBEMU_IRQ_READY_RISE] + n[FBEMU_IRQ_READY_FALL] + n[FBEMU_IRQ_FRAME];
+}
+
+// The model raises its events at once; their interrupt is taken when the
+// game next looks at the counts, as one handler call for all of them
+static void take_irqs(void) {
+    if (!(hal_host_cfg.fb_caps & HAL_FB_IRQ) || irq_events() == irqs_handled)
+        return;
+    irqs_handled = irq_events();
+    for (int i = 0; i < HAL_NUM_IRQS; ++i) {
+        irq_counts[i] = hal_host_fb.irqs[i];
+        irq_stamps[i] = (uint32_t)((hal_host_fb.irq_t[i] * 3000 + 1006) / 1007);
+    }
+    hal_host_stats.irqs++;
+    bus_read();    // IRQ_STATUS
+    bus_read();    // CYCLES
+    bus_write();   // IRQ_STATUS
+    hal_host_spend(IRQ_CYCLES);
+}
+
+uint32_t hal_irq_count(int irq) {
+    take_irqs();
+    return irq_counts[irq];
+}
+
+uint32_t hal_irq_cycles(int irq) {
+    take_irqs();
+    return irq_stamps[irq];
+}
+
+void hal_idle(void) {
+    if (!(hal_host_cfg.fb_caps & HAL_FB_IRQ))
+        return;
+    take_irqs();
+    while (irqs_handled == irqs_idle) {
+        hal_host_stats.idle_cycles += IDLE_STEP;
+        hal_host_spend(IDLE_STEP);
+        take_irqs();
+    }
+    irqs_idle = irqs_handled;
+}
+
+void hal_sleep(unsigned int seconds) {
+    hal_host_spend((uint64_t)seconds * FBEMU_CPU_HZ);
+}
+
+uint32_t hal_cycles(void) {
+    // The counter lives in the slave
+    if (!(hal_host_cfg.fb_caps & HAL_FB_STREAM))
+        return 0;
+    bus_read();
+    return (uint32_t)hal_host_stats.cycles;
+}
+
+void hal_fb_stats(struct hal_fb_stats *st) {
+    const uint32_t *v = hal_host_fb.stat;
+
+    if (!(hal_host_cfg.fb_caps & HAL_FB_STREAM)) {
+        st->vsyncs = st->swaps = st->missed = st->draw_max = st->clear_clks = 0;
+        return;
+    }
+    for (int i = 0; i < 5; ++i)
+        bus_read();
+    st->vsyncs = v[0];
+    st->swaps = v[1];
+    st->missed = v[2];
+    st->draw_max = v[3];
+    st->clear_clks = v[4];
+}
+
+void hal_print(const char *s) {
+    fputs(s, stdout);
+}
+
+int hal_flush(void) {
+    return 0;
+}
+
+void hal_host_report(FILE *f) {
+    const struct hal_host_stats *s = &hal_host_stats;
+    const struct fbemu *fb = &hal_host_fb;
+    uint32_t n = s->frames ? s->frames : 1;
+
+    fprintf(f, "frames            %u\n", s->frames);
+    fprintf(f, "cpu cycles        %llu (%.1f ms)\n", (unsigned long long)s->cycles,
+            s->cycles * 1000.0 / FBEMU_CPU_HZ);
+    fprintf(f, "vsync periods     %u\n", fb->frame_pulses);
+    fprintf(f, "buffer swaps      %u\n", fb->swaps);
+    fprintf(f, "  missed          %u\n", fb->missed);
+    fprintf(f, "  longest draw    %u clk_pix\n", fb->draw_max);
+    fprintf(f, "  clear clocks    %u\n", fb->clear_clks);
+    fprintf(f, "pixel writes      %llu (%llu/frame)\n", (unsigned long long)s->pixel_writes,
+            (unsigned long long)(s->pixel_writes / n));
+    fprintf(f, "  packed writes   %llu\n", (unsigned long long)s->wide_writes);
+    fprintf(f, "  streams         %llu\n", (unsigned long long)s->streams);
+    fprintf(f, "blits             %llu (%llu/frame)\n", (unsigned long long)s->blits,
+            (unsigned long long)(s->blits / n));
+    fprintf(f, "fills             %llu (%llu/frame)\n", (unsigned long long)s->fills,
+            (unsigned long long)(s->fills / n));
+    fprintf(f, "spans             %llu (%llu/frame)\n", (unsigned long long)s->spans,
+            (unsigned long long)(s->spans / n));
+    fprintf(f, "  stall cycles    %llu\n", (unsigned long long)s->stall_cycles);
+    fprintf(f, "oam writes        %llu (%llu/frame)\n", (unsigned long long)s->oam_writes,
+            (unsigned long long)(s->oam_writes / n));
+    fprintf(f, "  line drops      %llu\n", (unsigned long long)fb->oam_dropped_total);
+    fprintf(f, "tile writes       %llu\n", (unsigned long long)s->tile_writes);
+    fprintf(f, "palette writes    %llu\n", (unsigned long long)s->palette_writes);
+    fprintf(f, "lane writes       %llu (%llu/frame)\n", (unsigned long long)s->lane_writes,
+            (unsigned long long)(s->lane_writes / n));
+    fprintf(f, "  scroll writes   %llu\n", (unsigned long long)s->scroll_writes);
+    fprintf(f, "  accepted        %u\n", fb->writes);
+    fprintf(f, "  dropped         %u\n", fb->dropped);
+    fprintf(f, "bus writes        %llu (%llu/frame)\n", (unsigned long long)s->bus_writes,
+            (unsigned long long)(s->bus_writes / n));
+    fprintf(f, "bus reads         %llu (%llu/frame)\n", (unsigned long long)s->bus_reads,
+            (unsigned long long)(s->bus_reads / n));
+    fprintf(f, "  wait polls      %llu\n", (unsigned long long)s->wait_reads);
+    fprintf(f, "keypad scans      %llu\n", (unsigned long long)s->key_scans);
+    fprintf(f, "interrupts        %llu\n", (unsigned long long)s->irqs);
+    fprintf(f, "  idle cycles     %llu\n", (unsigned long long)s->idle_cycles);
+    fprintf(f, "multiplies        %u (%u/frame)\n", op_count_mul, op_count_mul / n);
+    fprintf(f, "divides           %u (%u/frame)\n", op_count_div, op_count_div / n);
+    fprintf(f, "composed pixels   %u (%u/frame)\n", op_count_px, op_count_px / n);
+}
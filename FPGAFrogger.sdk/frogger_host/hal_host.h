@@ -0,0 +1,49 @@
+// Linux backend of hal.h: configuration and bus-transaction counters.
+#pragma once
+#include "fbemu.h"
+#include <stdint.h>
+#include <stdio.h>
+
+struct hal_host_cfg {
+    uint32_t frames;            // exit after this many finished frames (0 = never)
+    const char *ppm_dir;        // dump finished frames here (NULL = off)
+    uint32_t ppm_every;         // dump every n-th frame
+    const char *keys;           // keypad script, "frame:key[,frame:key...]"
+    uint32_t bus_write_cycles;  // CPU cycles per AXI write
+    uint32_t bus_read_cycles;   // CPU cycles per AXI read
+    uint32_t fb_caps;           // hal_fb_caps() bits the model is built with
+    const char *trace_path;     // log the GPIO write-port signals here for the
+                                // RTL testbench (NULL = off, GPIO port only)
+};
+
+struct hal_host_stats {
+    uint64_t cycles;        // modelled CPU cycles
+    uint64_t pixel_writes;  // pixels sent by hal_fb_write()/hal_fb_write8()
+    uint64_t wide_writes;   // hal_fb_write8() calls
+    uint64_t streams;       // hal_fb_stream() calls on the memory-mapped slave
+    uint64_t blits;         // hal_fb_blit() commands
+    uint64_t fills;         // hal_fb_fill() jobs
+    uint64_t spans;         // hal_fb_span() jobs
+    uint64_t stall_cycles;  // CPU cycles held back by the blitter / fill engine
+    uint64_t oam_writes;    // hal_oam_write() calls
+    uint64_t tile_writes;   // hal_tile_write() calls
+    uint64_t lane_writes;   // hal_lane_write8() calls
+    uint64_t scroll_writes; // hal_lane_scroll() calls
+    uint64_t palette_writes; // hal_palette_write() and hal_palette_cycle() calls
+    uint64_t bus_writes;    // AXI write transactions
+    uint64_t bus_reads;     // AXI read transactions
+    uint64_t wait_reads;    // of which frame_ready/vsync polls
+    uint64_t key_scans;     // hal_key_states() calls
+    uint64_t irqs;          // frame interrupts taken (HAL_FB_IRQ)
+    uint64_t idle_cycles;   // CPU cycles spent in hal_idle()
+    uint32_t frames;        // cpu_done rising edges
+};
+
+extern struct hal_host_cfg hal_host_cfg;
+extern struct hal_host_stats hal_host_stats;
+extern struct fbemu hal_host_fb;
+
+// Charge CPU cycles that are not bus transactions and advance the model
+void hal_host_spend(uint64_t cycles);
+
+void hal_host_report(FILE *f);
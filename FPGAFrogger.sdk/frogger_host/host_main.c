@@ -0,0 +1,144 @@
+// Headless runner: plays the unmodified game loop from ../frogger/src/main.c
+// against the host HAL for a fixed number of frames.
+#include "hal_host.h"
+#include "fps.h"
+#include "hal.h"
+#include "phase.h"
+#include "slack.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+int frogger_main(void);   // main() of ../frogger/src/main.c
+
+static void usage(const char *prog) {
+    fprintf(stderr,
+            "usage: %s [-n frames] [-o ppm_dir] [-e every] [-k script] [-w cycles] [-r cycles] [-p]\n"
+            "       [-t trace] [-c keep,wide,stream,blit,fill,span,oam,tiles,lanes,triple,irq,\n"
+            "       palette]\n"
+            "  -n  stop after this many finished frames (default 600)\n"
+            "  -o  dump finished frames as PPM into this directory\n"
+            "  -e  only dump every n-th frame (default 1)\n"
+            "  -k  keypad script, e.g. \"30:8,45:8,60:4\" (frame:key)\n"
+            "  -w  CPU cycles per AXI write (default %u)\n"
+            "  -r  CPU cycles per AXI read (default %u)\n"
+            "  -p  print the phase timing of the game loop, the frame pacing and\n"
+            "      with irq the slack at exit (needs stream; key D of the script\n"
+            "      prints them during the run)\n"
+            "  -t  log the GPIO write-port signals into this file for the RTL\n"
+            "      testbench (FPGAFrogger.srcs/sim_1); GPIO port only, so -c at\n"
+            "      most keep,wide. About 1.5 MB per frame\n"
+            "  -c  framebuffer features, comma separated: keep = back buffer not\n"
+            "      cleared (CLEAR_BACK 0), wide = packed 8-pixel write port,\n"
+            "      stream = axi_fb_slave instead of the GPIO write port,\n"
+            "      blit = sprite blitter behind the slave (implies stream),\n"
+            "      fill = rectangle fill engine behind the slave (implies stream),\n"
+            "      span = span writes of the fill engine (implies fill),\n"
+            "      oam = object layer behind the slave (implies stream),\n"
+            "      tiles = tile layer behind the slave (implies stream),\n"
+            "      lanes = lane layer behind the slave (implies stream, wide, tiles),\n"
+            "      triple = three frame buffers (NUM_BUFFERS 3; not with oam, tiles\n"
+            "      or lanes),\n"
+            "      irq = frame interrupts of the slave and the interrupt-driven\n"
+            "      loop (implies stream),\n"
+            "      palette = CPU-written palette and its cycle slots (implies\n"
+            "      stream)\n",
+            prog, hal_host_cfg.bus_write_cycles, hal_host_cfg.bus_read_cycles);
+    exit(2);
+}
+
+static int dump_phases;
+
+static void report(void) {
+    hal_host_report(stdout);
+    if (dump_phases) {
+        phase_dump();
+        fps_dump();
+        slack_dump();
+    }
+}
+
+int main(int argc, char **argv) {
+    int opt;
+
+    hal_host_cfg.frames = 600;
+    while ((opt = getopt(argc, argv, "n:o:e:k:w:r:c:t:ph")) != -1) {
+        switch (opt) {
+        case 'n':
+            hal_host_cfg.frames = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'o':
+            hal_host_cfg.ppm_dir = optarg;
+            break;
+        case 'e':
+            hal_host_cfg.ppm_every = (uint32_t)strtoul(optarg, NULL, 0);
+            if (!hal_host_cfg.ppm_every)
+                usage(argv[0]);
+            break;
+        case 'k':
+            hal_host_cfg.keys = optarg;
+            break;
+        case 'w':
+            hal_host_cfg.bus_write_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'r':
+            hal_host_cfg.bus_read_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+            break;
+        case 'p':
+            dump_phases = 1;
+            break;
+        case 't':
+            hal_host_cfg.trace_path = optarg;
+            break;
+        case 'c':
+            for (char *f = strtok(optarg, ","); f; f = strtok(NULL, ",")) {
+                if (!strcmp(f, "keep"))
+                    hal_host_cfg.fb_caps |= HAL_FB_KEEP_BACK;
+                else if (!strcmp(f, "wide"))
+                    hal_host_cfg.fb_caps |= HAL_FB_WIDE;
+                else if (!strcmp(f, "stream"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM;
+                else if (!strcmp(f, "blit"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_BLIT;
+                else if (!strcmp(f, "fill"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_FILL;
+                else if (!strcmp(f, "span"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_FILL | HAL_FB_SPAN;
+                else if (!strcmp(f, "oam"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_OAM;
+                else if (!strcmp(f, "tiles"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_TILES;
+                else if (!strcmp(f, "lanes"))
+                    hal_host_cfg.fb_caps |=
+                        HAL_FB_STREAM | HAL_FB_WIDE | HAL_FB_TILES | HAL_FB_LANES;
+                else if (!strcmp(f, "triple"))
+                    hal_host_cfg.fb_caps |= HAL_FB_TRIPLE;
+                else if (!strcmp(f, "irq"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_IRQ;
+                else if (!strcmp(f, "palette"))
+                    hal_host_cfg.fb_caps |= HAL_FB_STREAM | HAL_FB_PALETTE;
+                else
+                    usage(argv[0]);
+            }
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    // A zero-cost poll would spin forever without advancing the model
+    if (!hal_host_cfg.frames || !hal_host_cfg.bus_read_cycles)
+        usage(argv[0]);
+    // The layers have two banks only, and the lane layer is not built with
+    // the third buffer
+    if ((hal_host_cfg.fb_caps & HAL_FB_TRIPLE) &&
+        (hal_host_cfg.fb_caps & (HAL_FB_OAM | HAL_FB_TILES | HAL_FB_LANES)))
+        usage(argv[0]);
+    // The testbench drives the GPIO write port of the double-buffered top only
+    if (hal_host_cfg.trace_path &&
+        (hal_host_cfg.fb_caps & ~(uint32_t)(HAL_FB_KEEP_BACK | HAL_FB_WIDE)))
+        usage(argv[0]);
+
+    atexit(report);
+    return frogger_main();
+}
@@ -0,0 +1,131 @@
+// Writes sprite_kernels.h of the renderer from the same sprites.h the
+// firmware is built with.
+//
+//   kerngen sprite_kernels.h
+//
+// For every sprite and transform main.c draws, a straight-line kernel that
+// sends the opaque runs of the sprite as put_run() calls, with the offsets
+// and lengths as constants: no transparency test, no transform arithmetic
+// and no multiply per pixel. Each kernel has its own copy of the opaque
+// pixels, transformed and in run order, so every run is contiguous and the
+// kernels do not need the byte-per-pixel sprites[] the renderer no longer
+// links (it draws from packed_assets.h). The kernels are reached through
+// sprite_kernels[id][xf]; entries without a kernel are NULL.
+//
+// Only the sprites the game draws get a kernel: at 16 bytes of MicroBlaze
+// code per run, all 54 sprites in every transform would not fit the 32 KB
+// LMB next to the sprite data.
+#include "render.h"
+#include "sprites.h"
+#include <stdio.h>
+
+static const struct {
+    int id, xf;
+} used[] = {
+    // frog (animation frames 2 and 0) in each facing, lives, death
+    {2, XF_NONE}, {2, XF_ROT_RIGHT}, {2, XF_ROT_180}, {2, XF_ROT_LEFT},
+    {0, XF_NONE}, {0, XF_ROT_RIGHT}, {0, XF_ROT_180}, {0, XF_ROT_LEFT},
+    {15, XF_NONE},
+    // lily pads and fly
+    {29, XF_NONE}, {30, XF_NONE}, {31, XF_NONE},
+    // logs
+    {46, XF_NONE}, {47, XF_NONE}, {48, XF_NONE},
+    // turtles, diving and submerged
+    {22, XF_NONE}, {23, XF_NONE}, {24, XF_NONE}, {25, XF_NONE}, {26, XF_NONE},
+    // cars
+    {3, XF_NONE}, {4, XF_NONE}, {5, XF_NONE}, {6, XF_NONE}, {7, XF_NONE}, {8, XF_NONE},
+};
+#define NUM_USED (int)(sizeof(used) / sizeof(used[0]))
+
+static const char *xf_name[6] = {"none", "flip_h", "flip_v", "rot_180", "rot_left", "rot_right"};
+
+// Pixel (dx, dy) of sprite id drawn with transform xf, as sprite_line() in
+// render.c unpacks it
+static uint8_t xf_pixel(int id, int xf, int dx, int dy) {
+    int base, step;
+
+    switch (xf) {
+    case XF_FLIP_H:    base = dy * 16 + 15;        step = -1;    break;
+    case XF_FLIP_V:    base = (15 - dy) * 16;      step = 1;     break;
+    case XF_ROT_180:   base = (15 - dy) * 16 + 15; step = -1;    break;
+    case XF_ROT_LEFT:  base = 15 - dy;             step = 16;    break;
+    case XF_ROT_RIGHT: base = 240 + dy;            step = -16;   break;
+    default:           base = dy * 16;             step = 1;     break;
+    }
+    return sprites[id][base + dx * step];
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s sprite_kernels.h\n", argv[0]);
+        return 2;
+    }
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    int spans = 0, opaque = 0;
+    for (int u = 0; u < NUM_USED; ++u)
+        for (int y = 0; y < 16; ++y)
+            for (int x = 0; x < 16; ++x) {
+                int px = xf_pixel(used[u].id, used[u].xf, x, y);
+                spans += px && (!x || !xf_pixel(used[u].id, used[u].xf, x - 1, y));
+                opaque += px != 0;
+            }
+
+    fprintf(f, "// Auto-generated by frogger_host/kerngen from sprites.h, do not edit.\n"
+               "//\n"
+               "// Straight-line kernels for the sprites main.c draws: k_<id>_<xf>(p) sends\n"
+               "// the opaque runs of the sprite, top-left pixel at index p and wholly on\n"
+               "// screen, through put_run(). Included by render.c.\n"
+               "#pragma once\n\n");
+    fprintf(f, "#define SPRITE_KERNELS %d        // kernels\n", NUM_USED);
+    fprintf(f, "#define SPRITE_KERNEL_RUNS %d   // put_run() calls in all of them\n", spans);
+    fprintf(f, "#define SPRITE_KERNEL_DATA %d  // bytes of opaque pixels\n\n", opaque);
+
+    for (int u = 0; u < NUM_USED; ++u) {
+        int id = used[u].id, xf = used[u].xf, n = 0;
+        fprintf(f, "static const uint8_t px_%d_%s[] = {", id, xf_name[xf]);
+        for (int y = 0; y < 16; ++y)
+            for (int x = 0; x < 16; ++x) {
+                int px = xf_pixel(id, xf, x, y);
+                if (px)
+                    fprintf(f, "%s0x%X,", n++ % 16 ? " " : "\n    ", px);
+            }
+        fprintf(f, "\n};\n\n");
+    }
+
+    for (int u = 0; u < NUM_USED; ++u) {
+        int id = used[u].id, xf = used[u].xf, k = 0;
+        fprintf(f, "static void k_%d_%s(uint16_t p) {\n", id, xf_name[xf]);
+        fprintf(f, "    const uint8_t *s = px_%d_%s;\n\n", id, xf_name[xf]);
+        for (int y = 0; y < 16; ++y)
+            for (int x = 0; x < 16;) {
+                if (!xf_pixel(id, xf, x, y)) {
+                    ++x;
+                    continue;
+                }
+                int start = x;
+                while (x < 16 && xf_pixel(id, xf, x, y))
+                    ++x;
+                fprintf(f, "    put_run(p + %d, s + %d, %d);\n", y * FB_W + start, k,
+                        x - start);
+                k += x - start;
+            }
+        fprintf(f, "}\n\n");
+    }
+
+    fprintf(f, "static void (*const sprite_kernels[NUM_SPRITES][6])(uint16_t) = {\n");
+    for (int u = 0; u < NUM_USED; ++u)
+        fprintf(f, "    [%d][%d] = k_%d_%s,\n", used[u].id, used[u].xf, used[u].id,
+                xf_name[used[u].xf]);
+    fprintf(f, "};\n");
+
+    if (fclose(f)) {
+        perror(argv[1]);
+        return 1;
+    }
+    return 0;
+}
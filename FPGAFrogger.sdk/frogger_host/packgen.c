@@ -0,0 +1,317 @@
+// Writes packed_assets.h of the renderer: sprites.h, background.h, letters.h
+// and numbers.h at 4 bits per pixel, each distinct row stored once.
+//
+//   packgen packed_assets.h
+//
+// A row of 8 pixels is one 32-bit word, pixel x in bits 4x+3:4x, as
+// hal_fb_write8() takes it; a 16-pixel sprite or tile row is two words. Read
+// as bytes (the MicroBlaze is little-endian, as is the host) byte j holds
+// pixels 2j (low nibble) and 2j+1. Next to each word goes its opacity mask,
+// bit x set where pixel x is not 0, the write mask of that word.
+//
+// Sprites and tiles share one store of 16-pixel rows, row_pix[] and
+// row_mask[]. A row equal to the mirror image of one already stored is not
+// stored again: sprite_rows[] and tile_rows[] give, for each row of each
+// image, its entry as index << 1 | flip, flip set where the stored row is
+// drawn mirrored. Entry 0 is the empty row, so a row without an opaque pixel
+// is known from its entry alone. Vertically mirrored images, animation
+// frames that share rows and uniform fills thus cost a row table, not their
+// pixels. Glyphs are never flipped: glyph_rows[] indexes their 8-pixel rows
+// by identity only.
+//
+// The two 256-byte tables serve the unpack code: nib_swap[] swaps the
+// nibbles of a byte (its high pixel is nib_swap[b] & 15, and a byte of a
+// horizontally flipped row is nib_swap[] of its mirror byte), bit_rev[]
+// mirrors an 8-bit mask.
+//
+// bg_tilemap is stored as its distinct rows, bg_map_rows[], and the index
+// of each, bg_map_row[]; render_init() expands it. pal_rgb444[] is the
+// palette of sprites.h back at RGB444, what hal_palette_write() takes and
+// the palette registers reset to. Prints per sheet the bytes
+// of the one-row-per-row packed form and what the shared store reclaims, and
+// the images that are whole copies or mirrors of an earlier one.
+#include "background.h"
+#include "letters.h"
+#include "numbers.h"
+#include "sprites.h"
+#include <stdio.h>
+#include <string.h>
+
+#define NUM_GLYPHS (NUM_LETTERS + NUM_DIGITS)
+#define MAX_ROWS 2048
+
+static uint8_t rows[MAX_ROWS][SPR_W];   // distinct 16-pixel rows, 0 empty
+static int num_rows = 1, num_flipped;
+static uint8_t glyph_store[NUM_GLYPHS * LETTER_H + 1][LETTER_W];
+static int num_glyph_rows = 1;
+
+static uint16_t sprite_ent[NUM_SPRITES][SPR_H];
+static uint16_t tile_ent[BG_NUM_SPRITES][SPR_H];
+static uint8_t glyph_ent[NUM_GLYPHS][LETTER_H];
+
+// Word w of the row at px, and its opacity mask
+static uint32_t row_word(const uint8_t *px, int w) {
+    uint32_t v = 0;
+    for (int k = 7; k >= 0; --k)
+        v = v << 4 | (px[w * 8 + k] & 0xF);
+    return v;
+}
+
+static unsigned row_mask(const uint8_t *px, int w) {
+    unsigned m = 0;
+    for (int k = 0; k < 8; ++k)
+        if (px[w * 8 + k])
+            m |= 1u << k;
+    return m;
+}
+
+// Entry of a 16-pixel row, stored if neither it nor its mirror is yet
+static unsigned find_row(const uint8_t *px) {
+    uint8_t rev[SPR_W];
+    for (int x = 0; x < SPR_W; ++x)
+        rev[x] = px[SPR_W - 1 - x];
+
+    for (int i = 0; i < num_rows; ++i) {
+        if (!memcmp(rows[i], px, SPR_W))
+            return i << 1;
+        if (!memcmp(rows[i], rev, SPR_W))
+            return i << 1 | 1;
+    }
+    if (num_rows == MAX_ROWS) {
+        fprintf(stderr, "packgen: more than %d distinct rows\n", MAX_ROWS);
+        return 0;
+    }
+    memcpy(rows[num_rows], px, SPR_W);
+    return num_rows++ << 1;
+}
+
+static unsigned find_glyph_row(const uint8_t *px) {
+    for (int i = 0; i < num_glyph_rows; ++i)
+        if (!memcmp(glyph_store[i], px, LETTER_W))
+            return i;
+    memcpy(glyph_store[num_glyph_rows], px, LETTER_W);
+    return num_glyph_rows++;
+}
+
+// Whether image b is image a under transform xf (FLIP_H 1, FLIP_V 2)
+static int same_image(const uint8_t *a, const uint8_t *b, int xf) {
+    for (int y = 0; y < SPR_H; ++y)
+        for (int x = 0; x < SPR_W; ++x) {
+            int sy = xf & 2 ? SPR_H - 1 - y : y, sx = xf & 1 ? SPR_W - 1 - x : x;
+            if (b[y * SPR_W + x] != a[sy * SPR_W + sx])
+                return 0;
+        }
+    return 1;
+}
+
+// Report the images of a sheet that repeat an earlier one, whole or mirrored
+static void report_folds(const char *sheet, const uint8_t *px, int count) {
+    static const char *const xf_name[4] = {"copy", "FLIP_H", "FLIP_V", "ROT_180"};
+
+    for (int i = 1; i < count; ++i)
+        for (int j = 0; j < i; ++j) {
+            int xf = 0;
+            while (xf < 4 && !same_image(&px[j * SPR_W * SPR_H], &px[i * SPR_W * SPR_H], xf))
+                ++xf;
+            if (xf < 4) {
+                printf("  %s %d = %s of %d\n", sheet, i, xf_name[xf], j);
+                break;
+            }
+        }
+}
+
+static void put_entries(FILE *f, const char *name, const uint16_t *ent, int count, int rows) {
+    fprintf(f, "static const uint16_t %s_rows[%d][%d] = {", name, count, rows);
+    for (int i = 0; i < count; ++i) {
+        fprintf(f, "\n    /* %2d */ {", i);
+        for (int y = 0; y < rows; ++y)
+            fprintf(f, "%d%s", ent[i * rows + y], y + 1 < rows ? ", " : "},");
+    }
+    fprintf(f, "\n};\n\n");
+}
+
+static void put_table(FILE *f, const char *name, unsigned (*fn)(unsigned)) {
+    fprintf(f, "static const uint8_t %s[256] = {", name);
+    for (unsigned b = 0; b < 256; ++b)
+        fprintf(f, "%s0x%02X,", b % 16 ? " " : "\n    ", fn(b));
+    fprintf(f, "\n};\n\n");
+}
+
+static unsigned nib_swap(unsigned b) {
+    return (b << 4 | b >> 4) & 0xFF;
+}
+
+static unsigned bit_rev(unsigned b) {
+    unsigned r = 0;
+    for (int k = 0; k < 8; ++k)
+        if (b & 1u << k)
+            r |= 0x80u >> k;
+    return r;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s packed_assets.h\n", argv[0]);
+        return 2;
+    }
+
+    static uint8_t glyphs[NUM_GLYPHS][LETTER_W * LETTER_H];
+    for (int i = 0; i < NUM_LETTERS; ++i)
+        for (int k = 0; k < LETTER_W * LETTER_H; ++k)
+            glyphs[i][k] = letters[i][k];
+    for (int i = 0; i < NUM_DIGITS; ++i)
+        for (int k = 0; k < DIGIT_W * DIGIT_H; ++k)
+            glyphs[NUM_LETTERS + i][k] = numbers[i][k];
+
+    // Rows of the sprites first, then of the tiles, each sheet charged with
+    // the rows it adds to the store
+    memset(rows[0], 0, SPR_W);
+    int sprite_new, tile_new;
+    for (int i = 0; i < NUM_SPRITES; ++i)
+        for (int y = 0; y < SPR_H; ++y)
+            sprite_ent[i][y] = (uint16_t)find_row(&sprites[i][y * SPR_W]);
+    sprite_new = num_rows;
+    for (int i = 0; i < BG_NUM_SPRITES; ++i)
+        for (int y = 0; y < SPR_H; ++y)
+            tile_ent[i][y] = (uint16_t)find_row(&background[i][y * SPR_W]);
+    tile_new = num_rows - sprite_new;
+    for (int i = 0; i < NUM_SPRITES; ++i)
+        for (int y = 0; y < SPR_H; ++y)
+            num_flipped += sprite_ent[i][y] & 1;
+    for (int i = 0; i < BG_NUM_SPRITES; ++i)
+        for (int y = 0; y < SPR_H; ++y)
+            num_flipped += tile_ent[i][y] & 1;
+
+    memset(glyph_store[0], 0, LETTER_W);
+    for (int i = 0; i < NUM_GLYPHS; ++i)
+        for (int y = 0; y < LETTER_H; ++y)
+            glyph_ent[i][y] = (uint8_t)find_glyph_row(&glyphs[i][y * LETTER_W]);
+    int letter_new = 0;
+    for (int i = 0; i < NUM_LETTERS; ++i)
+        for (int y = 0; y < LETTER_H; ++y)
+            if (glyph_ent[i][y] > letter_new)
+                letter_new = glyph_ent[i][y];
+    ++letter_new;   // with the empty row
+
+    // Distinct tilemap rows
+    static uint8_t map_rows[TILES_Y][TILES_X];
+    uint8_t map_row[TILES_Y];
+    int num_map_rows = 0;
+    for (int y = 0; y < TILES_Y; ++y) {
+        int i = 0;
+        while (i < num_map_rows && memcmp(map_rows[i], bg_tilemap[y], TILES_X))
+            ++i;
+        if (i == num_map_rows)
+            memcpy(map_rows[num_map_rows++], bg_tilemap[y], TILES_X);
+        map_row[y] = (uint8_t)i;
+    }
+
+    // Bytes per sheet: one packed row per image row as before (pixels and
+    // masks), against the rows a sheet adds to the store and its 16-bit
+    // entries
+    int spr_before = NUM_SPRITES * SPR_H * (8 + 2);
+    int spr_after = sprite_new * (8 + 2) + NUM_SPRITES * SPR_H * 2;
+    int tile_before = BG_NUM_SPRITES * SPR_H * (8 + 2) + TILES_Y * TILES_X;
+    int tile_after = tile_new * (8 + 2) + BG_NUM_SPRITES * SPR_H * 2 +
+                     num_map_rows * TILES_X + TILES_Y;
+    int let_before = NUM_LETTERS * LETTER_H * (4 + 1);
+    int let_after = letter_new * (4 + 1) + NUM_LETTERS * LETTER_H;
+    int num_before = NUM_DIGITS * DIGIT_H * (4 + 1);
+    int num_after = (num_glyph_rows - letter_new) * (4 + 1) + NUM_DIGITS * DIGIT_H;
+    int before = spr_before + tile_before + let_before + num_before + 2 * 256;
+    int packed = spr_after + tile_after + let_after + num_after + 2 * 256;
+    int bytes = (NUM_SPRITES + BG_NUM_SPRITES) * SPR_W * SPR_H +
+                NUM_GLYPHS * LETTER_W * LETTER_H + TILES_Y * TILES_X;
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    fprintf(f, "// Auto-generated by frogger_host/packgen from sprites.h, background.h,\n"
+               "// letters.h and numbers.h, do not edit.\n"
+               "//\n"
+               "// The assets at 4 bits per pixel, each distinct row stored once, see\n"
+               "// packgen.c for the layout. Included by render.c.\n"
+               "#pragma once\n"
+               "#include <stdint.h>\n\n");
+    fprintf(f, "#define NUM_SPRITES %d\n", NUM_SPRITES);
+    fprintf(f, "#define BG_NUM_SPRITES %d\n", BG_NUM_SPRITES);
+    fprintf(f, "#define NUM_GLYPHS %d\n", NUM_GLYPHS);
+    fprintf(f, "#define SPR_W %d\n", SPR_W);
+    fprintf(f, "#define SPR_H %d\n", SPR_H);
+    fprintf(f, "#define TILES_X %d\n", TILES_X);
+    fprintf(f, "#define TILES_Y %d\n", TILES_Y);
+    fprintf(f, "#define NUM_ROWS %d\n", num_rows);
+    fprintf(f, "#define NUM_GLYPH_ROWS %d\n", num_glyph_rows);
+    fprintf(f, "#define PACKED_BYTES %d   // %d with a row per image row, %d as bytes\n\n",
+            packed, before, bytes);
+
+    fprintf(f, "static const uint32_t row_pix[%d][2] = {", num_rows);
+    for (int i = 0; i < num_rows; ++i)
+        fprintf(f, "%s{0x%08X, 0x%08X},", i % 4 ? " " : "\n    ", row_word(rows[i], 0),
+                row_word(rows[i], 1));
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "static const uint8_t row_mask[%d][2] = {", num_rows);
+    for (int i = 0; i < num_rows; ++i)
+        fprintf(f, "%s{0x%02X, 0x%02X},", i % 8 ? " " : "\n    ", row_mask(rows[i], 0),
+                row_mask(rows[i], 1));
+    fprintf(f, "\n};\n\n");
+    put_entries(f, "sprite", &sprite_ent[0][0], NUM_SPRITES, SPR_H);
+    put_entries(f, "tile", &tile_ent[0][0], BG_NUM_SPRITES, SPR_H);
+
+    fprintf(f, "static const uint32_t glyph_pix[%d] = {", num_glyph_rows);
+    for (int i = 0; i < num_glyph_rows; ++i)
+        fprintf(f, "%s0x%08X,", i % 8 ? " " : "\n    ", row_word(glyph_store[i], 0));
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "static const uint8_t glyph_mask[%d] = {", num_glyph_rows);
+    for (int i = 0; i < num_glyph_rows; ++i)
+        fprintf(f, "%s0x%02X,", i % 16 ? " " : "\n    ", row_mask(glyph_store[i], 0));
+    fprintf(f, "\n};\n\n");
+    fprintf(f, "static const uint8_t glyph_rows[%d][%d] = {", NUM_GLYPHS, LETTER_H);
+    for (int i = 0; i < NUM_GLYPHS; ++i) {
+        fprintf(f, "\n    /* %2d */ {", i);
+        for (int y = 0; y < LETTER_H; ++y)
+            fprintf(f, "%d%s", glyph_ent[i][y], y + 1 < LETTER_H ? ", " : "},");
+    }
+    fprintf(f, "\n};\n\n");
+
+    put_table(f, "nib_swap", nib_swap);
+    put_table(f, "bit_rev", bit_rev);
+
+    fprintf(f, "static const uint8_t bg_map_rows[%d][TILES_X] = {\n", num_map_rows);
+    for (int y = 0; y < num_map_rows; ++y) {
+        fprintf(f, "    {");
+        for (int x = 0; x < TILES_X; ++x)
+            fprintf(f, "%2d%s", map_rows[y][x], x + 1 < TILES_X ? ", " : "},\n");
+    }
+    fprintf(f, "};\n\n");
+    fprintf(f, "static const uint8_t bg_map_row[TILES_Y] = {");
+    for (int y = 0; y < TILES_Y; ++y)
+        fprintf(f, "%d%s", map_row[y], y + 1 < TILES_Y ? ", " : "};\n");
+    fprintf(f, "\nstatic const uint16_t pal_rgb444[%d] = {", PALETTE_SIZE);
+    for (int i = 0; i < PALETTE_SIZE; ++i)
+        fprintf(f, "%s0x%03X,", i % 8 ? " " : "\n    ",
+                (unsigned)((palette[i] >> 12 & 0xF00) | (palette[i] >> 8 & 0xF0) |
+                           (palette[i] >> 4 & 0xF)));
+    fprintf(f, "\n};\n");
+
+    if (fclose(f)) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    printf("%s: %d distinct rows (%d drawn mirrored), %d glyph rows, %d tilemap rows\n",
+           argv[1], num_rows, num_flipped, num_glyph_rows, num_map_rows);
+    printf("  %-13s %6s %6s %9s\n", "sheet", "before", "after", "reclaimed");
+    printf("  %-13s %6d %6d %9d\n", "sprites.h", spr_before, spr_after, spr_before - spr_after);
+    printf("  %-13s %6d %6d %9d\n", "background.h", tile_before, tile_after,
+           tile_before - tile_after);
+    printf("  %-13s %6d %6d %9d\n", "letters.h", let_before, let_after, let_before - let_after);
+    printf("  %-13s %6d %6d %9d\n", "numbers.h", num_before, num_after, num_before - num_after);
+    printf("  %-13s %6d %6d %9d   (%d as one byte per pixel)\n", "total", before, packed,
+           before - packed, bytes);
+    report_folds("sprite", &sprites[0][0], NUM_SPRITES);
+    report_folds("tile", &background[0][0], BG_NUM_SPRITES);
+    return 0;
+}
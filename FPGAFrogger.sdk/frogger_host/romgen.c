@@ -0,0 +1,40 @@
+// Writes the ROM images the FPGA design loads with $readmemh from the same
+// asset headers the firmware is built with, so both always agree.
+//
+//   romgen sprites.mem tiles.mem
+//
+//   sprites.mem    sprite ROM of sprite_blitter / oam_layer: sprite n, row y,
+//                  column x at n * 256 + y * 16 + x
+//   tiles.mem      tile patterns of tile_layer, background[] in the same
+//                  layout
+//
+// One hex digit per line.
+#include "background.h"
+#include "sprites.h"
+#include <stdio.h>
+
+static int write_mem(const char *path, const uint8_t *px, int n) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        perror(path);
+        return 1;
+    }
+    for (int i = 0; i < n; ++i)
+        fprintf(f, "%X\n", px[i] & 0xF);
+    if (fclose(f)) {
+        perror(path);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s sprites.mem tiles.mem\n", argv[0]);
+        return 2;
+    }
+
+    if (write_mem(argv[1], &sprites[0][0], NUM_SPRITES * SPR_W * SPR_H))
+        return 1;
+    return write_mem(argv[2], &background[0][0], BG_NUM_SPRITES * SPR_W * SPR_H);
+}
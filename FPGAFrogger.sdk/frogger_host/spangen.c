@@ -0,0 +1,84 @@
+// Writes sprite_spans.h of the renderer, sprites.h stored as runs of one
+// colour.
+//
+//   spangen sprite_spans.h
+//
+// Sprite id starts at sprite_span_data[sprite_span_start[id]]. Each of its 16
+// rows is a span count followed by that many two-byte spans:
+//
+//   byte 0   bits 7:4  transparent pixels skipped before the span
+//            bits 3:0  span length - 1
+//   byte 1   colour
+//
+// Long transparent margins and single-colour rows (logs, cars, the turtle
+// dive sprites) take a few bytes instead of 16.
+#include "sprites.h"
+#include <stdio.h>
+
+static uint8_t data[NUM_SPRITES * SPR_H * (1 + 2 * SPR_W)];
+static int start[NUM_SPRITES];
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s sprite_spans.h\n", argv[0]);
+        return 2;
+    }
+
+    int n = 0, spans = 0;
+    for (int id = 0; id < NUM_SPRITES; ++id) {
+        start[id] = n;
+        for (int y = 0; y < SPR_H; ++y) {
+            const uint8_t *row = &sprites[id][y * SPR_W];
+            int count = n++, x = 0, end = 0;
+            data[count] = 0;
+            while (x < SPR_W) {
+                if (!row[x]) {
+                    ++x;
+                    continue;
+                }
+                int s = x;
+                while (x < SPR_W && row[x] == row[s])
+                    ++x;
+                data[n++] = (uint8_t)((s - end) << 4 | (x - s - 1));
+                data[n++] = row[s];
+                data[count]++;
+                spans++;
+                end = x;
+            }
+        }
+    }
+
+    FILE *f = fopen(argv[1], "w");
+    if (!f) {
+        perror(argv[1]);
+        return 1;
+    }
+    fprintf(f, "// Auto-generated by frogger_host/spangen from sprites.h, do not edit.\n"
+               "//\n"
+               "// sprites[] as colour spans, see spangen.c for the format.\n"
+               "#pragma once\n"
+               "#include <stdint.h>\n\n");
+    fprintf(f, "#define SPRITE_SPANS %d\n", spans);
+    fprintf(f, "#define SPRITE_SPAN_BYTES %d   // sprite_span_start[] and sprite_span_data[]\n\n",
+            (int)(NUM_SPRITES * sizeof(uint16_t)) + n);
+
+    fprintf(f, "static const uint16_t sprite_span_start[%d] = {", NUM_SPRITES);
+    for (int id = 0; id < NUM_SPRITES; ++id)
+        fprintf(f, "%s%d,", id % 12 ? " " : "\n    ", start[id]);
+    fprintf(f, "\n};\n\n");
+
+    fprintf(f, "static const uint8_t sprite_span_data[%d] = {", n);
+    for (int id = 0; id < NUM_SPRITES; ++id) {
+        fprintf(f, "\n  /* sprite %2d */", id);
+        int end = id + 1 < NUM_SPRITES ? start[id + 1] : n;
+        for (int i = start[id]; i < end; ++i)
+            fprintf(f, "%s0x%02X,", (i - start[id]) % 16 ? " " : "\n    ", data[i]);
+    }
+    fprintf(f, "\n};\n");
+
+    if (fclose(f)) {
+        perror(argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,28 @@
+################################################################
+# Hardware-math variant of design_1
+#
+# Turns on the MicroBlaze options the normal design leaves off:
+#   C_USE_BARREL  barrel shifter, any shift in one instruction
+#   C_USE_HW_MUL  32-bit multiplier (MUL32), mul/muli
+# The divider (C_USE_DIV) stays off; the game divides only in its
+# once-a-second reports.
+#
+# Run with the project open, on a copy of the project or a branch:
+#   source FPGAFrogger.srcs/hwmath/design_1_hwmath.tcl
+# then regenerate the wrapper, build the bitstream and export the
+# hardware (with bitstream) to the SDK. The BSP for it is
+# FPGAFrogger.sdk/frogger_hwmath_bsp, the build of the game with
+# -mxl-barrel-shift -mno-xl-soft-mul FPGAFrogger.sdk/frogger_hwmath.
+# frogger_host/frogger_bench -a estimates what it buys over the soft-math
+# core, with and without the renderer's row table.
+################################################################
+
+open_bd_design [get_files design_1.bd]
+
+set_property -dict [ list \
+ CONFIG.C_USE_BARREL {1} \
+ CONFIG.C_USE_HW_MUL {1} \
+] [get_bd_cells microblaze_0]
+
+validate_bd_design
+save_bd_design
@@ -0,0 +1,57 @@
+################################################################
+# Frame interrupts for design_1
+#
+# Adds what the interrupt-driven game loop needs:
+#   axi_intc_0    axi_fb_slave_0/irq (IRQ_STATUS / IRQ_ENABLE of the
+#                 slave: frame_ready edges and the frame pulse) into
+#                 the MicroBlaze INTERRUPT input
+#
+# axi_fb_slave_0 and its frame_ready input are part of design_1.bd.
+# Run with the project open:
+#   source FPGAFrogger.srcs/irq/design_1_irq.tcl
+# then regenerate the wrapper, build the bitstream, export the hardware
+# (with bitstream) to the SDK and regenerate frogger_bsp, whose
+# system.mss lists the intc driver. The profiling variant
+# (../profile/design_1_profile.tcl) can be sourced after this one; it
+# shares the controller with its timer.
+################################################################
+
+open_bd_design [get_files design_1.bd]
+
+set mb  [get_bd_cells microblaze_0]
+set ic  [get_bd_cells microblaze_0_axi_periph]
+set clk [get_bd_pins clk_wiz_0/clk_out1]
+set rst [get_bd_pins rst_clk_wiz_0_100M/peripheral_aresetn]
+
+# MicroBlaze interrupt input
+set_property -dict [ list \
+ CONFIG.C_USE_INTERRUPT {1} \
+] $mb
+
+# Interrupt controller, the slave's level-high irq its only input
+set axi_intc_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_intc:4.1 axi_intc_0 ]
+set_property -dict [ list \
+ CONFIG.C_IRQ_CONNECTION {1} \
+] $axi_intc_0
+
+connect_bd_net [get_bd_pins axi_fb_slave_0/irq] [get_bd_pins axi_intc_0/intr]
+connect_bd_intf_net [get_bd_intf_pins axi_intc_0/interrupt] [get_bd_intf_pins microblaze_0/INTERRUPT]
+
+# One more interconnect master for it
+set mi [get_property CONFIG.NUM_MI $ic]
+set_property -dict [ list \
+ CONFIG.NUM_MI [expr {$mi + 1}] \
+] $ic
+
+set port [format "M%02d" $mi]
+connect_bd_intf_net [get_bd_intf_pins $ic/${port}_AXI] [get_bd_intf_pins axi_intc_0/s_axi]
+connect_bd_net $clk [get_bd_pins $ic/${port}_ACLK] [get_bd_pins axi_intc_0/s_axi_aclk]
+connect_bd_net $rst [get_bd_pins $ic/${port}_ARESETN] [get_bd_pins axi_intc_0/s_axi_aresetn]
+connect_bd_net $clk [get_bd_pins axi_intc_0/processor_clk]
+connect_bd_net [get_bd_pins rst_clk_wiz_0_100M/mb_reset] [get_bd_pins axi_intc_0/processor_rst]
+
+# Address: the IP default
+create_bd_addr_seg -range 0x00010000 -offset 0x41200000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_intc_0/S_AXI/Reg] SEG_axi_intc_0_Reg
+
+validate_bd_design
+save_bd_design
@@ -0,0 +1,100 @@
+################################################################
+# Profiling variant of design_1
+#
+# Adds what the standalone BSP's software-intrusive profiler needs and
+# the normal design does not have:
+#   axi_timer_0   sample timer (XTmrCtr counter 0)
+#   axi_intc_0    its interrupt, into the MicroBlaze INTERRUPT input;
+#                 on a design that already has the controller
+#                 (../irq/design_1_irq.tcl) the timer is added to it
+#   64 KB LMB     room for the -pg build, the histogram and the
+#                 call-graph tables next to the game
+#   LANES = 0     vga_framebuffer_top_0 without the lane layer, to make
+#                 room for the LMB
+#
+# BRAM: the xc7a35t has 50 BRAM36. The normal design uses about 49:
+# frame buffers 14, lane buffers 22, LMB 8 (32 KB), sprite ROMs of the
+# blitter and the object layer 2 each, tile ROM, OAM and line buffers
+# about 1. The 64 KB LMB takes 8 more, so the lane layer goes and the
+# variant needs about 35. The game then runs without HAL_FB_LANES
+# (frogger_profile builds with -DFB_NO_LANES). Check "BRAM Tile" in
+# report_utilization after implementation.
+#
+# Run with the project open, on a copy of the project or a branch:
+#   source FPGAFrogger.srcs/profile/design_1_profile.tcl
+# then regenerate the wrapper, build the bitstream and export the
+# hardware (with bitstream) to the SDK. The BSP for it is
+# FPGAFrogger.sdk/frogger_profile_bsp, the -pg build of the game
+# FPGAFrogger.sdk/frogger_profile.
+################################################################
+
+open_bd_design [get_files design_1.bd]
+
+set mb  [get_bd_cells microblaze_0]
+set ic  [get_bd_cells microblaze_0_axi_periph]
+set clk [get_bd_pins clk_wiz_0/clk_out1]
+set rst [get_bd_pins rst_clk_wiz_0_100M/peripheral_aresetn]
+
+# Lane buffers out, LMB grown below
+set_property -dict [ list \
+ CONFIG.LANES {0} \
+] [get_bd_cells vga_framebuffer_top_0]
+
+# MicroBlaze interrupt input
+set_property -dict [ list \
+ CONFIG.C_USE_INTERRUPT {1} \
+] $mb
+
+# Timer and interrupt controller
+set axi_timer_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_timer:2.0 axi_timer_0 ]
+set_property -dict [ list \
+ CONFIG.enable_timer2 {0} \
+] $axi_timer_0
+
+set shared [expr {[get_bd_cells -quiet axi_intc_0] ne ""}]
+if {$shared} {
+   # The frame interrupt stays on intr bit 0, the timer goes to bit 1
+   set frame_irq [get_bd_pins axi_fb_slave_0/irq]
+   delete_bd_objs [get_bd_nets -of_objects $frame_irq]
+   set irq_concat [ create_bd_cell -type ip -vlnv xilinx.com:ip:xlconcat:2.1 irq_concat ]
+   connect_bd_net $frame_irq [get_bd_pins irq_concat/In0]
+   connect_bd_net [get_bd_pins axi_timer_0/interrupt] [get_bd_pins irq_concat/In1]
+   connect_bd_net [get_bd_pins irq_concat/dout] [get_bd_pins axi_intc_0/intr]
+   set cells [list axi_timer_0]
+} else {
+   set axi_intc_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_intc:4.1 axi_intc_0 ]
+   set_property -dict [ list \
+    CONFIG.C_IRQ_CONNECTION {1} \
+   ] $axi_intc_0
+
+   connect_bd_net [get_bd_pins axi_timer_0/interrupt] [get_bd_pins axi_intc_0/intr]
+   connect_bd_intf_net [get_bd_intf_pins axi_intc_0/interrupt] [get_bd_intf_pins microblaze_0/INTERRUPT]
+   connect_bd_net $clk [get_bd_pins axi_intc_0/processor_clk]
+   connect_bd_net [get_bd_pins rst_clk_wiz_0_100M/mb_reset] [get_bd_pins axi_intc_0/processor_rst]
+   set cells [list axi_timer_0 axi_intc_0]
+}
+
+# One more interconnect master for each new slave
+set mi [get_property CONFIG.NUM_MI $ic]
+set_property -dict [ list \
+ CONFIG.NUM_MI [expr {$mi + [llength $cells]}] \
+] $ic
+
+foreach cell $cells {
+   set port [format "M%02d" $mi]
+   connect_bd_intf_net [get_bd_intf_pins $ic/${port}_AXI] [get_bd_intf_pins $cell/s_axi]
+   connect_bd_net $clk [get_bd_pins $ic/${port}_ACLK] [get_bd_pins $cell/s_axi_aclk]
+   connect_bd_net $rst [get_bd_pins $ic/${port}_ARESETN] [get_bd_pins $cell/s_axi_aresetn]
+   incr mi
+}
+
+# Addresses: the IP defaults; LMB grown from 32 to 64 KB
+create_bd_addr_seg -range 0x00010000 -offset 0x41C00000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_timer_0/S_AXI/Reg] SEG_axi_timer_0_Reg
+if {!$shared} {
+   create_bd_addr_seg -range 0x00010000 -offset 0x41200000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_intc_0/S_AXI/Reg] SEG_axi_intc_0_Reg
+}
+set_property range 64K [get_bd_addr_segs microblaze_0/Data/SEG_dlmb_bram_if_cntlr_Mem]
+set_property range 64K [get_bd_addr_segs microblaze_0/Instruction/SEG_ilmb_bram_if_cntlr_Mem]
+
+validate_bd_design
+save_bd_design
@@ -0,0 +1,321 @@
+// -----------------------------------------------------------------------------
+//  Testbench: vga_framebuffer_top replaying the headless game's write stream
+// -----------------------------------------------------------------------------
+//  The trace is what frogger_host -t logs for the GPIO write port, one line
+//  per GPIO write: "<cpu cycle> <signal> <hex value>" (see hal_host.c). Each
+//  line is applied at its 75 MHz cycle, half a clk_axi period before that
+//  clock's edge, with clk_pix at 25.175 MHz, and reset is released so the
+//  first frame pulse falls on clock FRAME_CLKS, as in the host's model
+//  (fbemu.c). The replay is open loop: the CPU's waits
+//  on frame_ready are already in the timestamps, so where the RTL and the
+//  model disagree the writes land where the model expected them, and show
+//  up as dropped writes or missed swaps here.
+//
+//  Plusargs
+//    +trace=<file>   trace to replay (default trace.txt)
+//    +out=<dir>      write the screen as screen_NNNNN.ppm into this
+//                    directory (default: no images)
+//    +every=<n>      only every n-th screen frame (default 1)
+//
+//  At the end of the trace it reports the clk_axi clocks spent in each
+//  state, the
+//  frame pulses and swaps, the frames where the CPU had not finished
+//  drawing at the frame pulse (missed swap), and the write strobes that
+//  were dropped because they came outside S_DRAW, next to the design's own
+//  frame-pacing counts as of the last frame pulse. One more frame is then
+//  run to get the last swap onto the screen.
+// -----------------------------------------------------------------------------
+//  Icarus:     iverilog -g2012 -s tb_vga_framebuffer_top ...
+//  Verilator:  verilator --binary --timing --top-module tb_vga_framebuffer_top ...
+//  ../Makefile has both, and makes the trace.
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module tb_vga_framebuffer_top #(
+    parameter CLEAR_BACK = 1,   // 0 for a trace of frogger_host -c keep
+    parameter MEM_DIR    = ""   // directory of the .mem files, with a '/'
+);
+
+    localparam FB_WIDTH   = 224;
+    localparam FB_HEIGHT  = 256;
+    localparam BPP        = 4;
+    localparam DEPTH      = FB_WIDTH * FB_HEIGHT;
+    localparam FRAME_CLKS = 800 * 525;
+
+    // clk_pix / clk_cpu = 1007 / 3000 exactly, as in hal_host_spend()
+    localparam real T_PIX = 40000.0 / 1007;   // ns
+    localparam real T_CPU = 40.0 / 3;         // ns
+
+    localparam S_IDLE  = 2'd0,
+               S_CLEAR = 2'd1,
+               S_DRAW  = 2'd2,
+               S_WAIT  = 2'd3;
+
+    // -------------------------------------------------------------------------
+    //                           Clocks and reset
+    // -------------------------------------------------------------------------
+    // clk_pix rising edge n at n * T_PIX, clk_axi's at (n + 0.5) * T_CPU
+    reg clk_pix = 1'b0;
+    reg clk_axi = 1'b0;
+    reg [63:0] n_edge = 64'd1;
+    reg [63:0] n_cpu  = 64'd0;
+
+    initial forever begin
+        #(n_edge * T_PIX - $realtime) clk_pix = 1'b1;
+        #((n_edge + 0.5) * T_PIX - $realtime) clk_pix = 1'b0;
+        n_edge = n_edge + 1;
+    end
+
+    initial forever begin
+        #((n_cpu + 0.5) * T_CPU - $realtime) clk_axi = 1'b1;
+        #((n_cpu + 1.0) * T_CPU - $realtime) clk_axi = 1'b0;
+        n_cpu = n_cpu + 1;
+    end
+
+    // display_480p raises frame on the first clock out of reset; the write
+    // side is out of reset well before that reaches it
+    reg [63:0] pclk = 64'd0;    // rising edges before this one
+    always @(posedge clk_pix) pclk <= pclk + 1;
+    wire rst_pix = (pclk < FRAME_CLKS - 2);
+
+    reg rst_axi = 1'b1;
+    always @(posedge clk_axi) rst_axi <= ($realtime < (FRAME_CLKS - 2) * T_PIX);
+
+    // -------------------------------------------------------------------------
+    //                         Device under test
+    // -------------------------------------------------------------------------
+    reg              cpu_we   = 1'b0;
+    reg  [15:0]      cpu_addr = 16'd0;
+    reg  [BPP-1:0]   cpu_dat  = {BPP{1'b0}};
+    reg              cpu_done = 1'b0;
+    reg              cpu_we8  = 1'b0;
+    reg  [8*BPP-1:0] cpu_dat8 = {8*BPP{1'b0}};
+    reg  [7:0]       cpu_mask8 = 8'd0;
+
+    wire             hsync, vsync;
+    wire [BPP-1:0]   red, green, blue;
+    wire             frame_ready;
+    wire             blit_busy, blit_full, fill_busy, fill_full;
+    wire [15:0]      oam_dropped;
+    wire [31:0]      stat_vsyncs, stat_swaps, stat_missed, stat_draw_max, stat_clear_clks;
+
+    vga_framebuffer_top #(
+        .FB_WIDTH    (FB_WIDTH),
+        .FB_HEIGHT   (FB_HEIGHT),
+        .BPP         (BPP),
+        .INIT_FILE   ({MEM_DIR, "background.mem"}),
+        .SPRITE_FILE ({MEM_DIR, "sprites.mem"}),
+        .TILE_FILE   ({MEM_DIR, "tiles.mem"}),
+        .PALETTE_FILE({MEM_DIR, "palette.mem"}),
+        .CLEAR_BACK  (CLEAR_BACK)
+    ) dut (
+        .clk_pix         (clk_pix),
+        .rst_pix         (rst_pix),
+        .clk_axi         (clk_axi),
+        .rst_axi         (rst_axi),
+        .cpu_we          (cpu_we),
+        .cpu_addr        (cpu_addr),
+        .cpu_dat         (cpu_dat),
+        .cpu_done        (cpu_done),
+        .cpu_we8         (cpu_we8),
+        .cpu_dat8        (cpu_dat8),
+        .cpu_mask8       (cpu_mask8),
+        .cpu_lane8       (1'b0),
+        .cpu_blit_we     (1'b0),
+        .cpu_blit_cmd    (32'd0),
+        .blit_busy       (blit_busy),
+        .blit_full       (blit_full),
+        .cpu_fill_we     (1'b0),
+        .cpu_fill_cmd    (37'd0),
+        .cpu_clear_col   ({BPP{1'b0}}),
+        .fill_busy       (fill_busy),
+        .fill_full       (fill_full),
+        .cpu_oam_we      (1'b0),
+        .cpu_oam_idx     (6'd0),
+        .cpu_oam_dat     (32'd0),
+        .oam_dropped     (oam_dropped),
+        .cpu_tile_we     (1'b0),
+        .cpu_tile_idx    (8'd0),
+        .cpu_tile_dat    (4'd0),
+        .cpu_scroll_we   (1'b0),
+        .cpu_scroll_band (4'd0),
+        .cpu_scroll_dat  (18'd0),
+        .cpu_pal_we      (1'b0),
+        .cpu_pal_idx     (5'd0),
+        .cpu_pal_dat     (17'd0),
+        .VGA_Hsync       (hsync),
+        .VGA_Vsync       (vsync),
+        .VGA_Red         (red),
+        .VGA_Green       (green),
+        .VGA_Blue        (blue),
+        .frame_ready     (frame_ready),
+        .stat_vsyncs     (stat_vsyncs),
+        .stat_swaps      (stat_swaps),
+        .stat_missed     (stat_missed),
+        .stat_draw_max   (stat_draw_max),
+        .stat_clear_clks (stat_clear_clks)
+    );
+
+    // The FPGA configuration zeroes the OAM and the lane buffers, which
+    // have no initial block; without this they would read as X here
+    integer k;
+    initial begin
+        for (k = 0; k < 128; k = k + 1)
+            dut.u_oam.oam[k] = 32'd0;
+        for (k = 0; k < $size(dut.g_lanes.u_lanes.mem); k = k + 1)
+            dut.g_lanes.u_lanes.mem[k] = {BPP{1'b0}};
+    end
+
+    // -------------------------------------------------------------------------
+    //                        Handshake metrics
+    // -------------------------------------------------------------------------
+    reg        tracing = 1'b1;   // count only up to the end of the trace
+    reg [63:0] state_clks [0:3];
+    integer    pulses = 0, swaps = 0, missed = 0;
+    integer    strobes = 0, dropped = 0;
+
+    initial for (k = 0; k < 4; k = k + 1)
+        state_clks[k] = 64'd0;
+
+    always @(posedge clk_axi) if (!rst_axi && tracing) begin
+        state_clks[dut.state] <= state_clks[dut.state] + 1;
+        if (dut.frame_pulse_s) begin
+            pulses <= pulses + 1;
+            if (dut.state == S_WAIT)
+                swaps <= swaps + 1;
+            else if (dut.state == S_DRAW)
+                missed <= missed + 1;
+        end
+    end
+
+    // A strobe is a write-enable pulse of either port; it is dropped when
+    // S_DRAW is not seen on any clock it is high, or (single pixel) its
+    // address is beyond the buffer
+    reg we_q = 1'b0, we8_q = 1'b0, hit = 1'b0;
+    always @(posedge clk_axi) begin
+        we_q  <= cpu_we;
+        we8_q <= cpu_we8;
+        if ((cpu_we | cpu_we8) && dut.state == S_DRAW &&
+            (cpu_we8 || cpu_addr < DEPTH))
+            hit <= 1'b1;
+        if ((we_q & ~cpu_we) | (we8_q & ~cpu_we8)) begin
+            hit <= 1'b0;
+            if (tracing) begin
+                strobes <= strobes + 1;
+                if (!hit)
+                    dropped <= dropped + 1;
+            end
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                 Screen capture (the 224x256 window)
+    // -------------------------------------------------------------------------
+    string  out_dir;
+    integer every = 1;
+    integer screen = 0;     // screen frames since reset
+    integer px = 0;         // window pixels of this one so far
+    integer fd_ppm = 0;
+    string  path;
+
+    always @(posedge clk_pix) begin
+        if (dut.in_win_r6 && out_dir.len() != 0) begin
+            if (px == 0 && screen % every == 0) begin
+                path = $sformatf("%s/screen_%05d.ppm", out_dir, screen);
+                fd_ppm = $fopen(path, "w");
+                if (fd_ppm == 0)
+                    $fatal(1, "cannot write %s", path);
+                $fwrite(fd_ppm, "P3\n%0d %0d\n15\n", FB_WIDTH, FB_HEIGHT);
+            end
+            if (fd_ppm != 0)
+                $fwrite(fd_ppm, "%0d %0d %0d\n", red, green, blue);
+            if (px == DEPTH - 1) begin
+                if (fd_ppm != 0)
+                    $fclose(fd_ppm);
+                fd_ppm = 0;
+                px     = 0;
+                screen = screen + 1;
+            end
+            else
+                px = px + 1;
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                         Trace replay
+    // -------------------------------------------------------------------------
+    string     trace_path;
+    integer    fd, r, lines = 0;
+    reg [63:0] cyc;
+    reg [7:0]  sig;
+    reg [31:0] val;
+    real       total;
+
+    initial begin
+        if (!$value$plusargs("trace=%s", trace_path))
+            trace_path = "trace.txt";
+        if (!$value$plusargs("out=%s", out_dir))
+            out_dir = "";
+        if ($value$plusargs("every=%d", every) && every < 1)
+            every = 1;
+
+        fd = $fopen(trace_path, "r");
+        if (fd == 0)
+            $fatal(1, "cannot read %s", trace_path);
+
+        forever begin
+            r = $fscanf(fd, "%d %c %h\n", cyc, sig, val);
+            if (r != 3)
+                break;
+            lines = lines + 1;
+            if (cyc * T_CPU > $realtime)
+                #(cyc * T_CPU - $realtime);
+            case (sig)
+            "A": cpu_addr  = val[15:0];
+            "D": cpu_dat   = val[BPP-1:0];
+            "W": cpu_we    = val[0];
+            "P": cpu_dat8  = val[8*BPP-1:0];
+            "M": cpu_mask8 = val[7:0];
+            "E": cpu_we8   = val[0];
+            "C": cpu_done  = val[0];
+            default: $fatal(1, "%s line %0d: unknown signal %c", trace_path, lines, sig);
+            endcase
+        end
+        $fclose(fd);
+
+        // let the last strobe finish before the counts stop
+        #(4 * T_CPU);
+        tracing = 1'b0;
+
+        total = state_clks[0] + state_clks[1] + state_clks[2] + state_clks[3];
+        if (total == 0)
+            total = 1;
+        $display("trace             %s, %0d lines, %.1f ms", trace_path, lines,
+                 $realtime / 1e6);
+        $display("clk_axi clocks    %0d", state_clks[0] + state_clks[1] +
+                 state_clks[2] + state_clks[3]);
+        $display("  S_IDLE          %0d (%.1f%%)", state_clks[S_IDLE],
+                 100.0 * state_clks[S_IDLE] / total);
+        $display("  S_CLEAR         %0d (%.1f%%)", state_clks[S_CLEAR],
+                 100.0 * state_clks[S_CLEAR] / total);
+        $display("  S_DRAW          %0d (%.1f%%)", state_clks[S_DRAW],
+                 100.0 * state_clks[S_DRAW] / total);
+        $display("  S_WAIT          %0d (%.1f%%)", state_clks[S_WAIT],
+                 100.0 * state_clks[S_WAIT] / total);
+        $display("vsync periods     %0d", pulses);
+        $display("buffer swaps      %0d", swaps);
+        $display("missed swaps      %0d", missed);
+        $display("write strobes     %0d", strobes);
+        $display("  dropped         %0d", dropped);
+        $display("stat registers    vsyncs %0d swaps %0d missed %0d draw_max %0d clear %0d",
+                 stat_vsyncs, stat_swaps, stat_missed, stat_draw_max, stat_clear_clks);
+
+        // the frame swapped in last reaches the screen in the next one
+        #(2 * FRAME_CLKS * T_PIX);
+        $display("screen frames     %0d", screen);
+        $finish;
+    end
+
+endmodule
@@ -40,7 +40,7 @@ if { [string first $scripts_vivado_version $current_vivado_version] == -1 } {
 
 # The design that will be created by this Tcl script contains the following 
 # module references:
-# vga_framebuffer_top
+# axi_fb_slave, vga_framebuffer_top
 
 # Please add the sources of those modules before sourcing this Tcl script.
 
@@ -282,21 +282,23 @@ proc create_root_design { parentCell } {
    CONFIG.USE_BOARD_FLOW {true} \
  ] $axi_gpio_0
 
-  # Create instance: axi_gpio_addr, and set properties
-  set axi_gpio_addr [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_addr ]
-  set_property -dict [ list \
-   CONFIG.C_ALL_INPUTS {0} \
-   CONFIG.C_ALL_OUTPUTS {1} \
-   CONFIG.C_GPIO_WIDTH {16} \
- ] $axi_gpio_addr
-
-  # Create instance: axi_gpio_dat, and set properties
-  set axi_gpio_dat [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_dat ]
+  # Create instance: axi_fb_slave_0, and set properties
+  set block_name axi_fb_slave
+  set block_cell_name axi_fb_slave_0
+  if { [catch {set axi_fb_slave_0 [create_bd_cell -type module -reference $block_name $block_cell_name] } errmsg] } {
+     catch {common::send_msg_id "BD_TCL-105" "ERROR" "Unable to add referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   } elseif { $axi_fb_slave_0 eq "" } {
+     catch {common::send_msg_id "BD_TCL-106" "ERROR" "Unable to referenced block <$block_name>. Please add the files for ${block_name}'s definition into the project."}
+     return 1
+   }
+  
+  # Create instance: axi_gpio_cpu_done, and set properties
+  set axi_gpio_cpu_done [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_cpu_done ]
   set_property -dict [ list \
-   CONFIG.C_ALL_INPUTS {0} \
    CONFIG.C_ALL_OUTPUTS {1} \
-   CONFIG.C_GPIO_WIDTH {4} \
- ] $axi_gpio_dat
+   CONFIG.C_GPIO_WIDTH {1} \
+ ] $axi_gpio_cpu_done
 
   # Create instance: axi_gpio_frame_rdy, and set properties
   set axi_gpio_frame_rdy [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_frame_rdy ]
@@ -313,14 +315,6 @@ proc create_root_design { parentCell } {
    CONFIG.C_GPIO_WIDTH {1} \
  ] $axi_gpio_vsync
 
-  # Create instance: axi_gpio_we, and set properties
-  set axi_gpio_we [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_gpio:2.0 axi_gpio_we ]
-  set_property -dict [ list \
-   CONFIG.C_ALL_INPUTS {0} \
-   CONFIG.C_ALL_OUTPUTS {1} \
-   CONFIG.C_GPIO_WIDTH {1} \
- ] $axi_gpio_we
-
   # Create instance: axi_uartlite_0, and set properties
   set axi_uartlite_0 [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_uartlite:2.0 axi_uartlite_0 ]
   set_property -dict [ list \
@@ -363,7 +357,7 @@ proc create_root_design { parentCell } {
   # Create instance: microblaze_0_axi_periph, and set properties
   set microblaze_0_axi_periph [ create_bd_cell -type ip -vlnv xilinx.com:ip:axi_interconnect:2.1 microblaze_0_axi_periph ]
   set_property -dict [ list \
-   CONFIG.NUM_MI {8} \
+   CONFIG.NUM_MI {7} \
  ] $microblaze_0_axi_periph
 
   # Create instance: microblaze_0_local_memory
@@ -394,46 +388,77 @@ proc create_root_design { parentCell } {
   connect_bd_intf_net -intf_net microblaze_0_M_AXI_DP [get_bd_intf_pins microblaze_0/M_AXI_DP] [get_bd_intf_pins microblaze_0_axi_periph/S00_AXI]
   connect_bd_intf_net -intf_net microblaze_0_axi_periph_M00_AXI [get_bd_intf_pins axi_gpio_0/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M00_AXI]
   connect_bd_intf_net -intf_net microblaze_0_axi_periph_M01_AXI [get_bd_intf_pins axi_uartlite_0/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M01_AXI]
-  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M02_AXI [get_bd_intf_pins axi_gpio_we/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M02_AXI]
-  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M03_AXI [get_bd_intf_pins axi_gpio_addr/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M03_AXI]
-  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M04_AXI [get_bd_intf_pins axi_gpio_dat/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M04_AXI]
+  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M02_AXI [get_bd_intf_pins axi_fb_slave_0/s_axi] [get_bd_intf_pins microblaze_0_axi_periph/M02_AXI]
+  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M03_AXI [get_bd_intf_pins axi_gpio_frame_rdy/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M03_AXI]
+  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M04_AXI [get_bd_intf_pins axi_gpio_cpu_done/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M04_AXI]
   connect_bd_intf_net -intf_net microblaze_0_axi_periph_M05_AXI [get_bd_intf_pins PmodKYPD_0/AXI_LITE_GPIO] [get_bd_intf_pins microblaze_0_axi_periph/M05_AXI]
   connect_bd_intf_net -intf_net microblaze_0_axi_periph_M06_AXI [get_bd_intf_pins axi_gpio_vsync/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M06_AXI]
-  connect_bd_intf_net -intf_net microblaze_0_axi_periph_M07_AXI [get_bd_intf_pins axi_gpio_frame_rdy/S_AXI] [get_bd_intf_pins microblaze_0_axi_periph/M07_AXI]
   connect_bd_intf_net -intf_net microblaze_0_debug [get_bd_intf_pins mdm_1/MBDEBUG_0] [get_bd_intf_pins microblaze_0/DEBUG]
   connect_bd_intf_net -intf_net microblaze_0_dlmb_1 [get_bd_intf_pins microblaze_0/DLMB] [get_bd_intf_pins microblaze_0_local_memory/DLMB]
   connect_bd_intf_net -intf_net microblaze_0_ilmb_1 [get_bd_intf_pins microblaze_0/ILMB] [get_bd_intf_pins microblaze_0_local_memory/ILMB]
 
   # Create port connections
-  connect_bd_net -net axi_gpio_addr_gpio_io_o [get_bd_pins axi_gpio_addr/gpio_io_o] [get_bd_pins vga_framebuffer_top_0/cpu_addr]
-  connect_bd_net -net axi_gpio_dat_gpio_io_o [get_bd_pins axi_gpio_dat/gpio_io_o] [get_bd_pins vga_framebuffer_top_0/cpu_dat]
-  connect_bd_net -net axi_gpio_we_gpio_io_o [get_bd_pins axi_gpio_we/gpio_io_o] [get_bd_pins vga_framebuffer_top_0/cpu_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_addr [get_bd_pins axi_fb_slave_0/cpu_addr] [get_bd_pins vga_framebuffer_top_0/cpu_addr]
+  connect_bd_net -net axi_fb_slave_0_cpu_blit_cmd [get_bd_pins axi_fb_slave_0/cpu_blit_cmd] [get_bd_pins vga_framebuffer_top_0/cpu_blit_cmd]
+  connect_bd_net -net axi_fb_slave_0_cpu_blit_we [get_bd_pins axi_fb_slave_0/cpu_blit_we] [get_bd_pins vga_framebuffer_top_0/cpu_blit_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_clear_col [get_bd_pins axi_fb_slave_0/cpu_clear_col] [get_bd_pins vga_framebuffer_top_0/cpu_clear_col]
+  connect_bd_net -net axi_fb_slave_0_cpu_dat [get_bd_pins axi_fb_slave_0/cpu_dat] [get_bd_pins vga_framebuffer_top_0/cpu_dat]
+  connect_bd_net -net axi_fb_slave_0_cpu_dat8 [get_bd_pins axi_fb_slave_0/cpu_dat8] [get_bd_pins vga_framebuffer_top_0/cpu_dat8]
+  connect_bd_net -net axi_fb_slave_0_cpu_fill_cmd [get_bd_pins axi_fb_slave_0/cpu_fill_cmd] [get_bd_pins vga_framebuffer_top_0/cpu_fill_cmd]
+  connect_bd_net -net axi_fb_slave_0_cpu_fill_we [get_bd_pins axi_fb_slave_0/cpu_fill_we] [get_bd_pins vga_framebuffer_top_0/cpu_fill_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_lane8 [get_bd_pins axi_fb_slave_0/cpu_lane8] [get_bd_pins vga_framebuffer_top_0/cpu_lane8]
+  connect_bd_net -net axi_fb_slave_0_cpu_mask8 [get_bd_pins axi_fb_slave_0/cpu_mask8] [get_bd_pins vga_framebuffer_top_0/cpu_mask8]
+  connect_bd_net -net axi_fb_slave_0_cpu_oam_dat [get_bd_pins axi_fb_slave_0/cpu_oam_dat] [get_bd_pins vga_framebuffer_top_0/cpu_oam_dat]
+  connect_bd_net -net axi_fb_slave_0_cpu_oam_idx [get_bd_pins axi_fb_slave_0/cpu_oam_idx] [get_bd_pins vga_framebuffer_top_0/cpu_oam_idx]
+  connect_bd_net -net axi_fb_slave_0_cpu_oam_we [get_bd_pins axi_fb_slave_0/cpu_oam_we] [get_bd_pins vga_framebuffer_top_0/cpu_oam_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_pal_dat [get_bd_pins axi_fb_slave_0/cpu_pal_dat] [get_bd_pins vga_framebuffer_top_0/cpu_pal_dat]
+  connect_bd_net -net axi_fb_slave_0_cpu_pal_idx [get_bd_pins axi_fb_slave_0/cpu_pal_idx] [get_bd_pins vga_framebuffer_top_0/cpu_pal_idx]
+  connect_bd_net -net axi_fb_slave_0_cpu_pal_we [get_bd_pins axi_fb_slave_0/cpu_pal_we] [get_bd_pins vga_framebuffer_top_0/cpu_pal_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_scroll_band [get_bd_pins axi_fb_slave_0/cpu_scroll_band] [get_bd_pins vga_framebuffer_top_0/cpu_scroll_band]
+  connect_bd_net -net axi_fb_slave_0_cpu_scroll_dat [get_bd_pins axi_fb_slave_0/cpu_scroll_dat] [get_bd_pins vga_framebuffer_top_0/cpu_scroll_dat]
+  connect_bd_net -net axi_fb_slave_0_cpu_scroll_we [get_bd_pins axi_fb_slave_0/cpu_scroll_we] [get_bd_pins vga_framebuffer_top_0/cpu_scroll_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_tile_dat [get_bd_pins axi_fb_slave_0/cpu_tile_dat] [get_bd_pins vga_framebuffer_top_0/cpu_tile_dat]
+  connect_bd_net -net axi_fb_slave_0_cpu_tile_idx [get_bd_pins axi_fb_slave_0/cpu_tile_idx] [get_bd_pins vga_framebuffer_top_0/cpu_tile_idx]
+  connect_bd_net -net axi_fb_slave_0_cpu_tile_we [get_bd_pins axi_fb_slave_0/cpu_tile_we] [get_bd_pins vga_framebuffer_top_0/cpu_tile_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_we [get_bd_pins axi_fb_slave_0/cpu_we] [get_bd_pins vga_framebuffer_top_0/cpu_we]
+  connect_bd_net -net axi_fb_slave_0_cpu_we8 [get_bd_pins axi_fb_slave_0/cpu_we8] [get_bd_pins vga_framebuffer_top_0/cpu_we8]
+  connect_bd_net -net axi_gpio_cpu_done_gpio_io_o [get_bd_pins axi_gpio_cpu_done/gpio_io_o] [get_bd_pins vga_framebuffer_top_0/cpu_done]
   connect_bd_net -net clk_wiz_0_clk_out2 [get_bd_pins clk_wiz_0/clk_out2] [get_bd_pins proc_sys_reset_0/slowest_sync_clk] [get_bd_pins vga_framebuffer_top_0/clk_pix]
   connect_bd_net -net clk_wiz_0_locked [get_bd_pins clk_wiz_0/locked] [get_bd_pins proc_sys_reset_0/dcm_locked] [get_bd_pins rst_clk_wiz_0_100M/dcm_locked]
   connect_bd_net -net mdm_1_debug_sys_rst [get_bd_pins mdm_1/Debug_SYS_Rst] [get_bd_pins rst_clk_wiz_0_100M/mb_debug_sys_rst]
-  connect_bd_net -net microblaze_0_Clk [get_bd_pins PmodKYPD_0/s_axi_aclk] [get_bd_pins axi_gpio_0/s_axi_aclk] [get_bd_pins axi_gpio_addr/s_axi_aclk] [get_bd_pins axi_gpio_dat/s_axi_aclk] [get_bd_pins axi_gpio_frame_rdy/s_axi_aclk] [get_bd_pins axi_gpio_vsync/s_axi_aclk] [get_bd_pins axi_gpio_we/s_axi_aclk] [get_bd_pins axi_uartlite_0/s_axi_aclk] [get_bd_pins clk_wiz_0/clk_out1] [get_bd_pins microblaze_0/Clk] [get_bd_pins microblaze_0_axi_periph/ACLK] [get_bd_pins microblaze_0_axi_periph/M00_ACLK] [get_bd_pins microblaze_0_axi_periph/M01_ACLK] [get_bd_pins microblaze_0_axi_periph/M02_ACLK] [get_bd_pins microblaze_0_axi_periph/M03_ACLK] [get_bd_pins microblaze_0_axi_periph/M04_ACLK] [get_bd_pins microblaze_0_axi_periph/M05_ACLK] [get_bd_pins microblaze_0_axi_periph/M06_ACLK] [get_bd_pins microblaze_0_axi_periph/M07_ACLK] [get_bd_pins microblaze_0_axi_periph/S00_ACLK] [get_bd_pins microblaze_0_local_memory/LMB_Clk] [get_bd_pins rst_clk_wiz_0_100M/slowest_sync_clk]
+  connect_bd_net -net microblaze_0_Clk [get_bd_pins PmodKYPD_0/s_axi_aclk] [get_bd_pins axi_fb_slave_0/s_axi_aclk] [get_bd_pins axi_gpio_0/s_axi_aclk] [get_bd_pins axi_gpio_cpu_done/s_axi_aclk] [get_bd_pins axi_gpio_frame_rdy/s_axi_aclk] [get_bd_pins axi_gpio_vsync/s_axi_aclk] [get_bd_pins axi_uartlite_0/s_axi_aclk] [get_bd_pins clk_wiz_0/clk_out1] [get_bd_pins microblaze_0/Clk] [get_bd_pins microblaze_0_axi_periph/ACLK] [get_bd_pins microblaze_0_axi_periph/M00_ACLK] [get_bd_pins microblaze_0_axi_periph/M01_ACLK] [get_bd_pins microblaze_0_axi_periph/M02_ACLK] [get_bd_pins microblaze_0_axi_periph/M03_ACLK] [get_bd_pins microblaze_0_axi_periph/M04_ACLK] [get_bd_pins microblaze_0_axi_periph/M05_ACLK] [get_bd_pins microblaze_0_axi_periph/M06_ACLK] [get_bd_pins microblaze_0_axi_periph/S00_ACLK] [get_bd_pins microblaze_0_local_memory/LMB_Clk] [get_bd_pins rst_clk_wiz_0_100M/slowest_sync_clk] [get_bd_pins vga_framebuffer_top_0/clk_axi]
   connect_bd_net -net proc_sys_reset_0_peripheral_reset [get_bd_pins proc_sys_reset_0/peripheral_reset] [get_bd_pins vga_framebuffer_top_0/rst_pix]
   connect_bd_net -net reset_1 [get_bd_ports reset] [get_bd_pins clk_wiz_0/reset] [get_bd_pins proc_sys_reset_0/ext_reset_in] [get_bd_pins rst_clk_wiz_0_100M/ext_reset_in]
   connect_bd_net -net rst_clk_wiz_0_100M_bus_struct_reset [get_bd_pins microblaze_0_local_memory/SYS_Rst] [get_bd_pins rst_clk_wiz_0_100M/bus_struct_reset]
   connect_bd_net -net rst_clk_wiz_0_100M_interconnect_aresetn [get_bd_pins microblaze_0_axi_periph/ARESETN] [get_bd_pins rst_clk_wiz_0_100M/interconnect_aresetn]
   connect_bd_net -net rst_clk_wiz_0_100M_mb_reset [get_bd_pins microblaze_0/Reset] [get_bd_pins rst_clk_wiz_0_100M/mb_reset]
-  connect_bd_net -net rst_clk_wiz_0_100M_peripheral_aresetn [get_bd_pins PmodKYPD_0/s_axi_aresetn] [get_bd_pins axi_gpio_0/s_axi_aresetn] [get_bd_pins axi_gpio_addr/s_axi_aresetn] [get_bd_pins axi_gpio_dat/s_axi_aresetn] [get_bd_pins axi_gpio_frame_rdy/s_axi_aresetn] [get_bd_pins axi_gpio_vsync/s_axi_aresetn] [get_bd_pins axi_gpio_we/s_axi_aresetn] [get_bd_pins axi_uartlite_0/s_axi_aresetn] [get_bd_pins microblaze_0_axi_periph/M00_ARESETN] [get_bd_pins microblaze_0_axi_periph/M01_ARESETN] [get_bd_pins microblaze_0_axi_periph/M02_ARESETN] [get_bd_pins microblaze_0_axi_periph/M03_ARESETN] [get_bd_pins microblaze_0_axi_periph/M04_ARESETN] [get_bd_pins microblaze_0_axi_periph/M05_ARESETN] [get_bd_pins microblaze_0_axi_periph/M06_ARESETN] [get_bd_pins microblaze_0_axi_periph/M07_ARESETN] [get_bd_pins microblaze_0_axi_periph/S00_ARESETN] [get_bd_pins rst_clk_wiz_0_100M/peripheral_aresetn]
+  connect_bd_net -net rst_clk_wiz_0_100M_peripheral_aresetn [get_bd_pins PmodKYPD_0/s_axi_aresetn] [get_bd_pins axi_fb_slave_0/s_axi_aresetn] [get_bd_pins axi_gpio_0/s_axi_aresetn] [get_bd_pins axi_gpio_cpu_done/s_axi_aresetn] [get_bd_pins axi_gpio_frame_rdy/s_axi_aresetn] [get_bd_pins axi_gpio_vsync/s_axi_aresetn] [get_bd_pins axi_uartlite_0/s_axi_aresetn] [get_bd_pins microblaze_0_axi_periph/M00_ARESETN] [get_bd_pins microblaze_0_axi_periph/M01_ARESETN] [get_bd_pins microblaze_0_axi_periph/M02_ARESETN] [get_bd_pins microblaze_0_axi_periph/M03_ARESETN] [get_bd_pins microblaze_0_axi_periph/M04_ARESETN] [get_bd_pins microblaze_0_axi_periph/M05_ARESETN] [get_bd_pins microblaze_0_axi_periph/M06_ARESETN] [get_bd_pins microblaze_0_axi_periph/S00_ARESETN] [get_bd_pins rst_clk_wiz_0_100M/peripheral_aresetn]
+  connect_bd_net -net rst_clk_wiz_0_100M_peripheral_reset [get_bd_pins rst_clk_wiz_0_100M/peripheral_reset] [get_bd_pins vga_framebuffer_top_0/rst_axi]
   connect_bd_net -net sys_clock_1 [get_bd_ports sys_clock] [get_bd_pins clk_wiz_0/clk_in1]
   connect_bd_net -net vga_framebuffer_top_0_VGA_Blue [get_bd_ports vgaBlue] [get_bd_pins vga_framebuffer_top_0/VGA_Blue]
   connect_bd_net -net vga_framebuffer_top_0_VGA_Green [get_bd_ports vgaGreen] [get_bd_pins vga_framebuffer_top_0/VGA_Green]
   connect_bd_net -net vga_framebuffer_top_0_VGA_Hsync [get_bd_ports Hsync] [get_bd_pins vga_framebuffer_top_0/VGA_Hsync]
   connect_bd_net -net vga_framebuffer_top_0_VGA_Red [get_bd_ports vgaRed] [get_bd_pins vga_framebuffer_top_0/VGA_Red]
   connect_bd_net -net vga_framebuffer_top_0_VGA_Vsync [get_bd_ports Vsync] [get_bd_pins axi_gpio_vsync/gpio_io_i] [get_bd_pins vga_framebuffer_top_0/VGA_Vsync]
-  connect_bd_net -net vga_framebuffer_top_0_frame_ready [get_bd_pins axi_gpio_frame_rdy/gpio_io_i] [get_bd_pins vga_framebuffer_top_0/frame_ready]
+  connect_bd_net -net vga_framebuffer_top_0_blit_busy [get_bd_pins axi_fb_slave_0/blit_busy] [get_bd_pins vga_framebuffer_top_0/blit_busy]
+  connect_bd_net -net vga_framebuffer_top_0_blit_full [get_bd_pins axi_fb_slave_0/blit_full] [get_bd_pins vga_framebuffer_top_0/blit_full]
+  connect_bd_net -net vga_framebuffer_top_0_fill_busy [get_bd_pins axi_fb_slave_0/fill_busy] [get_bd_pins vga_framebuffer_top_0/fill_busy]
+  connect_bd_net -net vga_framebuffer_top_0_fill_full [get_bd_pins axi_fb_slave_0/fill_full] [get_bd_pins vga_framebuffer_top_0/fill_full]
+  connect_bd_net -net vga_framebuffer_top_0_frame_ready [get_bd_pins axi_fb_slave_0/frame_ready] [get_bd_pins axi_gpio_frame_rdy/gpio_io_i] [get_bd_pins vga_framebuffer_top_0/frame_ready]
+  connect_bd_net -net vga_framebuffer_top_0_oam_dropped [get_bd_pins axi_fb_slave_0/oam_dropped] [get_bd_pins vga_framebuffer_top_0/oam_dropped]
+  connect_bd_net -net vga_framebuffer_top_0_stat_clear_clks [get_bd_pins axi_fb_slave_0/stat_clear_clks] [get_bd_pins vga_framebuffer_top_0/stat_clear_clks]
+  connect_bd_net -net vga_framebuffer_top_0_stat_draw_max [get_bd_pins axi_fb_slave_0/stat_draw_max] [get_bd_pins vga_framebuffer_top_0/stat_draw_max]
+  connect_bd_net -net vga_framebuffer_top_0_stat_missed [get_bd_pins axi_fb_slave_0/stat_missed] [get_bd_pins vga_framebuffer_top_0/stat_missed]
+  connect_bd_net -net vga_framebuffer_top_0_stat_swaps [get_bd_pins axi_fb_slave_0/stat_swaps] [get_bd_pins vga_framebuffer_top_0/stat_swaps]
+  connect_bd_net -net vga_framebuffer_top_0_stat_vsyncs [get_bd_pins axi_fb_slave_0/stat_vsyncs] [get_bd_pins vga_framebuffer_top_0/stat_vsyncs]
 
   # Create address segments
   create_bd_addr_seg -range 0x00001000 -offset 0x00010000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs PmodKYPD_0/AXI_LITE_GPIO/Reg0] SEG_PmodKYPD_0_Reg0
+  create_bd_addr_seg -range 0x00080000 -offset 0x44A00000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_fb_slave_0/s_axi/reg0] SEG_axi_fb_slave_0_reg0
   create_bd_addr_seg -range 0x00010000 -offset 0x40000000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_0/S_AXI/Reg] SEG_axi_gpio_0_Reg
+  create_bd_addr_seg -range 0x00010000 -offset 0x40060000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_cpu_done/S_AXI/Reg] SEG_axi_gpio_cpu_done_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x40040000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_vsync/S_AXI/Reg] SEG_axi_gpio_1_Reg
-  create_bd_addr_seg -range 0x00010000 -offset 0x40020000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_addr/S_AXI/Reg] SEG_axi_gpio_addr_Reg
-  create_bd_addr_seg -range 0x00010000 -offset 0x40030000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_dat/S_AXI/Reg] SEG_axi_gpio_dat_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x40050000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_frame_rdy/S_AXI/Reg] SEG_axi_gpio_frame_rdy_Reg
-  create_bd_addr_seg -range 0x00010000 -offset 0x40010000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_gpio_we/S_AXI/Reg] SEG_axi_gpio_we_Reg
   create_bd_addr_seg -range 0x00010000 -offset 0x40600000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs axi_uartlite_0/S_AXI/Reg] SEG_axi_uartlite_0_Reg
   create_bd_addr_seg -range 0x00008000 -offset 0x00000000 [get_bd_addr_spaces microblaze_0/Data] [get_bd_addr_segs microblaze_0_local_memory/dlmb_bram_if_cntlr/SLMB/Mem] SEG_dlmb_bram_if_cntlr_Mem
   create_bd_addr_seg -range 0x00008000 -offset 0x00000000 [get_bd_addr_spaces microblaze_0/Instruction] [get_bd_addr_segs microblaze_0_local_memory/ilmb_bram_if_cntlr/SLMB/Mem] SEG_ilmb_bram_if_cntlr_Mem
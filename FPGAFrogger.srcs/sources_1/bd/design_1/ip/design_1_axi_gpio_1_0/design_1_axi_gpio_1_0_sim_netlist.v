@@ -1,1527 +0,0 @@
-// Copyright 1986-2018 Xilinx, Inc. All Rights Reserved.
-// --------------------------------------------------------------------------------
-// Tool Version: Vivado v.2018.2 (win64) Build 2258646 Thu Jun 14 20:03:12 MDT 2018
-// Date        : Thu May 22 15:45:31 2025
-// Host        : Christopher-Desktop running 64-bit major release  (build 9200)
-// Command     : write_verilog -force -mode funcsim
-//               C:/Vivado/FPGAFrogger/FPGAFrogger.srcs/sources_1/bd/design_1/ip/design_1_axi_gpio_1_0/design_1_axi_gpio_1_0_sim_netlist.v
-// Design      : design_1_axi_gpio_1_0
-// Purpose     : This verilog netlist is a functional simulation representation of the design and should not be modified
-//               or synthesized. This netlist cannot be used for SDF annotated simulation.
-// Device      : xc7a35tcpg236-1
-// --------------------------------------------------------------------------------
-`timescale 1 ps / 1 ps
-
-(* CHECK_LICENSE_TYPE = "design_1_axi_gpio_1_0,axi_gpio,{}" *) (* downgradeipidentifiedwarnings = "yes" *) (* x_core_info = "axi_gpio,Vivado 2018.2" *) 
-(* NotValidForBitStream *)
-module design_1_axi_gpio_1_0
-   (s_axi_aclk,
-    s_axi_aresetn,
-    s_axi_awaddr,
-    s_axi_awvalid,
-    s_axi_awready,
-    s_axi_wdata,
-    s_axi_wstrb,
-    s_axi_wvalid,
-    s_axi_wready,
-    s_axi_bresp,
-    s_axi_bvalid,
-    s_axi_bready,
-    s_axi_araddr,
-    s_axi_arvalid,
-    s_axi_arready,
-    s_axi_rdata,
-    s_axi_rresp,
-    s_axi_rvalid,
-    s_axi_rready,
-    gpio_io_o);
-  (* x_interface_info = "xilinx.com:signal:clock:1.0 S_AXI_ACLK CLK" *) (* x_interface_parameter = "XIL_INTERFACENAME S_AXI_ACLK, ASSOCIATED_BUSIF S_AXI, ASSOCIATED_RESET s_axi_aresetn, FREQ_HZ 75000000, PHASE 0.0, CLK_DOMAIN /clk_wiz_0_clk_out1" *) input s_axi_aclk;
-  (* x_interface_info = "xilinx.com:signal:reset:1.0 S_AXI_ARESETN RST" *) (* x_interface_parameter = "XIL_INTERFACENAME S_AXI_ARESETN, POLARITY ACTIVE_LOW" *) input s_axi_aresetn;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI AWADDR" *) (* x_interface_parameter = "XIL_INTERFACENAME S_AXI, DATA_WIDTH 32, PROTOCOL AXI4LITE, FREQ_HZ 75000000, ID_WIDTH 0, ADDR_WIDTH 9, AWUSER_WIDTH 0, ARUSER_WIDTH 0, WUSER_WIDTH 0, RUSER_WIDTH 0, BUSER_WIDTH 0, READ_WRITE_MODE READ_WRITE, HAS_BURST 0, HAS_LOCK 0, HAS_PROT 0, HAS_CACHE 0, HAS_QOS 0, HAS_REGION 0, HAS_WSTRB 1, HAS_BRESP 1, HAS_RRESP 1, SUPPORTS_NARROW_BURST 0, NUM_READ_OUTSTANDING 2, NUM_WRITE_OUTSTANDING 2, MAX_BURST_LENGTH 1, PHASE 0.0, CLK_DOMAIN /clk_wiz_0_clk_out1, NUM_READ_THREADS 1, NUM_WRITE_THREADS 1, RUSER_BITS_PER_BYTE 0, WUSER_BITS_PER_BYTE 0" *) input [8:0]s_axi_awaddr;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI AWVALID" *) input s_axi_awvalid;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI AWREADY" *) output s_axi_awready;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI WDATA" *) input [31:0]s_axi_wdata;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI WSTRB" *) input [3:0]s_axi_wstrb;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI WVALID" *) input s_axi_wvalid;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI WREADY" *) output s_axi_wready;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI BRESP" *) output [1:0]s_axi_bresp;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI BVALID" *) output s_axi_bvalid;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI BREADY" *) input s_axi_bready;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI ARADDR" *) input [8:0]s_axi_araddr;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI ARVALID" *) input s_axi_arvalid;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI ARREADY" *) output s_axi_arready;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI RDATA" *) output [31:0]s_axi_rdata;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI RRESP" *) output [1:0]s_axi_rresp;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI RVALID" *) output s_axi_rvalid;
-  (* x_interface_info = "xilinx.com:interface:aximm:1.0 S_AXI RREADY" *) input s_axi_rready;
-  (* x_interface_info = "xilinx.com:interface:gpio:1.0 GPIO TRI_O" *) (* x_interface_parameter = "XIL_INTERFACENAME GPIO, BOARD.ASSOCIATED_PARAM GPIO_BOARD_INTERFACE" *) output [0:0]gpio_io_o;
-
-  wire [0:0]gpio_io_o;
-  wire s_axi_aclk;
-  wire [8:0]s_axi_araddr;
-  wire s_axi_aresetn;
-  wire s_axi_arready;
-  wire s_axi_arvalid;
-  wire [8:0]s_axi_awaddr;
-  wire s_axi_awready;
-  wire s_axi_awvalid;
-  wire s_axi_bready;
-  wire [1:0]s_axi_bresp;
-  wire s_axi_bvalid;
-  wire [31:0]s_axi_rdata;
-  wire s_axi_rready;
-  wire [1:0]s_axi_rresp;
-  wire s_axi_rvalid;
-  wire [31:0]s_axi_wdata;
-  wire s_axi_wready;
-  wire [3:0]s_axi_wstrb;
-  wire s_axi_wvalid;
-  wire NLW_U0_ip2intc_irpt_UNCONNECTED;
-  wire [31:0]NLW_U0_gpio2_io_o_UNCONNECTED;
-  wire [31:0]NLW_U0_gpio2_io_t_UNCONNECTED;
-  wire [0:0]NLW_U0_gpio_io_t_UNCONNECTED;
-
-  (* C_ALL_INPUTS = "0" *) 
-  (* C_ALL_INPUTS_2 = "0" *) 
-  (* C_ALL_OUTPUTS = "1" *) 
-  (* C_ALL_OUTPUTS_2 = "0" *) 
-  (* C_DOUT_DEFAULT = "0" *) 
-  (* C_DOUT_DEFAULT_2 = "0" *) 
-  (* C_FAMILY = "artix7" *) 
-  (* C_GPIO2_WIDTH = "32" *) 
-  (* C_GPIO_WIDTH = "1" *) 
-  (* C_INTERRUPT_PRESENT = "0" *) 
-  (* C_IS_DUAL = "0" *) 
-  (* C_S_AXI_ADDR_WIDTH = "9" *) 
-  (* C_S_AXI_DATA_WIDTH = "32" *) 
-  (* C_TRI_DEFAULT = "-1" *) 
-  (* C_TRI_DEFAULT_2 = "-1" *) 
-  (* downgradeipidentifiedwarnings = "yes" *) 
-  (* ip_group = "LOGICORE" *) 
-  design_1_axi_gpio_1_0_axi_gpio U0
-       (.gpio2_io_i({1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0,1'b0}),
-        .gpio2_io_o(NLW_U0_gpio2_io_o_UNCONNECTED[31:0]),
-        .gpio2_io_t(NLW_U0_gpio2_io_t_UNCONNECTED[31:0]),
-        .gpio_io_i(1'b0),
-        .gpio_io_o(gpio_io_o),
-        .gpio_io_t(NLW_U0_gpio_io_t_UNCONNECTED[0]),
-        .ip2intc_irpt(NLW_U0_ip2intc_irpt_UNCONNECTED),
-        .s_axi_aclk(s_axi_aclk),
-        .s_axi_araddr(s_axi_araddr),
-        .s_axi_aresetn(s_axi_aresetn),
-        .s_axi_arready(s_axi_arready),
-        .s_axi_arvalid(s_axi_arvalid),
-        .s_axi_awaddr(s_axi_awaddr),
-        .s_axi_awready(s_axi_awready),
-        .s_axi_awvalid(s_axi_awvalid),
-        .s_axi_bready(s_axi_bready),
-        .s_axi_bresp(s_axi_bresp),
-        .s_axi_bvalid(s_axi_bvalid),
-        .s_axi_rdata(s_axi_rdata),
-        .s_axi_rready(s_axi_rready),
-        .s_axi_rresp(s_axi_rresp),
-        .s_axi_rvalid(s_axi_rvalid),
-        .s_axi_wdata(s_axi_wdata),
-        .s_axi_wready(s_axi_wready),
-        .s_axi_wstrb(s_axi_wstrb),
-        .s_axi_wvalid(s_axi_wvalid));
-endmodule
-
-(* ORIG_REF_NAME = "GPIO_Core" *) 
-module design_1_axi_gpio_1_0_GPIO_Core
-   (gpio_io_o,
-    gpio_io_t,
-    ip2bus_wrack_i,
-    ip2bus_rdack_i,
-    D,
-    rst,
-    s_axi_aclk,
-    bus2ip_cs,
-    \bus2ip_addr_i_reg[2] ,
-    \bus2ip_addr_i_reg[2]_0 ,
-    bus2ip_rnw,
-    \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ,
-    Bus_RNW_reg,
-    \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg );
-  output [0:0]gpio_io_o;
-  output [0:0]gpio_io_t;
-  output ip2bus_wrack_i;
-  output ip2bus_rdack_i;
-  output [1:0]D;
-  input rst;
-  input s_axi_aclk;
-  input bus2ip_cs;
-  input \bus2ip_addr_i_reg[2] ;
-  input \bus2ip_addr_i_reg[2]_0 ;
-  input bus2ip_rnw;
-  input \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  input \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  input \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  input Bus_RNW_reg;
-  input \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-
-  wire Bus_RNW_reg;
-  wire [1:0]D;
-  wire \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  wire GPIO_xferAck_i;
-  wire \Not_Dual.ALLOUT_ND.READ_REG_GEN[0].reg1[31]_i_1_n_0 ;
-  wire \bus2ip_addr_i_reg[2] ;
-  wire \bus2ip_addr_i_reg[2]_0 ;
-  wire bus2ip_cs;
-  wire bus2ip_rnw;
-  wire [0:0]gpio_io_o;
-  wire [0:0]gpio_io_t;
-  wire gpio_xferAck_Reg;
-  wire iGPIO_xferAck;
-  wire ip2bus_rdack_i;
-  wire ip2bus_wrack_i;
-  wire [31:31]reg1;
-  wire rst;
-  wire s_axi_aclk;
-
-  (* SOFT_HLUTNM = "soft_lutpair8" *) 
-  LUT3 #(
-    .INIT(8'h04)) 
-    \/i_ 
-       (.I0(gpio_xferAck_Reg),
-        .I1(bus2ip_cs),
-        .I2(GPIO_xferAck_i),
-        .O(iGPIO_xferAck));
-  (* SOFT_HLUTNM = "soft_lutpair7" *) 
-  LUT5 #(
-    .INIT(32'h00080000)) 
-    \Not_Dual.ALLOUT_ND.READ_REG_GEN[0].reg1[31]_i_1 
-       (.I0(gpio_io_o),
-        .I1(bus2ip_cs),
-        .I2(gpio_xferAck_Reg),
-        .I3(GPIO_xferAck_i),
-        .I4(bus2ip_rnw),
-        .O(\Not_Dual.ALLOUT_ND.READ_REG_GEN[0].reg1[31]_i_1_n_0 ));
-  FDRE \Not_Dual.ALLOUT_ND.READ_REG_GEN[0].reg1_reg[31] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\Not_Dual.ALLOUT_ND.READ_REG_GEN[0].reg1[31]_i_1_n_0 ),
-        .Q(reg1),
-        .R(1'b0));
-  FDRE #(
-    .INIT(1'b0)) 
-    \Not_Dual.gpio_Data_Out_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\bus2ip_addr_i_reg[2] ),
-        .Q(gpio_io_o),
-        .R(rst));
-  FDSE #(
-    .INIT(1'b1)) 
-    \Not_Dual.gpio_OE_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\bus2ip_addr_i_reg[2]_0 ),
-        .Q(gpio_io_t),
-        .S(rst));
-  FDRE gpio_xferAck_Reg_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(GPIO_xferAck_i),
-        .Q(gpio_xferAck_Reg),
-        .R(rst));
-  FDRE iGPIO_xferAck_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(iGPIO_xferAck),
-        .Q(GPIO_xferAck_i),
-        .R(rst));
-  LUT5 #(
-    .INIT(32'h00001400)) 
-    \ip2bus_data_i_D1[0]_i_1 
-       (.I0(\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .I1(\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .I2(\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .I3(Bus_RNW_reg),
-        .I4(\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .O(D[1]));
-  LUT6 #(
-    .INIT(64'h0011000011400000)) 
-    \ip2bus_data_i_D1[31]_i_1 
-       (.I0(\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .I1(\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .I2(reg1),
-        .I3(\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .I4(Bus_RNW_reg),
-        .I5(\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .O(D[0]));
-  (* SOFT_HLUTNM = "soft_lutpair8" *) 
-  LUT2 #(
-    .INIT(4'h8)) 
-    ip2bus_rdack_i_D1_i_1
-       (.I0(GPIO_xferAck_i),
-        .I1(bus2ip_rnw),
-        .O(ip2bus_rdack_i));
-  (* SOFT_HLUTNM = "soft_lutpair7" *) 
-  LUT2 #(
-    .INIT(4'h2)) 
-    ip2bus_wrack_i_D1_i_1
-       (.I0(GPIO_xferAck_i),
-        .I1(bus2ip_rnw),
-        .O(ip2bus_wrack_i));
-endmodule
-
-(* ORIG_REF_NAME = "address_decoder" *) 
-module design_1_axi_gpio_1_0_address_decoder
-   (\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ,
-    Bus_RNW_reg,
-    \MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ,
-    \Not_Dual.gpio_Data_Out_reg[0] ,
-    \Not_Dual.gpio_OE_reg[0] ,
-    s_axi_arready,
-    s_axi_wready,
-    Q,
-    s_axi_aclk,
-    \bus2ip_addr_i_reg[8] ,
-    s_axi_wdata,
-    gpio_io_o,
-    gpio_io_t,
-    s_axi_aresetn,
-    bus2ip_rnw,
-    ip2bus_rdack_i_D1,
-    is_read_reg,
-    \INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] ,
-    ip2bus_wrack_i_D1,
-    is_write_reg);
-  output \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  output Bus_RNW_reg;
-  output \MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ;
-  output \Not_Dual.gpio_Data_Out_reg[0] ;
-  output \Not_Dual.gpio_OE_reg[0] ;
-  output s_axi_arready;
-  output s_axi_wready;
-  input Q;
-  input s_axi_aclk;
-  input [2:0]\bus2ip_addr_i_reg[8] ;
-  input [1:0]s_axi_wdata;
-  input [0:0]gpio_io_o;
-  input [0:0]gpio_io_t;
-  input s_axi_aresetn;
-  input bus2ip_rnw;
-  input ip2bus_rdack_i_D1;
-  input is_read_reg;
-  input [3:0]\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] ;
-  input ip2bus_wrack_i_D1;
-  input is_write_reg;
-
-  wire Bus_RNW_reg;
-  wire Bus_RNW_reg_i_1_n_0;
-  wire DBus_Reg;
-  wire \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  wire [3:0]\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] ;
-  wire \MEM_DECODE_GEN[0].cs_out_i[0]_i_1_n_0 ;
-  wire \MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ;
-  wire \Not_Dual.gpio_Data_Out[0]_i_3_n_0 ;
-  wire \Not_Dual.gpio_Data_Out_reg[0] ;
-  wire \Not_Dual.gpio_OE_reg[0] ;
-  wire Q;
-  wire [2:0]\bus2ip_addr_i_reg[8] ;
-  wire bus2ip_rnw;
-  wire ce_expnd_i_0;
-  wire ce_expnd_i_1;
-  wire ce_expnd_i_2;
-  wire ce_expnd_i_3;
-  wire cs_ce_clr;
-  wire [0:0]gpio_io_o;
-  wire [0:0]gpio_io_t;
-  wire ip2bus_rdack_i_D1;
-  wire ip2bus_wrack_i_D1;
-  wire is_read_reg;
-  wire is_write_reg;
-  wire s_axi_aclk;
-  wire s_axi_aresetn;
-  wire s_axi_arready;
-  wire [1:0]s_axi_wdata;
-  wire s_axi_wready;
-
-  (* SOFT_HLUTNM = "soft_lutpair2" *) 
-  LUT3 #(
-    .INIT(8'hB8)) 
-    Bus_RNW_reg_i_1
-       (.I0(bus2ip_rnw),
-        .I1(Q),
-        .I2(Bus_RNW_reg),
-        .O(Bus_RNW_reg_i_1_n_0));
-  FDRE Bus_RNW_reg_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(Bus_RNW_reg_i_1_n_0),
-        .Q(Bus_RNW_reg),
-        .R(1'b0));
-  FDRE \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(Q),
-        .D(ce_expnd_i_3),
-        .Q(\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .R(cs_ce_clr));
-  (* SOFT_HLUTNM = "soft_lutpair1" *) 
-  LUT2 #(
-    .INIT(4'h2)) 
-    \GEN_BKEND_CE_REGISTERS[1].ce_out_i[1]_i_1 
-       (.I0(\bus2ip_addr_i_reg[8] [0]),
-        .I1(\bus2ip_addr_i_reg[8] [1]),
-        .O(ce_expnd_i_2));
-  FDRE \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg[1] 
-       (.C(s_axi_aclk),
-        .CE(Q),
-        .D(ce_expnd_i_2),
-        .Q(\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .R(cs_ce_clr));
-  FDRE \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg[2] 
-       (.C(s_axi_aclk),
-        .CE(Q),
-        .D(ce_expnd_i_1),
-        .Q(\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .R(cs_ce_clr));
-  LUT3 #(
-    .INIT(8'hEF)) 
-    \GEN_BKEND_CE_REGISTERS[3].ce_out_i[3]_i_1 
-       (.I0(s_axi_wready),
-        .I1(s_axi_arready),
-        .I2(s_axi_aresetn),
-        .O(cs_ce_clr));
-  (* SOFT_HLUTNM = "soft_lutpair0" *) 
-  LUT2 #(
-    .INIT(4'h8)) 
-    \GEN_BKEND_CE_REGISTERS[3].ce_out_i[3]_i_2 
-       (.I0(\bus2ip_addr_i_reg[8] [1]),
-        .I1(\bus2ip_addr_i_reg[8] [0]),
-        .O(ce_expnd_i_0));
-  FDRE \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg[3] 
-       (.C(s_axi_aclk),
-        .CE(Q),
-        .D(ce_expnd_i_0),
-        .Q(\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .R(cs_ce_clr));
-  design_1_axi_gpio_1_0_pselect_f \MEM_DECODE_GEN[0].PER_CE_GEN[0].MULTIPLE_CES_THIS_CS_GEN.CE_I 
-       (.\bus2ip_addr_i_reg[3] (\bus2ip_addr_i_reg[8] [1:0]),
-        .ce_expnd_i_3(ce_expnd_i_3));
-  design_1_axi_gpio_1_0_pselect_f__parameterized1 \MEM_DECODE_GEN[0].PER_CE_GEN[2].MULTIPLE_CES_THIS_CS_GEN.CE_I 
-       (.\bus2ip_addr_i_reg[3] (\bus2ip_addr_i_reg[8] [1:0]),
-        .ce_expnd_i_1(ce_expnd_i_1));
-  LUT5 #(
-    .INIT(32'h000000E0)) 
-    \MEM_DECODE_GEN[0].cs_out_i[0]_i_1 
-       (.I0(\MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ),
-        .I1(Q),
-        .I2(s_axi_aresetn),
-        .I3(s_axi_arready),
-        .I4(s_axi_wready),
-        .O(\MEM_DECODE_GEN[0].cs_out_i[0]_i_1_n_0 ));
-  FDRE \MEM_DECODE_GEN[0].cs_out_i_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\MEM_DECODE_GEN[0].cs_out_i[0]_i_1_n_0 ),
-        .Q(\MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ),
-        .R(1'b0));
-  (* SOFT_HLUTNM = "soft_lutpair1" *) 
-  LUT5 #(
-    .INIT(32'hFFFE0002)) 
-    \Not_Dual.gpio_Data_Out[0]_i_1 
-       (.I0(DBus_Reg),
-        .I1(\Not_Dual.gpio_Data_Out[0]_i_3_n_0 ),
-        .I2(\bus2ip_addr_i_reg[8] [0]),
-        .I3(\bus2ip_addr_i_reg[8] [1]),
-        .I4(gpio_io_o),
-        .O(\Not_Dual.gpio_Data_Out_reg[0] ));
-  LUT4 #(
-    .INIT(16'hFB08)) 
-    \Not_Dual.gpio_Data_Out[0]_i_2 
-       (.I0(s_axi_wdata[0]),
-        .I1(\MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ),
-        .I2(\bus2ip_addr_i_reg[8] [1]),
-        .I3(s_axi_wdata[1]),
-        .O(DBus_Reg));
-  (* SOFT_HLUTNM = "soft_lutpair2" *) 
-  LUT3 #(
-    .INIT(8'hEF)) 
-    \Not_Dual.gpio_Data_Out[0]_i_3 
-       (.I0(bus2ip_rnw),
-        .I1(\bus2ip_addr_i_reg[8] [2]),
-        .I2(\MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 ),
-        .O(\Not_Dual.gpio_Data_Out[0]_i_3_n_0 ));
-  (* SOFT_HLUTNM = "soft_lutpair0" *) 
-  LUT5 #(
-    .INIT(32'hFFEF0020)) 
-    \Not_Dual.gpio_OE[0]_i_1 
-       (.I0(DBus_Reg),
-        .I1(\Not_Dual.gpio_Data_Out[0]_i_3_n_0 ),
-        .I2(\bus2ip_addr_i_reg[8] [0]),
-        .I3(\bus2ip_addr_i_reg[8] [1]),
-        .I4(gpio_io_t),
-        .O(\Not_Dual.gpio_OE_reg[0] ));
-  LUT6 #(
-    .INIT(64'hAAAAAAAAAAAEAAAA)) 
-    s_axi_arready_INST_0
-       (.I0(ip2bus_rdack_i_D1),
-        .I1(is_read_reg),
-        .I2(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [2]),
-        .I3(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [1]),
-        .I4(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [3]),
-        .I5(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [0]),
-        .O(s_axi_arready));
-  LUT6 #(
-    .INIT(64'hAAAAAAAAAAAEAAAA)) 
-    s_axi_wready_INST_0
-       (.I0(ip2bus_wrack_i_D1),
-        .I1(is_write_reg),
-        .I2(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [2]),
-        .I3(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [1]),
-        .I4(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [3]),
-        .I5(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] [0]),
-        .O(s_axi_wready));
-endmodule
-
-(* C_ALL_INPUTS = "0" *) (* C_ALL_INPUTS_2 = "0" *) (* C_ALL_OUTPUTS = "1" *) 
-(* C_ALL_OUTPUTS_2 = "0" *) (* C_DOUT_DEFAULT = "0" *) (* C_DOUT_DEFAULT_2 = "0" *) 
-(* C_FAMILY = "artix7" *) (* C_GPIO2_WIDTH = "32" *) (* C_GPIO_WIDTH = "1" *) 
-(* C_INTERRUPT_PRESENT = "0" *) (* C_IS_DUAL = "0" *) (* C_S_AXI_ADDR_WIDTH = "9" *) 
-(* C_S_AXI_DATA_WIDTH = "32" *) (* C_TRI_DEFAULT = "-1" *) (* C_TRI_DEFAULT_2 = "-1" *) 
-(* ORIG_REF_NAME = "axi_gpio" *) (* downgradeipidentifiedwarnings = "yes" *) (* ip_group = "LOGICORE" *) 
-module design_1_axi_gpio_1_0_axi_gpio
-   (s_axi_aclk,
-    s_axi_aresetn,
-    s_axi_awaddr,
-    s_axi_awvalid,
-    s_axi_awready,
-    s_axi_wdata,
-    s_axi_wstrb,
-    s_axi_wvalid,
-    s_axi_wready,
-    s_axi_bresp,
-    s_axi_bvalid,
-    s_axi_bready,
-    s_axi_araddr,
-    s_axi_arvalid,
-    s_axi_arready,
-    s_axi_rdata,
-    s_axi_rresp,
-    s_axi_rvalid,
-    s_axi_rready,
-    ip2intc_irpt,
-    gpio_io_i,
-    gpio_io_o,
-    gpio_io_t,
-    gpio2_io_i,
-    gpio2_io_o,
-    gpio2_io_t);
-  (* max_fanout = "10000" *) (* sigis = "Clk" *) input s_axi_aclk;
-  (* max_fanout = "10000" *) (* sigis = "Rst" *) input s_axi_aresetn;
-  input [8:0]s_axi_awaddr;
-  input s_axi_awvalid;
-  output s_axi_awready;
-  input [31:0]s_axi_wdata;
-  input [3:0]s_axi_wstrb;
-  input s_axi_wvalid;
-  output s_axi_wready;
-  output [1:0]s_axi_bresp;
-  output s_axi_bvalid;
-  input s_axi_bready;
-  input [8:0]s_axi_araddr;
-  input s_axi_arvalid;
-  output s_axi_arready;
-  output [31:0]s_axi_rdata;
-  output [1:0]s_axi_rresp;
-  output s_axi_rvalid;
-  input s_axi_rready;
-  (* sigis = "INTR_LEVEL_HIGH" *) output ip2intc_irpt;
-  input [0:0]gpio_io_i;
-  output [0:0]gpio_io_o;
-  output [0:0]gpio_io_t;
-  input [31:0]gpio2_io_i;
-  output [31:0]gpio2_io_o;
-  output [31:0]gpio2_io_t;
-
-  wire \<const0> ;
-  wire \<const1> ;
-  wire AXI_LITE_IPIF_I_n_12;
-  wire AXI_LITE_IPIF_I_n_13;
-  wire \I_SLAVE_ATTACHMENT/I_DECODER/Bus_RNW_reg ;
-  wire \I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  wire \I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  wire \I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  wire \I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  wire \I_SLAVE_ATTACHMENT/rst ;
-  wire bus2ip_cs;
-  wire bus2ip_rnw;
-  wire [0:0]gpio_io_o;
-  wire [0:0]gpio_io_t;
-  wire [0:31]ip2bus_data;
-  wire [0:31]ip2bus_data_i_D1;
-  wire ip2bus_rdack_i;
-  wire ip2bus_rdack_i_D1;
-  wire ip2bus_wrack_i;
-  wire ip2bus_wrack_i_D1;
-  (* MAX_FANOUT = "10000" *) (* RTL_MAX_FANOUT = "found" *) (* sigis = "Clk" *) wire s_axi_aclk;
-  wire [8:0]s_axi_araddr;
-  (* MAX_FANOUT = "10000" *) (* RTL_MAX_FANOUT = "found" *) (* sigis = "Rst" *) wire s_axi_aresetn;
-  wire s_axi_arready;
-  wire s_axi_arvalid;
-  wire [8:0]s_axi_awaddr;
-  wire s_axi_awvalid;
-  wire s_axi_bready;
-  wire s_axi_bvalid;
-  wire [30:0]\^s_axi_rdata ;
-  wire s_axi_rready;
-  wire s_axi_rvalid;
-  wire [31:0]s_axi_wdata;
-  wire s_axi_wready;
-  wire s_axi_wvalid;
-
-  assign gpio2_io_o[31] = \<const0> ;
-  assign gpio2_io_o[30] = \<const0> ;
-  assign gpio2_io_o[29] = \<const0> ;
-  assign gpio2_io_o[28] = \<const0> ;
-  assign gpio2_io_o[27] = \<const0> ;
-  assign gpio2_io_o[26] = \<const0> ;
-  assign gpio2_io_o[25] = \<const0> ;
-  assign gpio2_io_o[24] = \<const0> ;
-  assign gpio2_io_o[23] = \<const0> ;
-  assign gpio2_io_o[22] = \<const0> ;
-  assign gpio2_io_o[21] = \<const0> ;
-  assign gpio2_io_o[20] = \<const0> ;
-  assign gpio2_io_o[19] = \<const0> ;
-  assign gpio2_io_o[18] = \<const0> ;
-  assign gpio2_io_o[17] = \<const0> ;
-  assign gpio2_io_o[16] = \<const0> ;
-  assign gpio2_io_o[15] = \<const0> ;
-  assign gpio2_io_o[14] = \<const0> ;
-  assign gpio2_io_o[13] = \<const0> ;
-  assign gpio2_io_o[12] = \<const0> ;
-  assign gpio2_io_o[11] = \<const0> ;
-  assign gpio2_io_o[10] = \<const0> ;
-  assign gpio2_io_o[9] = \<const0> ;
-  assign gpio2_io_o[8] = \<const0> ;
-  assign gpio2_io_o[7] = \<const0> ;
-  assign gpio2_io_o[6] = \<const0> ;
-  assign gpio2_io_o[5] = \<const0> ;
-  assign gpio2_io_o[4] = \<const0> ;
-  assign gpio2_io_o[3] = \<const0> ;
-  assign gpio2_io_o[2] = \<const0> ;
-  assign gpio2_io_o[1] = \<const0> ;
-  assign gpio2_io_o[0] = \<const0> ;
-  assign gpio2_io_t[31] = \<const1> ;
-  assign gpio2_io_t[30] = \<const1> ;
-  assign gpio2_io_t[29] = \<const1> ;
-  assign gpio2_io_t[28] = \<const1> ;
-  assign gpio2_io_t[27] = \<const1> ;
-  assign gpio2_io_t[26] = \<const1> ;
-  assign gpio2_io_t[25] = \<const1> ;
-  assign gpio2_io_t[24] = \<const1> ;
-  assign gpio2_io_t[23] = \<const1> ;
-  assign gpio2_io_t[22] = \<const1> ;
-  assign gpio2_io_t[21] = \<const1> ;
-  assign gpio2_io_t[20] = \<const1> ;
-  assign gpio2_io_t[19] = \<const1> ;
-  assign gpio2_io_t[18] = \<const1> ;
-  assign gpio2_io_t[17] = \<const1> ;
-  assign gpio2_io_t[16] = \<const1> ;
-  assign gpio2_io_t[15] = \<const1> ;
-  assign gpio2_io_t[14] = \<const1> ;
-  assign gpio2_io_t[13] = \<const1> ;
-  assign gpio2_io_t[12] = \<const1> ;
-  assign gpio2_io_t[11] = \<const1> ;
-  assign gpio2_io_t[10] = \<const1> ;
-  assign gpio2_io_t[9] = \<const1> ;
-  assign gpio2_io_t[8] = \<const1> ;
-  assign gpio2_io_t[7] = \<const1> ;
-  assign gpio2_io_t[6] = \<const1> ;
-  assign gpio2_io_t[5] = \<const1> ;
-  assign gpio2_io_t[4] = \<const1> ;
-  assign gpio2_io_t[3] = \<const1> ;
-  assign gpio2_io_t[2] = \<const1> ;
-  assign gpio2_io_t[1] = \<const1> ;
-  assign gpio2_io_t[0] = \<const1> ;
-  assign ip2intc_irpt = \<const0> ;
-  assign s_axi_awready = s_axi_wready;
-  assign s_axi_bresp[1] = \<const0> ;
-  assign s_axi_bresp[0] = \<const0> ;
-  assign s_axi_rdata[31] = \^s_axi_rdata [30];
-  assign s_axi_rdata[30] = \^s_axi_rdata [30];
-  assign s_axi_rdata[29] = \^s_axi_rdata [30];
-  assign s_axi_rdata[28] = \^s_axi_rdata [30];
-  assign s_axi_rdata[27] = \^s_axi_rdata [30];
-  assign s_axi_rdata[26] = \^s_axi_rdata [30];
-  assign s_axi_rdata[25] = \^s_axi_rdata [30];
-  assign s_axi_rdata[24] = \^s_axi_rdata [30];
-  assign s_axi_rdata[23] = \^s_axi_rdata [30];
-  assign s_axi_rdata[22] = \^s_axi_rdata [30];
-  assign s_axi_rdata[21] = \^s_axi_rdata [30];
-  assign s_axi_rdata[20] = \^s_axi_rdata [30];
-  assign s_axi_rdata[19] = \^s_axi_rdata [30];
-  assign s_axi_rdata[18] = \^s_axi_rdata [30];
-  assign s_axi_rdata[17] = \^s_axi_rdata [30];
-  assign s_axi_rdata[16] = \^s_axi_rdata [30];
-  assign s_axi_rdata[15] = \^s_axi_rdata [30];
-  assign s_axi_rdata[14] = \^s_axi_rdata [30];
-  assign s_axi_rdata[13] = \^s_axi_rdata [30];
-  assign s_axi_rdata[12] = \^s_axi_rdata [30];
-  assign s_axi_rdata[11] = \^s_axi_rdata [30];
-  assign s_axi_rdata[10] = \^s_axi_rdata [30];
-  assign s_axi_rdata[9] = \^s_axi_rdata [30];
-  assign s_axi_rdata[8] = \^s_axi_rdata [30];
-  assign s_axi_rdata[7] = \^s_axi_rdata [30];
-  assign s_axi_rdata[6] = \^s_axi_rdata [30];
-  assign s_axi_rdata[5] = \^s_axi_rdata [30];
-  assign s_axi_rdata[4] = \^s_axi_rdata [30];
-  assign s_axi_rdata[3] = \^s_axi_rdata [30];
-  assign s_axi_rdata[2] = \^s_axi_rdata [30];
-  assign s_axi_rdata[1] = \^s_axi_rdata [30];
-  assign s_axi_rdata[0] = \^s_axi_rdata [0];
-  assign s_axi_rresp[1] = \<const0> ;
-  assign s_axi_rresp[0] = \<const0> ;
-  design_1_axi_gpio_1_0_axi_lite_ipif AXI_LITE_IPIF_I
-       (.Bus_RNW_reg(\I_SLAVE_ATTACHMENT/I_DECODER/Bus_RNW_reg ),
-        .\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .\Not_Dual.gpio_Data_Out_reg[0] (AXI_LITE_IPIF_I_n_12),
-        .\Not_Dual.gpio_OE_reg[0] (AXI_LITE_IPIF_I_n_13),
-        .Q({ip2bus_data_i_D1[0],ip2bus_data_i_D1[31]}),
-        .bus2ip_cs(bus2ip_cs),
-        .bus2ip_rnw(bus2ip_rnw),
-        .gpio_io_o(gpio_io_o),
-        .gpio_io_t(gpio_io_t),
-        .ip2bus_rdack_i_D1(ip2bus_rdack_i_D1),
-        .ip2bus_wrack_i_D1(ip2bus_wrack_i_D1),
-        .rst(\I_SLAVE_ATTACHMENT/rst ),
-        .s_axi_aclk(s_axi_aclk),
-        .s_axi_araddr({s_axi_araddr[8],s_axi_araddr[3:2]}),
-        .s_axi_aresetn(s_axi_aresetn),
-        .s_axi_arready(s_axi_arready),
-        .s_axi_arvalid(s_axi_arvalid),
-        .s_axi_awaddr({s_axi_awaddr[8],s_axi_awaddr[3:2]}),
-        .s_axi_awvalid(s_axi_awvalid),
-        .s_axi_bready(s_axi_bready),
-        .s_axi_bvalid(s_axi_bvalid),
-        .s_axi_rdata({\^s_axi_rdata [30],\^s_axi_rdata [0]}),
-        .s_axi_rready(s_axi_rready),
-        .s_axi_rvalid(s_axi_rvalid),
-        .s_axi_wdata({s_axi_wdata[31],s_axi_wdata[0]}),
-        .s_axi_wready(s_axi_wready),
-        .s_axi_wvalid(s_axi_wvalid));
-  GND GND
-       (.G(\<const0> ));
-  VCC VCC
-       (.P(\<const1> ));
-  design_1_axi_gpio_1_0_GPIO_Core gpio_core_1
-       (.Bus_RNW_reg(\I_SLAVE_ATTACHMENT/I_DECODER/Bus_RNW_reg ),
-        .D({ip2bus_data[0],ip2bus_data[31]}),
-        .\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg (\I_SLAVE_ATTACHMENT/I_DECODER/GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .\bus2ip_addr_i_reg[2] (AXI_LITE_IPIF_I_n_12),
-        .\bus2ip_addr_i_reg[2]_0 (AXI_LITE_IPIF_I_n_13),
-        .bus2ip_cs(bus2ip_cs),
-        .bus2ip_rnw(bus2ip_rnw),
-        .gpio_io_o(gpio_io_o),
-        .gpio_io_t(gpio_io_t),
-        .ip2bus_rdack_i(ip2bus_rdack_i),
-        .ip2bus_wrack_i(ip2bus_wrack_i),
-        .rst(\I_SLAVE_ATTACHMENT/rst ),
-        .s_axi_aclk(s_axi_aclk));
-  FDRE \ip2bus_data_i_D1_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(ip2bus_data[0]),
-        .Q(ip2bus_data_i_D1[0]),
-        .R(\I_SLAVE_ATTACHMENT/rst ));
-  FDRE \ip2bus_data_i_D1_reg[31] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(ip2bus_data[31]),
-        .Q(ip2bus_data_i_D1[31]),
-        .R(\I_SLAVE_ATTACHMENT/rst ));
-  FDRE ip2bus_rdack_i_D1_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(ip2bus_rdack_i),
-        .Q(ip2bus_rdack_i_D1),
-        .R(\I_SLAVE_ATTACHMENT/rst ));
-  FDRE ip2bus_wrack_i_D1_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(ip2bus_wrack_i),
-        .Q(ip2bus_wrack_i_D1),
-        .R(\I_SLAVE_ATTACHMENT/rst ));
-endmodule
-
-(* ORIG_REF_NAME = "axi_lite_ipif" *) 
-module design_1_axi_gpio_1_0_axi_lite_ipif
-   (rst,
-    \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ,
-    bus2ip_rnw,
-    Bus_RNW_reg,
-    s_axi_rvalid,
-    s_axi_bvalid,
-    bus2ip_cs,
-    s_axi_arready,
-    s_axi_wready,
-    \Not_Dual.gpio_Data_Out_reg[0] ,
-    \Not_Dual.gpio_OE_reg[0] ,
-    s_axi_rdata,
-    s_axi_aclk,
-    s_axi_arvalid,
-    s_axi_wdata,
-    s_axi_rready,
-    s_axi_bready,
-    gpio_io_o,
-    gpio_io_t,
-    s_axi_aresetn,
-    s_axi_awvalid,
-    s_axi_wvalid,
-    Q,
-    ip2bus_rdack_i_D1,
-    ip2bus_wrack_i_D1,
-    s_axi_araddr,
-    s_axi_awaddr);
-  output rst;
-  output \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  output bus2ip_rnw;
-  output Bus_RNW_reg;
-  output s_axi_rvalid;
-  output s_axi_bvalid;
-  output bus2ip_cs;
-  output s_axi_arready;
-  output s_axi_wready;
-  output \Not_Dual.gpio_Data_Out_reg[0] ;
-  output \Not_Dual.gpio_OE_reg[0] ;
-  output [1:0]s_axi_rdata;
-  input s_axi_aclk;
-  input s_axi_arvalid;
-  input [1:0]s_axi_wdata;
-  input s_axi_rready;
-  input s_axi_bready;
-  input [0:0]gpio_io_o;
-  input [0:0]gpio_io_t;
-  input s_axi_aresetn;
-  input s_axi_awvalid;
-  input s_axi_wvalid;
-  input [1:0]Q;
-  input ip2bus_rdack_i_D1;
-  input ip2bus_wrack_i_D1;
-  input [2:0]s_axi_araddr;
-  input [2:0]s_axi_awaddr;
-
-  wire Bus_RNW_reg;
-  wire \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  wire \Not_Dual.gpio_Data_Out_reg[0] ;
-  wire \Not_Dual.gpio_OE_reg[0] ;
-  wire [1:0]Q;
-  wire bus2ip_cs;
-  wire bus2ip_rnw;
-  wire [0:0]gpio_io_o;
-  wire [0:0]gpio_io_t;
-  wire ip2bus_rdack_i_D1;
-  wire ip2bus_wrack_i_D1;
-  wire rst;
-  wire s_axi_aclk;
-  wire [2:0]s_axi_araddr;
-  wire s_axi_aresetn;
-  wire s_axi_arready;
-  wire s_axi_arvalid;
-  wire [2:0]s_axi_awaddr;
-  wire s_axi_awvalid;
-  wire s_axi_bready;
-  wire s_axi_bvalid;
-  wire [1:0]s_axi_rdata;
-  wire s_axi_rready;
-  wire s_axi_rvalid;
-  wire [1:0]s_axi_wdata;
-  wire s_axi_wready;
-  wire s_axi_wvalid;
-
-  design_1_axi_gpio_1_0_slave_attachment I_SLAVE_ATTACHMENT
-       (.Bus_RNW_reg(Bus_RNW_reg),
-        .\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .\MEM_DECODE_GEN[0].cs_out_i_reg[0] (bus2ip_cs),
-        .\Not_Dual.gpio_Data_Out_reg[0] (\Not_Dual.gpio_Data_Out_reg[0] ),
-        .\Not_Dual.gpio_OE_reg[0] (\Not_Dual.gpio_OE_reg[0] ),
-        .Q(Q),
-        .SS(rst),
-        .bus2ip_rnw(bus2ip_rnw),
-        .gpio_io_o(gpio_io_o),
-        .gpio_io_t(gpio_io_t),
-        .ip2bus_rdack_i_D1(ip2bus_rdack_i_D1),
-        .ip2bus_wrack_i_D1(ip2bus_wrack_i_D1),
-        .s_axi_aclk(s_axi_aclk),
-        .s_axi_araddr(s_axi_araddr),
-        .s_axi_aresetn(s_axi_aresetn),
-        .s_axi_arready(s_axi_arready),
-        .s_axi_arvalid(s_axi_arvalid),
-        .s_axi_awaddr(s_axi_awaddr),
-        .s_axi_awvalid(s_axi_awvalid),
-        .s_axi_bready(s_axi_bready),
-        .s_axi_bvalid(s_axi_bvalid),
-        .s_axi_rdata(s_axi_rdata),
-        .s_axi_rready(s_axi_rready),
-        .s_axi_rvalid(s_axi_rvalid),
-        .s_axi_wdata(s_axi_wdata),
-        .s_axi_wready(s_axi_wready),
-        .s_axi_wvalid(s_axi_wvalid));
-endmodule
-
-(* ORIG_REF_NAME = "pselect_f" *) 
-module design_1_axi_gpio_1_0_pselect_f
-   (ce_expnd_i_3,
-    \bus2ip_addr_i_reg[3] );
-  output ce_expnd_i_3;
-  input [1:0]\bus2ip_addr_i_reg[3] ;
-
-  wire [1:0]\bus2ip_addr_i_reg[3] ;
-  wire ce_expnd_i_3;
-
-  LUT2 #(
-    .INIT(4'h1)) 
-    CS
-       (.I0(\bus2ip_addr_i_reg[3] [0]),
-        .I1(\bus2ip_addr_i_reg[3] [1]),
-        .O(ce_expnd_i_3));
-endmodule
-
-(* ORIG_REF_NAME = "pselect_f" *) 
-module design_1_axi_gpio_1_0_pselect_f__parameterized1
-   (ce_expnd_i_1,
-    \bus2ip_addr_i_reg[3] );
-  output ce_expnd_i_1;
-  input [1:0]\bus2ip_addr_i_reg[3] ;
-
-  wire [1:0]\bus2ip_addr_i_reg[3] ;
-  wire ce_expnd_i_1;
-
-  LUT2 #(
-    .INIT(4'h2)) 
-    CS
-       (.I0(\bus2ip_addr_i_reg[3] [1]),
-        .I1(\bus2ip_addr_i_reg[3] [0]),
-        .O(ce_expnd_i_1));
-endmodule
-
-(* ORIG_REF_NAME = "slave_attachment" *) 
-module design_1_axi_gpio_1_0_slave_attachment
-   (SS,
-    \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ,
-    \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ,
-    bus2ip_rnw,
-    Bus_RNW_reg,
-    s_axi_rvalid,
-    s_axi_bvalid,
-    \MEM_DECODE_GEN[0].cs_out_i_reg[0] ,
-    s_axi_arready,
-    s_axi_wready,
-    \Not_Dual.gpio_Data_Out_reg[0] ,
-    \Not_Dual.gpio_OE_reg[0] ,
-    s_axi_rdata,
-    s_axi_aclk,
-    s_axi_arvalid,
-    s_axi_wdata,
-    s_axi_rready,
-    s_axi_bready,
-    gpio_io_o,
-    gpio_io_t,
-    s_axi_aresetn,
-    s_axi_awvalid,
-    s_axi_wvalid,
-    Q,
-    ip2bus_rdack_i_D1,
-    ip2bus_wrack_i_D1,
-    s_axi_araddr,
-    s_axi_awaddr);
-  output [0:0]SS;
-  output \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  output \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  output bus2ip_rnw;
-  output Bus_RNW_reg;
-  output s_axi_rvalid;
-  output s_axi_bvalid;
-  output \MEM_DECODE_GEN[0].cs_out_i_reg[0] ;
-  output s_axi_arready;
-  output s_axi_wready;
-  output \Not_Dual.gpio_Data_Out_reg[0] ;
-  output \Not_Dual.gpio_OE_reg[0] ;
-  output [1:0]s_axi_rdata;
-  input s_axi_aclk;
-  input s_axi_arvalid;
-  input [1:0]s_axi_wdata;
-  input s_axi_rready;
-  input s_axi_bready;
-  input [0:0]gpio_io_o;
-  input [0:0]gpio_io_t;
-  input s_axi_aresetn;
-  input s_axi_awvalid;
-  input s_axi_wvalid;
-  input [1:0]Q;
-  input ip2bus_rdack_i_D1;
-  input ip2bus_wrack_i_D1;
-  input [2:0]s_axi_araddr;
-  input [2:0]s_axi_awaddr;
-
-  wire Bus_RNW_reg;
-  wire \FSM_onehot_state[0]_i_1_n_0 ;
-  wire \FSM_onehot_state[1]_i_1_n_0 ;
-  wire \FSM_onehot_state[2]_i_1_n_0 ;
-  wire \FSM_onehot_state[3]_i_1_n_0 ;
-  (* RTL_KEEP = "yes" *) wire \FSM_onehot_state_reg_n_0_[0] ;
-  (* RTL_KEEP = "yes" *) wire \FSM_onehot_state_reg_n_0_[3] ;
-  wire \GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ;
-  wire \GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ;
-  wire [3:0]\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 ;
-  wire \MEM_DECODE_GEN[0].cs_out_i_reg[0] ;
-  wire \Not_Dual.gpio_Data_Out_reg[0] ;
-  wire \Not_Dual.gpio_OE_reg[0] ;
-  wire [1:0]Q;
-  wire [0:0]SS;
-  wire [0:6]bus2ip_addr;
-  wire \bus2ip_addr_i[2]_i_1_n_0 ;
-  wire \bus2ip_addr_i[3]_i_1_n_0 ;
-  wire \bus2ip_addr_i[8]_i_1_n_0 ;
-  wire \bus2ip_addr_i[8]_i_2_n_0 ;
-  wire bus2ip_rnw;
-  wire clear;
-  wire [0:0]gpio_io_o;
-  wire [0:0]gpio_io_t;
-  wire ip2bus_rdack_i_D1;
-  wire ip2bus_wrack_i_D1;
-  wire is_read_i_1_n_0;
-  wire is_read_reg_n_0;
-  wire is_write_i_1_n_0;
-  wire is_write_i_2_n_0;
-  wire is_write_reg_n_0;
-  wire [1:0]p_0_out;
-  wire p_1_in;
-  wire p_5_in;
-  wire [3:0]plusOp;
-  wire s_axi_aclk;
-  wire [2:0]s_axi_araddr;
-  wire s_axi_aresetn;
-  wire s_axi_arready;
-  wire s_axi_arvalid;
-  wire [2:0]s_axi_awaddr;
-  wire s_axi_awvalid;
-  wire s_axi_bready;
-  (* RTL_KEEP = "yes" *) wire s_axi_bresp_i;
-  wire s_axi_bvalid;
-  wire s_axi_bvalid_i_i_1_n_0;
-  wire [1:0]s_axi_rdata;
-  wire \s_axi_rdata_i[0]_i_1_n_0 ;
-  wire \s_axi_rdata_i[31]_i_1_n_0 ;
-  wire s_axi_rready;
-  (* RTL_KEEP = "yes" *) wire s_axi_rresp_i;
-  wire s_axi_rvalid;
-  wire s_axi_rvalid_i_i_1_n_0;
-  wire [1:0]s_axi_wdata;
-  wire s_axi_wready;
-  wire s_axi_wvalid;
-  wire start2;
-  wire start2_i_1_n_0;
-  wire [1:0]state;
-  wire state1__2;
-
-  LUT6 #(
-    .INIT(64'hFFFF150015001500)) 
-    \FSM_onehot_state[0]_i_1 
-       (.I0(s_axi_arvalid),
-        .I1(s_axi_wvalid),
-        .I2(s_axi_awvalid),
-        .I3(\FSM_onehot_state_reg_n_0_[0] ),
-        .I4(state1__2),
-        .I5(\FSM_onehot_state_reg_n_0_[3] ),
-        .O(\FSM_onehot_state[0]_i_1_n_0 ));
-  LUT4 #(
-    .INIT(16'h8F88)) 
-    \FSM_onehot_state[1]_i_1 
-       (.I0(s_axi_arvalid),
-        .I1(\FSM_onehot_state_reg_n_0_[0] ),
-        .I2(s_axi_arready),
-        .I3(s_axi_rresp_i),
-        .O(\FSM_onehot_state[1]_i_1_n_0 ));
-  LUT6 #(
-    .INIT(64'h0800FFFF08000800)) 
-    \FSM_onehot_state[2]_i_1 
-       (.I0(s_axi_wvalid),
-        .I1(s_axi_awvalid),
-        .I2(s_axi_arvalid),
-        .I3(\FSM_onehot_state_reg_n_0_[0] ),
-        .I4(s_axi_wready),
-        .I5(s_axi_bresp_i),
-        .O(\FSM_onehot_state[2]_i_1_n_0 ));
-  LUT6 #(
-    .INIT(64'hF888F888FFFFF888)) 
-    \FSM_onehot_state[3]_i_1 
-       (.I0(s_axi_wready),
-        .I1(s_axi_bresp_i),
-        .I2(s_axi_rresp_i),
-        .I3(s_axi_arready),
-        .I4(\FSM_onehot_state_reg_n_0_[3] ),
-        .I5(state1__2),
-        .O(\FSM_onehot_state[3]_i_1_n_0 ));
-  LUT4 #(
-    .INIT(16'hF888)) 
-    \FSM_onehot_state[3]_i_2 
-       (.I0(s_axi_bready),
-        .I1(s_axi_bvalid),
-        .I2(s_axi_rready),
-        .I3(s_axi_rvalid),
-        .O(state1__2));
-  (* FSM_ENCODED_STATES = "iSTATE:0010,iSTATE0:0100,iSTATE1:1000,iSTATE2:0001" *) 
-  (* KEEP = "yes" *) 
-  FDSE #(
-    .INIT(1'b1)) 
-    \FSM_onehot_state_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\FSM_onehot_state[0]_i_1_n_0 ),
-        .Q(\FSM_onehot_state_reg_n_0_[0] ),
-        .S(SS));
-  (* FSM_ENCODED_STATES = "iSTATE:0010,iSTATE0:0100,iSTATE1:1000,iSTATE2:0001" *) 
-  (* KEEP = "yes" *) 
-  FDRE #(
-    .INIT(1'b0)) 
-    \FSM_onehot_state_reg[1] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\FSM_onehot_state[1]_i_1_n_0 ),
-        .Q(s_axi_rresp_i),
-        .R(SS));
-  (* FSM_ENCODED_STATES = "iSTATE:0010,iSTATE0:0100,iSTATE1:1000,iSTATE2:0001" *) 
-  (* KEEP = "yes" *) 
-  FDRE #(
-    .INIT(1'b0)) 
-    \FSM_onehot_state_reg[2] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\FSM_onehot_state[2]_i_1_n_0 ),
-        .Q(s_axi_bresp_i),
-        .R(SS));
-  (* FSM_ENCODED_STATES = "iSTATE:0010,iSTATE0:0100,iSTATE1:1000,iSTATE2:0001" *) 
-  (* KEEP = "yes" *) 
-  FDRE #(
-    .INIT(1'b0)) 
-    \FSM_onehot_state_reg[3] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\FSM_onehot_state[3]_i_1_n_0 ),
-        .Q(\FSM_onehot_state_reg_n_0_[3] ),
-        .R(SS));
-  (* SOFT_HLUTNM = "soft_lutpair6" *) 
-  LUT1 #(
-    .INIT(2'h1)) 
-    \INCLUDE_DPHASE_TIMER.dpto_cnt[0]_i_1 
-       (.I0(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [0]),
-        .O(plusOp[0]));
-  (* SOFT_HLUTNM = "soft_lutpair6" *) 
-  LUT2 #(
-    .INIT(4'h6)) 
-    \INCLUDE_DPHASE_TIMER.dpto_cnt[1]_i_1 
-       (.I0(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [0]),
-        .I1(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [1]),
-        .O(plusOp[1]));
-  (* SOFT_HLUTNM = "soft_lutpair4" *) 
-  LUT3 #(
-    .INIT(8'h78)) 
-    \INCLUDE_DPHASE_TIMER.dpto_cnt[2]_i_1 
-       (.I0(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [0]),
-        .I1(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [1]),
-        .I2(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [2]),
-        .O(plusOp[2]));
-  LUT2 #(
-    .INIT(4'h9)) 
-    \INCLUDE_DPHASE_TIMER.dpto_cnt[3]_i_1 
-       (.I0(state[0]),
-        .I1(state[1]),
-        .O(clear));
-  (* SOFT_HLUTNM = "soft_lutpair4" *) 
-  LUT4 #(
-    .INIT(16'h7F80)) 
-    \INCLUDE_DPHASE_TIMER.dpto_cnt[3]_i_2 
-       (.I0(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [1]),
-        .I1(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [0]),
-        .I2(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [2]),
-        .I3(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [3]),
-        .O(plusOp[3]));
-  FDRE \INCLUDE_DPHASE_TIMER.dpto_cnt_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(plusOp[0]),
-        .Q(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [0]),
-        .R(clear));
-  FDRE \INCLUDE_DPHASE_TIMER.dpto_cnt_reg[1] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(plusOp[1]),
-        .Q(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [1]),
-        .R(clear));
-  FDRE \INCLUDE_DPHASE_TIMER.dpto_cnt_reg[2] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(plusOp[2]),
-        .Q(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [2]),
-        .R(clear));
-  FDRE \INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(plusOp[3]),
-        .Q(\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 [3]),
-        .R(clear));
-  design_1_axi_gpio_1_0_address_decoder I_DECODER
-       (.Bus_RNW_reg(Bus_RNW_reg),
-        .\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[0].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[1].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[2].ce_out_i_reg ),
-        .\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg (\GEN_BKEND_CE_REGISTERS[3].ce_out_i_reg ),
-        .\INCLUDE_DPHASE_TIMER.dpto_cnt_reg[3] (\INCLUDE_DPHASE_TIMER.dpto_cnt_reg__0 ),
-        .\MEM_DECODE_GEN[0].cs_out_i_reg[0]_0 (\MEM_DECODE_GEN[0].cs_out_i_reg[0] ),
-        .\Not_Dual.gpio_Data_Out_reg[0] (\Not_Dual.gpio_Data_Out_reg[0] ),
-        .\Not_Dual.gpio_OE_reg[0] (\Not_Dual.gpio_OE_reg[0] ),
-        .Q(start2),
-        .\bus2ip_addr_i_reg[8] ({bus2ip_addr[0],bus2ip_addr[5],bus2ip_addr[6]}),
-        .bus2ip_rnw(bus2ip_rnw),
-        .gpio_io_o(gpio_io_o),
-        .gpio_io_t(gpio_io_t),
-        .ip2bus_rdack_i_D1(ip2bus_rdack_i_D1),
-        .ip2bus_wrack_i_D1(ip2bus_wrack_i_D1),
-        .is_read_reg(is_read_reg_n_0),
-        .is_write_reg(is_write_reg_n_0),
-        .s_axi_aclk(s_axi_aclk),
-        .s_axi_aresetn(s_axi_aresetn),
-        .s_axi_arready(s_axi_arready),
-        .s_axi_wdata(s_axi_wdata),
-        .s_axi_wready(s_axi_wready));
-  (* SOFT_HLUTNM = "soft_lutpair5" *) 
-  LUT3 #(
-    .INIT(8'hAC)) 
-    \bus2ip_addr_i[2]_i_1 
-       (.I0(s_axi_araddr[0]),
-        .I1(s_axi_awaddr[0]),
-        .I2(s_axi_arvalid),
-        .O(\bus2ip_addr_i[2]_i_1_n_0 ));
-  LUT3 #(
-    .INIT(8'hAC)) 
-    \bus2ip_addr_i[3]_i_1 
-       (.I0(s_axi_araddr[1]),
-        .I1(s_axi_awaddr[1]),
-        .I2(s_axi_arvalid),
-        .O(\bus2ip_addr_i[3]_i_1_n_0 ));
-  LUT5 #(
-    .INIT(32'h000000EA)) 
-    \bus2ip_addr_i[8]_i_1 
-       (.I0(s_axi_arvalid),
-        .I1(s_axi_awvalid),
-        .I2(s_axi_wvalid),
-        .I3(state[1]),
-        .I4(state[0]),
-        .O(\bus2ip_addr_i[8]_i_1_n_0 ));
-  (* SOFT_HLUTNM = "soft_lutpair5" *) 
-  LUT3 #(
-    .INIT(8'hAC)) 
-    \bus2ip_addr_i[8]_i_2 
-       (.I0(s_axi_araddr[2]),
-        .I1(s_axi_awaddr[2]),
-        .I2(s_axi_arvalid),
-        .O(\bus2ip_addr_i[8]_i_2_n_0 ));
-  FDRE \bus2ip_addr_i_reg[2] 
-       (.C(s_axi_aclk),
-        .CE(\bus2ip_addr_i[8]_i_1_n_0 ),
-        .D(\bus2ip_addr_i[2]_i_1_n_0 ),
-        .Q(bus2ip_addr[6]),
-        .R(SS));
-  FDRE \bus2ip_addr_i_reg[3] 
-       (.C(s_axi_aclk),
-        .CE(\bus2ip_addr_i[8]_i_1_n_0 ),
-        .D(\bus2ip_addr_i[3]_i_1_n_0 ),
-        .Q(bus2ip_addr[5]),
-        .R(SS));
-  FDRE \bus2ip_addr_i_reg[8] 
-       (.C(s_axi_aclk),
-        .CE(\bus2ip_addr_i[8]_i_1_n_0 ),
-        .D(\bus2ip_addr_i[8]_i_2_n_0 ),
-        .Q(bus2ip_addr[0]),
-        .R(SS));
-  FDRE bus2ip_rnw_i_reg
-       (.C(s_axi_aclk),
-        .CE(\bus2ip_addr_i[8]_i_1_n_0 ),
-        .D(s_axi_arvalid),
-        .Q(bus2ip_rnw),
-        .R(SS));
-  LUT5 #(
-    .INIT(32'h8BBB8888)) 
-    is_read_i_1
-       (.I0(s_axi_arvalid),
-        .I1(\FSM_onehot_state_reg_n_0_[0] ),
-        .I2(state1__2),
-        .I3(\FSM_onehot_state_reg_n_0_[3] ),
-        .I4(is_read_reg_n_0),
-        .O(is_read_i_1_n_0));
-  FDRE is_read_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(is_read_i_1_n_0),
-        .Q(is_read_reg_n_0),
-        .R(SS));
-  LUT6 #(
-    .INIT(64'h2000FFFF20000000)) 
-    is_write_i_1
-       (.I0(\FSM_onehot_state_reg_n_0_[0] ),
-        .I1(s_axi_arvalid),
-        .I2(s_axi_awvalid),
-        .I3(s_axi_wvalid),
-        .I4(is_write_i_2_n_0),
-        .I5(is_write_reg_n_0),
-        .O(is_write_i_1_n_0));
-  LUT6 #(
-    .INIT(64'hFFEAEAEAAAAAAAAA)) 
-    is_write_i_2
-       (.I0(\FSM_onehot_state_reg_n_0_[0] ),
-        .I1(s_axi_bready),
-        .I2(s_axi_bvalid),
-        .I3(s_axi_rready),
-        .I4(s_axi_rvalid),
-        .I5(\FSM_onehot_state_reg_n_0_[3] ),
-        .O(is_write_i_2_n_0));
-  FDRE is_write_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(is_write_i_1_n_0),
-        .Q(is_write_reg_n_0),
-        .R(SS));
-  LUT1 #(
-    .INIT(2'h1)) 
-    rst_i_1
-       (.I0(s_axi_aresetn),
-        .O(p_1_in));
-  FDRE rst_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(p_1_in),
-        .Q(SS),
-        .R(1'b0));
-  LUT5 #(
-    .INIT(32'h08FF0808)) 
-    s_axi_bvalid_i_i_1
-       (.I0(s_axi_wready),
-        .I1(state[1]),
-        .I2(state[0]),
-        .I3(s_axi_bready),
-        .I4(s_axi_bvalid),
-        .O(s_axi_bvalid_i_i_1_n_0));
-  FDRE #(
-    .INIT(1'b0)) 
-    s_axi_bvalid_i_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(s_axi_bvalid_i_i_1_n_0),
-        .Q(s_axi_bvalid),
-        .R(SS));
-  LUT4 #(
-    .INIT(16'h00E2)) 
-    \s_axi_rdata_i[0]_i_1 
-       (.I0(s_axi_rdata[0]),
-        .I1(s_axi_rresp_i),
-        .I2(Q[0]),
-        .I3(SS),
-        .O(\s_axi_rdata_i[0]_i_1_n_0 ));
-  LUT4 #(
-    .INIT(16'h00E2)) 
-    \s_axi_rdata_i[31]_i_1 
-       (.I0(s_axi_rdata[1]),
-        .I1(s_axi_rresp_i),
-        .I2(Q[1]),
-        .I3(SS),
-        .O(\s_axi_rdata_i[31]_i_1_n_0 ));
-  FDRE #(
-    .INIT(1'b0)) 
-    \s_axi_rdata_i_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\s_axi_rdata_i[0]_i_1_n_0 ),
-        .Q(s_axi_rdata[0]),
-        .R(1'b0));
-  FDRE #(
-    .INIT(1'b0)) 
-    \s_axi_rdata_i_reg[31] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(\s_axi_rdata_i[31]_i_1_n_0 ),
-        .Q(s_axi_rdata[1]),
-        .R(1'b0));
-  LUT5 #(
-    .INIT(32'h08FF0808)) 
-    s_axi_rvalid_i_i_1
-       (.I0(s_axi_arready),
-        .I1(state[0]),
-        .I2(state[1]),
-        .I3(s_axi_rready),
-        .I4(s_axi_rvalid),
-        .O(s_axi_rvalid_i_i_1_n_0));
-  FDRE #(
-    .INIT(1'b0)) 
-    s_axi_rvalid_i_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(s_axi_rvalid_i_i_1_n_0),
-        .Q(s_axi_rvalid),
-        .R(SS));
-  (* SOFT_HLUTNM = "soft_lutpair3" *) 
-  LUT5 #(
-    .INIT(32'h000000F8)) 
-    start2_i_1
-       (.I0(s_axi_awvalid),
-        .I1(s_axi_wvalid),
-        .I2(s_axi_arvalid),
-        .I3(state[1]),
-        .I4(state[0]),
-        .O(start2_i_1_n_0));
-  FDRE start2_reg
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(start2_i_1_n_0),
-        .Q(start2),
-        .R(SS));
-  LUT5 #(
-    .INIT(32'h77FC44FC)) 
-    \state[0]_i_1 
-       (.I0(state1__2),
-        .I1(state[0]),
-        .I2(s_axi_arvalid),
-        .I3(state[1]),
-        .I4(s_axi_wready),
-        .O(p_0_out[0]));
-  LUT6 #(
-    .INIT(64'h55FFFF0C5500FF0C)) 
-    \state[1]_i_1 
-       (.I0(state1__2),
-        .I1(p_5_in),
-        .I2(s_axi_arvalid),
-        .I3(state[1]),
-        .I4(state[0]),
-        .I5(s_axi_arready),
-        .O(p_0_out[1]));
-  (* SOFT_HLUTNM = "soft_lutpair3" *) 
-  LUT2 #(
-    .INIT(4'h8)) 
-    \state[1]_i_2 
-       (.I0(s_axi_awvalid),
-        .I1(s_axi_wvalid),
-        .O(p_5_in));
-  FDRE \state_reg[0] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(p_0_out[0]),
-        .Q(state[0]),
-        .R(SS));
-  FDRE \state_reg[1] 
-       (.C(s_axi_aclk),
-        .CE(1'b1),
-        .D(p_0_out[1]),
-        .Q(state[1]),
-        .R(SS));
-endmodule
-`ifndef GLBL
-`define GLBL
-`timescale  1 ps / 1 ps
-
-module glbl ();
-
-    parameter ROC_WIDTH = 100000;
-    parameter TOC_WIDTH = 0;
-
-//--------   STARTUP Globals --------------
-    wire GSR;
-    wire GTS;
-    wire GWE;
-    wire PRLD;
-    tri1 p_up_tmp;
-    tri (weak1, strong0) PLL_LOCKG = p_up_tmp;
-
-    wire PROGB_GLBL;
-    wire CCLKO_GLBL;
-    wire FCSBO_GLBL;
-    wire [3:0] DO_GLBL;
-    wire [3:0] DI_GLBL;
-   
-    reg GSR_int;
-    reg GTS_int;
-    reg PRLD_int;
-
-//--------   JTAG Globals --------------
-    wire JTAG_TDO_GLBL;
-    wire JTAG_TCK_GLBL;
-    wire JTAG_TDI_GLBL;
-    wire JTAG_TMS_GLBL;
-    wire JTAG_TRST_GLBL;
-
-    reg JTAG_CAPTURE_GLBL;
-    reg JTAG_RESET_GLBL;
-    reg JTAG_SHIFT_GLBL;
-    reg JTAG_UPDATE_GLBL;
-    reg JTAG_RUNTEST_GLBL;
-
-    reg JTAG_SEL1_GLBL = 0;
-    reg JTAG_SEL2_GLBL = 0 ;
-    reg JTAG_SEL3_GLBL = 0;
-    reg JTAG_SEL4_GLBL = 0;
-
-    reg JTAG_USER_TDO1_GLBL = 1'bz;
-    reg JTAG_USER_TDO2_GLBL = 1'bz;
-    reg JTAG_USER_TDO3_GLBL = 1'bz;
-    reg JTAG_USER_TDO4_GLBL = 1'bz;
-
-    assign (strong1, weak0) GSR = GSR_int;
-    assign (strong1, weak0) GTS = GTS_int;
-    assign (weak1, weak0) PRLD = PRLD_int;
-
-    initial begin
-	GSR_int = 1'b1;
-	PRLD_int = 1'b1;
-	#(ROC_WIDTH)
-	GSR_int = 1'b0;
-	PRLD_int = 1'b0;
-    end
-
-    initial begin
-	GTS_int = 1'b1;
-	#(TOC_WIDTH)
-	GTS_int = 1'b0;
-    end
-
-endmodule
-`endif
@@ -0,0 +1,461 @@
+// -----------------------------------------------------------------------------
+//  AXI4-Lite frame-buffer slave
+//  memory-mapped CPU write port for vga_framebuffer_top, replaces the
+//  WE / ADDR / DAT GPIO triple
+// -----------------------------------------------------------------------------
+//  Register map (byte offsets, 32-bit accesses)
+//    0x00000  FB_ADDR   RW  pixel address used by FB_DATA / FB_DATA8
+//    0x00004  FB_DATA   W   store one pixel at FB_ADDR, FB_ADDR += 1
+//    0x00008  FB_DATA8  W   store eight pixels at FB_ADDR (multiple of 8)
+//                           through FB_MASK, FB_ADDR += 8
+//    0x0000C  FB_MASK   RW  per-pixel enable of FB_DATA8 (reset 0xFF)
+//    0x00010  FB_BLIT   W   queue one sprite_blitter command
+//                       R   bit 0: blitter busy, bit 1: FIFO full
+//    0x00014  OAM_DROP  R   object-layer entries dropped in the last frame
+//    0x00018  FB_FILL   W   queue one fill_engine job in FILL_COL: bits 7:0
+//                           x, 15:8 y, 23:16 w - 1, 31:24 h - 1
+//                       R   bit 0: fill engine busy, bit 1: FIFO full
+//    0x0001C  FILL_COL  RW  colour of the next FB_FILL jobs
+//    0x00020  CLEAR_COL RW  colour the back buffer is cleared to (reset 0)
+//    0x00024  LANE_ADDR RW  lane buffer group address {band, row, column / 8}
+//    0x00028  LANE_DATA8 W  store eight pixels at LANE_ADDR through FB_MASK,
+//                           LANE_ADDR += 1
+//    0x0002C  FB_SPAN   W   queue one fill_engine span: bits 15:0 pixel
+//                           address, 23:16 n - 1, 27:24 colour
+//    0x00030  CYCLES    R   free-running count of s_axi_aclk cycles, wraps
+//                           every 2^32 (57 s at 75 MHz); reset 0
+//    0x00034  VSYNCS    R   frame pulses since reset
+//    0x00038  SWAPS     R   buffer swaps since reset
+//    0x0003C  MISSED    R   frame pulses with no finished frame to show
+//                           while the CPU draws; each one shows the front
+//                           buffer again
+//    0x00040  DRAW_MAX  R   longest stay in S_DRAW, s_axi_aclk cycles
+//    0x00044  CLEAR_CLKS R  s_axi_aclk cycles spent in S_CLEAR since reset
+//                           VSYNCS..CLEAR_CLKS are the frame-pacing counts
+//                           of vga_framebuffer_top as of the last frame
+//                           pulse, updated together once a frame
+//    0x00048  IRQ_STATUS RW bit 0: frame_ready rose, bit 1: frame_ready
+//                           fell, bit 2: frame pulse; set on the event,
+//                           cleared by writing 1
+//    0x0004C  IRQ_ENABLE RW the IRQ_STATUS bits that raise irq (reset 0)
+//    0x00100  OAM       W   0x100 + 4*i writes OAM entry i (0..63) of the
+//                           bank that goes with the back buffer
+//    0x00200  PALETTE   W   0x200 + 4*i writes palette entry i (0..15),
+//                           RGB444 in bits 11:0, shown from the next
+//                           frame pulse
+//    0x00240  PAL_CYCLE W   0x240 + 4*k writes palette-cycle slot k: bits
+//                           3:0 first entry, 7:4 last, 15:8 frames per
+//                           step (0 = off), 16 direction (palette_regs.v)
+//    0x00400  TILES     W   0x400 + 4*i writes tilemap entry i (0..223,
+//                           ty * 14 + tx) of that bank, bits 3:0
+//    0x00800  SCROLL    W   0x800 + 4*b writes the lane_layer scroll register
+//                           of band b (0..15) of that bank
+//    0x40000  window    W   0x40000 + 4*idx stores one pixel at idx,
+//                           FB_ADDR is left alone
+//
+//  The whole offset is decoded. A write anywhere else (0x050..0x0FC,
+//  0x280..0x3FC, 0x780..0x7FC, 0x840..0x3FFFC) is completed with SLVERR and
+//  changes nothing; a read there returns 0 with SLVERR. Reads of the
+//  write-only tables and the window return 0 with OKAY.
+// -----------------------------------------------------------------------------
+//  The write side of vga_framebuffer_top runs on this clock, so pixel
+//  stores, FB_DATA8 and the blitter and fill commands are one-clock
+//  strobes, and only FB_DATA8 holds the next write back, for the 8 clocks
+//  the packed store takes. The object, tile, scroll and palette ports are
+//  on clk_pix: those stores are held as strobes long enough to be seen there,
+//  and the next write is stalled (AWREADY/WREADY low) for PIX_CLKS, until
+//  the layer has taken idx/dat on its synchronized write edge.
+//
+//  Pixel stores wait while the blitter or fill engine is busy, FB_BLIT while
+//  the blitter FIFO is full or a fill runs, and FB_FILL / FB_SPAN while its
+//  FIFO is full or a sprite is drawn, so all of them land in program order.
+//
+//  irq is high while an enabled IRQ_STATUS bit is set. Each event has its
+//  own bit, so a rise and a fall of frame_ready between two reads of the
+//  handler are both seen.
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module axi_fb_slave #(
+    parameter BPP          = 4,
+    parameter ADDR_WIDTH   = 19,
+    parameter STROBE_CLKS  = 4,    // clk_pix strobe high time, > 1 clk_pix period
+    parameter PIX_CLKS     = 28,   // clk_pix port busy time: strobe, 2FF and the
+                                   // write edge (<= 4 clk_pix) + margin
+    parameter WIDE_CLKS    = 8     // FB_DATA8 busy time: the packed store
+)(
+    input  wire                  s_axi_aclk,
+    input  wire                  s_axi_aresetn,
+
+    // AXI4-Lite slave ---------------------------------------------------------
+    input  wire [ADDR_WIDTH-1:0] s_axi_awaddr,
+    input  wire [2:0]            s_axi_awprot,
+    input  wire                  s_axi_awvalid,
+    output wire                  s_axi_awready,
+    input  wire [31:0]           s_axi_wdata,
+    input  wire [3:0]            s_axi_wstrb,
+    input  wire                  s_axi_wvalid,
+    output wire                  s_axi_wready,
+    output wire [1:0]            s_axi_bresp,
+    output reg                   s_axi_bvalid,
+    input  wire                  s_axi_bready,
+    input  wire [ADDR_WIDTH-1:0] s_axi_araddr,
+    input  wire [2:0]            s_axi_arprot,
+    input  wire                  s_axi_arvalid,
+    output wire                  s_axi_arready,
+    output reg  [31:0]           s_axi_rdata,
+    output wire [1:0]            s_axi_rresp,
+    output reg                   s_axi_rvalid,
+    input  wire                  s_axi_rready,
+
+    // to vga_framebuffer_top --------------------------------------------------
+    output reg                   cpu_we,
+    output reg  [15:0]           cpu_addr,
+    output reg  [BPP-1:0]        cpu_dat,
+    output reg                   cpu_we8,
+    output reg  [8*BPP-1:0]      cpu_dat8,
+    output reg  [7:0]            cpu_mask8,
+    output reg                   cpu_lane8,
+    output reg                   cpu_blit_we,
+    output reg  [31:0]           cpu_blit_cmd,
+    input  wire                  blit_busy,
+    input  wire                  blit_full,
+    output reg                   cpu_fill_we,
+    output reg  [36:0]           cpu_fill_cmd,
+    output reg  [BPP-1:0]        cpu_clear_col,
+    input  wire                  fill_busy,
+    input  wire                  fill_full,
+    output reg                   cpu_oam_we,
+    output reg  [5:0]            cpu_oam_idx,
+    output reg  [31:0]           cpu_oam_dat,
+    input  wire [15:0]           oam_dropped,  // clk_pix domain
+    input  wire [31:0]           stat_vsyncs,  // the five change together,
+    input  wire [31:0]           stat_swaps,   // once a frame
+    input  wire [31:0]           stat_missed,
+    input  wire [31:0]           stat_draw_max,
+    input  wire [31:0]           stat_clear_clks,
+    input  wire                  frame_ready,
+    (* X_INTERFACE_INFO = "xilinx.com:signal:interrupt:1.0 irq INTERRUPT" *)
+    (* X_INTERFACE_PARAMETER = "SENSITIVITY LEVEL_HIGH" *)
+    output wire                  irq,
+    output reg                   cpu_tile_we,
+    output reg  [7:0]            cpu_tile_idx,
+    output reg  [3:0]            cpu_tile_dat,
+    output reg                   cpu_scroll_we,
+    output reg  [3:0]            cpu_scroll_band,
+    output reg  [17:0]           cpu_scroll_dat,
+    output reg                   cpu_pal_we,
+    output reg  [4:0]            cpu_pal_idx,
+    output reg  [16:0]           cpu_pal_dat
+);
+
+    localparam R_ADDR  = 5'd0,
+               R_DATA  = 5'd1,
+               R_DATA8 = 5'd2,
+               R_MASK  = 5'd3,
+               R_BLIT  = 5'd4,
+               R_ODROP = 5'd5,
+               R_FILL  = 5'd6,
+               R_FILLC = 5'd7,
+               R_CLRC  = 5'd8,
+               R_LADDR = 5'd9,
+               R_LDAT8 = 5'd10,
+               R_SPAN  = 5'd11,
+               R_CYCLE = 5'd12,
+               R_VSYNC = 5'd13,
+               R_SWAPS = 5'd14,
+               R_MISS  = 5'd15,
+               R_DMAX  = 5'd16,
+               R_CLRCK = 5'd17,
+               R_IRQS  = 5'd18,
+               R_IRQE  = 5'd19;
+
+    localparam K_PIX   = 3'd0,     // kind of the store in progress
+               K_WIDE  = 3'd1,
+               K_BLIT  = 3'd2,
+               K_OAM   = 3'd3,
+               K_TILE  = 3'd4,
+               K_FILL  = 3'd5,
+               K_SCRL  = 3'd6,
+               K_PAL   = 3'd7;
+
+    reg [15:0] addr_reg;
+    reg [7:0]  mask_reg;
+    reg [3:0]  fill_col;
+    reg [13:0] lane_addr;
+    reg        busy;
+    reg        wr_err;     // last write missed the map
+    reg        rd_err;     // last read missed the map
+    reg [2:0]  kind;
+    reg [5:0]  cnt;
+    reg [31:0] cycles;
+    reg [2:0]  irq_status;
+    reg [2:0]  irq_enable;
+    reg        ready_q;
+    reg        vsync_q;
+
+    // oam_dropped only changes at the frame pulse; a read that lands on that
+    // clock may see a mix of the old and new count
+    reg [15:0] oam_dropped_s [0:1];
+    always @(posedge s_axi_aclk) begin
+        oam_dropped_s[0] <= oam_dropped;
+        oam_dropped_s[1] <= oam_dropped_s[0];
+    end
+
+    // -------------------------------------------------------------------------
+    //                              Write channel
+    // -------------------------------------------------------------------------
+    // Offsets below the window only use bits 11:2
+    wire window = s_axi_awaddr[ADDR_WIDTH-1];
+    wire low = ~window & (s_axi_awaddr[ADDR_WIDTH-2:12] == 0);
+    wire scroll_sel = low & (s_axi_awaddr[11:6] == 6'b100000);
+    wire tile_sel = low & (s_axi_awaddr[11:10] == 2'b01) & (s_axi_awaddr[9:2] < 8'd224);
+    wire pal_sel = low & (s_axi_awaddr[11:7] == 5'b00100);
+    wire oam_sel = low & (s_axi_awaddr[11:8] == 4'b0001);
+    wire [4:0] reg_sel = s_axi_awaddr[6:2];
+    wire reg_area = low & (s_axi_awaddr[11:7] == 5'd0) & (reg_sel <= R_IRQE);
+    wire mapped = window | scroll_sel | tile_sel | pal_sel | oam_sel | reg_area;
+    wire pix_store = window | (reg_area & ((reg_sel == R_DATA) | (reg_sel == R_DATA8)));
+    wire hold = (pix_store & (blit_busy | fill_busy)) |
+                (reg_area & (reg_sel == R_BLIT) & (blit_full | fill_busy)) |
+                (reg_area & ((reg_sel == R_FILL) | (reg_sel == R_SPAN)) &
+                 (fill_full | blit_busy));
+    wire accept = s_axi_awvalid & s_axi_wvalid & ~busy & ~s_axi_bvalid & ~hold;
+
+    assign s_axi_awready = accept;
+    assign s_axi_wready  = accept;
+    assign s_axi_bresp   = wr_err ? 2'b10 : 2'b00;     // SLVERR off the map
+
+    always @(posedge s_axi_aclk) begin
+        if (!s_axi_aresetn) begin
+            s_axi_bvalid <= 1'b0;
+            wr_err       <= 1'b0;
+            addr_reg     <= 16'd0;
+            mask_reg     <= 8'hFF;
+            fill_col     <= 4'd0;
+            lane_addr    <= 14'd0;
+            cpu_clear_col <= {BPP{1'b0}};
+            busy         <= 1'b0;
+            kind         <= K_PIX;
+            cnt          <= 6'd0;
+            cpu_we       <= 1'b0;
+            cpu_we8      <= 1'b0;
+            cpu_blit_we  <= 1'b0;
+            cpu_oam_we   <= 1'b0;
+            cpu_tile_we  <= 1'b0;
+            cpu_fill_we  <= 1'b0;
+            cpu_scroll_we <= 1'b0;
+            cpu_pal_we   <= 1'b0;
+            irq_enable   <= 3'd0;
+        end else begin
+            if (s_axi_bvalid & s_axi_bready)
+                s_axi_bvalid <= 1'b0;
+
+            if (accept) begin
+                s_axi_bvalid <= 1'b1;
+                wr_err       <= ~mapped;
+                cnt          <= 6'd0;
+
+                if (window) begin
+                    cpu_addr <= s_axi_awaddr[17:2];
+                    cpu_dat  <= s_axi_wdata[BPP-1:0];
+                    busy     <= 1'b1;
+                    kind     <= K_PIX;
+                end
+                else if (scroll_sel) begin
+                    cpu_scroll_band <= s_axi_awaddr[5:2];
+                    cpu_scroll_dat  <= s_axi_wdata[17:0];
+                    busy            <= 1'b1;
+                    kind            <= K_SCRL;
+                end
+                else if (tile_sel) begin
+                    cpu_tile_idx <= s_axi_awaddr[9:2];
+                    cpu_tile_dat <= s_axi_wdata[3:0];
+                    busy         <= 1'b1;
+                    kind         <= K_TILE;
+                end
+                else if (pal_sel) begin
+                    cpu_pal_idx <= s_axi_awaddr[6:2];
+                    cpu_pal_dat <= s_axi_wdata[16:0];
+                    busy        <= 1'b1;
+                    kind        <= K_PAL;
+                end
+                else if (oam_sel) begin
+                    cpu_oam_idx <= s_axi_awaddr[7:2];
+                    cpu_oam_dat <= s_axi_wdata;
+                    busy        <= 1'b1;
+                    kind        <= K_OAM;
+                end
+                else if (reg_area) case (reg_sel)
+                R_ADDR:  addr_reg <= s_axi_wdata[15:0];
+                R_DATA:  begin
+                            cpu_addr <= addr_reg;
+                            cpu_dat  <= s_axi_wdata[BPP-1:0];
+                            addr_reg <= addr_reg + 16'd1;
+                            busy     <= 1'b1;
+                            kind     <= K_PIX;
+                         end
+                R_DATA8: begin
+                            cpu_addr  <= {3'b000, addr_reg[15:3]};
+                            cpu_dat8  <= s_axi_wdata[8*BPP-1:0];
+                            cpu_mask8 <= mask_reg;
+                            cpu_lane8 <= 1'b0;
+                            addr_reg  <= addr_reg + 16'd8;
+                            busy      <= 1'b1;
+                            kind      <= K_WIDE;
+                         end
+                R_MASK:  mask_reg <= s_axi_wdata[7:0];
+                R_BLIT:  begin
+                            cpu_blit_cmd <= s_axi_wdata;
+                            busy         <= 1'b1;
+                            kind         <= K_BLIT;
+                         end
+                R_FILL:  begin
+                            cpu_fill_cmd <= {1'b0, fill_col, s_axi_wdata};
+                            busy         <= 1'b1;
+                            kind         <= K_FILL;
+                         end
+                R_SPAN:  begin
+                            cpu_fill_cmd <= {1'b1, s_axi_wdata[27:24], 8'd0,
+                                             s_axi_wdata[23:0]};
+                            busy         <= 1'b1;
+                            kind         <= K_FILL;
+                         end
+                R_FILLC: fill_col <= s_axi_wdata[3:0];
+                R_CLRC:  cpu_clear_col <= s_axi_wdata[BPP-1:0];
+                R_LADDR: lane_addr <= s_axi_wdata[13:0];
+                R_IRQE:  irq_enable <= s_axi_wdata[2:0];
+                R_LDAT8: begin
+                            cpu_addr  <= {2'b00, lane_addr};
+                            cpu_dat8  <= s_axi_wdata[8*BPP-1:0];
+                            cpu_mask8 <= mask_reg;
+                            cpu_lane8 <= 1'b1;
+                            lane_addr <= lane_addr + 14'd1;
+                            busy      <= 1'b1;
+                            kind      <= K_WIDE;
+                         end
+                default: ;
+                endcase
+            end
+
+            // Port set up in the accept cycle, then the strobe: one clock for
+            // the frame buffer, after which the blitter or fill engine
+            // shows busy; STROBE_CLKS high for the clk_pix ports, whose
+            // idx/dat then stay put until PIX_CLKS
+            if (busy) begin
+                cnt <= cnt + 6'd1;
+                if (cnt == 6'd0) begin
+                    cpu_we      <= (kind == K_PIX);
+                    cpu_we8     <= (kind == K_WIDE);
+                    cpu_blit_we <= (kind == K_BLIT);
+                    cpu_oam_we  <= (kind == K_OAM);
+                    cpu_tile_we <= (kind == K_TILE);
+                    cpu_fill_we <= (kind == K_FILL);
+                    cpu_scroll_we <= (kind == K_SCRL);
+                    cpu_pal_we  <= (kind == K_PAL);
+                end
+                if (cnt == (kind == K_OAM || kind == K_TILE || kind == K_SCRL ||
+                            kind == K_PAL ? STROBE_CLKS : 1)) begin
+                    cpu_we      <= 1'b0;
+                    cpu_we8     <= 1'b0;
+                    cpu_blit_we <= 1'b0;
+                    cpu_oam_we  <= 1'b0;
+                    cpu_tile_we <= 1'b0;
+                    cpu_fill_we <= 1'b0;
+                    cpu_scroll_we <= 1'b0;
+                    cpu_pal_we  <= 1'b0;
+                end
+                if (cnt == (kind == K_OAM || kind == K_TILE || kind == K_SCRL ||
+                            kind == K_PAL ? PIX_CLKS :
+                            kind == K_WIDE ? WIDE_CLKS : 1))
+                    busy <= 1'b0;
+            end
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                             Cycle counter
+    // -------------------------------------------------------------------------
+    always @(posedge s_axi_aclk)
+        if (!s_axi_aresetn)
+            cycles <= 32'd0;
+        else
+            cycles <= cycles + 1'b1;
+
+    // -------------------------------------------------------------------------
+    //                               Interrupts
+    // -------------------------------------------------------------------------
+    // frame_ready is on this clock; VSYNCS counts the frame pulses, so its
+    // bit 0 toggles once a frame. An event on the clock of a clearing
+    // write stays set
+    wire [2:0] irq_event = {stat_vsyncs[0] ^ vsync_q, ~frame_ready & ready_q,
+                            frame_ready & ~ready_q};
+    wire [2:0] irq_clear = accept & reg_area & (reg_sel == R_IRQS) ?
+                           s_axi_wdata[2:0] : 3'd0;
+
+    always @(posedge s_axi_aclk)
+        if (!s_axi_aresetn) begin
+            irq_status <= 3'd0;
+            ready_q    <= 1'b0;
+            vsync_q    <= 1'b0;
+        end else begin
+            irq_status <= (irq_status & ~irq_clear) | irq_event;
+            ready_q    <= frame_ready;
+            vsync_q    <= stat_vsyncs[0];
+        end
+
+    assign irq = |(irq_status & irq_enable);
+
+    // -------------------------------------------------------------------------
+    //                              Read channel
+    // -------------------------------------------------------------------------
+    wire rd_window = s_axi_araddr[ADDR_WIDTH-1];
+    wire rd_low = ~rd_window & (s_axi_araddr[ADDR_WIDTH-2:12] == 0);
+    wire rd_table = rd_low & ((s_axi_araddr[11:6] == 6'b100000) |
+                              ((s_axi_araddr[11:10] == 2'b01) & (s_axi_araddr[9:2] < 8'd224)) |
+                              (s_axi_araddr[11:7] == 5'b00100) |
+                              (s_axi_araddr[11:8] == 4'b0001));
+    wire rd_reg = rd_low & (s_axi_araddr[11:7] == 5'd0) & (s_axi_araddr[6:2] <= R_IRQE);
+
+    assign s_axi_arready = ~s_axi_rvalid;
+    assign s_axi_rresp   = rd_err ? 2'b10 : 2'b00;
+
+    always @(posedge s_axi_aclk) begin
+        if (!s_axi_aresetn) begin
+            s_axi_rvalid <= 1'b0;
+            s_axi_rdata  <= 32'd0;
+            rd_err       <= 1'b0;
+        end else begin
+            if (s_axi_rvalid & s_axi_rready)
+                s_axi_rvalid <= 1'b0;
+            else if (s_axi_arvalid & ~s_axi_rvalid) begin
+                s_axi_rvalid <= 1'b1;
+                rd_err       <= ~(rd_window | rd_table | rd_reg);
+                if (!rd_reg)
+                    s_axi_rdata <= 32'd0;            // windows and tables are write-only
+                else case (s_axi_araddr[6:2])
+                R_ADDR:  s_axi_rdata <= {16'd0, addr_reg};
+                R_MASK:  s_axi_rdata <= {24'd0, mask_reg};
+                R_BLIT:  s_axi_rdata <= {30'd0, blit_full, blit_busy};
+                R_ODROP: s_axi_rdata <= {16'd0, oam_dropped_s[1]};
+                R_FILL:  s_axi_rdata <= {30'd0, fill_full, fill_busy};
+                R_FILLC: s_axi_rdata <= {28'd0, fill_col};
+                R_CLRC:  s_axi_rdata <= {{(32-BPP){1'b0}}, cpu_clear_col};
+                R_LADDR: s_axi_rdata <= {18'd0, lane_addr};
+                R_CYCLE: s_axi_rdata <= cycles;
+                R_VSYNC: s_axi_rdata <= stat_vsyncs;
+                R_SWAPS: s_axi_rdata <= stat_swaps;
+                R_MISS:  s_axi_rdata <= stat_missed;
+                R_DMAX:  s_axi_rdata <= stat_draw_max;
+                R_CLRCK: s_axi_rdata <= stat_clear_clks;
+                R_IRQS:  s_axi_rdata <= {29'd0, irq_status};
+                R_IRQE:  s_axi_rdata <= {29'd0, irq_enable};
+                default: s_axi_rdata <= 32'd0;
+                endcase
+            end
+        end
+    end
+
+endmodule
@@ -0,0 +1,150 @@
+// -----------------------------------------------------------------------------
+//  Rectangle fill engine
+//  fills {x, y, w, h, colour} jobs into the back buffer of
+//  vga_framebuffer_top
+// -----------------------------------------------------------------------------
+//  Command (37 bits)
+//    rectangle, [36] = 0               span, [36] = 1
+//    [7:0]    x                        [15:0]   pixel address
+//    [15:8]   y
+//    [23:16]  w - 1                    [23:16]  n - 1
+//    [31:24]  h - 1                    [31:24]  0
+//    [35:32]  colour                   [35:32]  colour
+//  A span is n consecutive pixels from the address on, running on into the
+//  next row. Pixels beyond the right or bottom edge (a span: the end of the
+//  buffer) are not written.
+// -----------------------------------------------------------------------------
+//  One pixel per clock plus one setup clock per job. Queued jobs are only
+//  started while `enable` is high (S_DRAW).
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module fill_engine #(
+    parameter FB_WIDTH   = 224,
+    parameter FB_HEIGHT  = 256,
+    parameter BPP        = 4,
+    parameter FIFO_DEPTH = 8
+)(
+    input  wire             clk,        // clk_axi of vga_framebuffer_top
+    input  wire             rst,
+
+    // command port: cmd is taken on the rising edge of cmd_we
+    input  wire             cmd_we,
+    input  wire [36:0]      cmd,
+    input  wire             enable,
+
+    // frame-buffer write port
+    output reg              wr_en,
+    output reg  [$clog2(FB_WIDTH*FB_HEIGHT)-1:0] wr_addr,
+    output reg  [BPP-1:0]   wr_dat,
+
+    // status
+    output wire             busy,   // jobs queued or pixels in flight
+    output wire             full    // room for fewer than two jobs
+);
+
+    localparam ADDRW = $clog2(FB_WIDTH * FB_HEIGHT);
+    localparam FIFOW = $clog2(FIFO_DEPTH);
+
+    // -------------------------------------------------------------------------
+    //                     Command strobe (rising edge)
+    // -------------------------------------------------------------------------
+    reg  we_q;
+    always @(posedge clk) we_q <= cmd_we;
+    wire push = cmd_we & ~we_q;
+
+    // -------------------------------------------------------------------------
+    //                              Command FIFO
+    // -------------------------------------------------------------------------
+    reg [36:0]      fifo [0:FIFO_DEPTH-1];
+    reg [FIFOW-1:0] wr_ptr, rd_ptr;
+    reg [FIFOW:0]   count;
+
+    reg  run, setup;
+    wire pop = ~run & ~setup & enable & (count != 0);
+
+    always @(posedge clk) begin
+        if (rst) begin
+            wr_ptr <= {FIFOW{1'b0}};
+            rd_ptr <= {FIFOW{1'b0}};
+            count  <= {(FIFOW+1){1'b0}};
+        end else begin
+            if (push && count != FIFO_DEPTH) begin
+                fifo[wr_ptr] <= cmd;
+                wr_ptr       <= wr_ptr + 1'b1;
+            end
+            if (pop)
+                rd_ptr <= rd_ptr + 1'b1;
+            if ((push && count != FIFO_DEPTH) && !pop)
+                count <= count + 1'b1;
+            else if (pop && !(push && count != FIFO_DEPTH))
+                count <= count - 1'b1;
+        end
+    end
+
+    assign full = (count >= FIFO_DEPTH - 2);
+
+    // -------------------------------------------------------------------------
+    //           Rasterizer: setup (row base = y * 224), then counters
+    // -------------------------------------------------------------------------
+    reg [7:0]       x0, y0, wm1, hm1, cx, cy;
+    reg [BPP-1:0]   col;
+    reg [ADDRW-1:0] line_addr;   // address of (x0, y0 + cy)
+    reg             span;        // running job is a span at {y0, x0}
+
+    always @(posedge clk) begin
+        if (rst) begin
+            run   <= 1'b0;
+            setup <= 1'b0;
+        end
+        else if (pop) begin
+            x0    <= fifo[rd_ptr][7:0];
+            y0    <= fifo[rd_ptr][15:8];
+            wm1   <= fifo[rd_ptr][23:16];
+            hm1   <= fifo[rd_ptr][31:24];
+            col   <= fifo[rd_ptr][35:32];
+            span  <= fifo[rd_ptr][36];
+            setup <= 1'b1;
+        end
+        else if (setup) begin
+            line_addr <= span ? {y0, x0} : (y0 << 7) + (y0 << 6) + (y0 << 5) + x0;
+            cx        <= 8'd0;
+            cy        <= 8'd0;
+            setup     <= 1'b0;
+            run       <= 1'b1;
+        end
+        else if (run) begin
+            cx <= cx + 1'b1;
+            if (cx == wm1) begin
+                cx        <= 8'd0;
+                cy        <= cy + 1'b1;
+                line_addr <= line_addr + FB_WIDTH;
+                if (cy == hm1)
+                    run <= 1'b0;
+            end
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                        Clip and write port
+    // -------------------------------------------------------------------------
+    wire [8:0]  px = x0 + cx;
+    wire [8:0]  py = y0 + cy;
+    wire [16:0] pa = line_addr + cx;
+    wire        inside = span ? (pa < FB_WIDTH * FB_HEIGHT) :
+                                (px < FB_WIDTH) & (py < FB_HEIGHT);
+
+    always @(posedge clk) begin
+        if (rst) wr_en <= 1'b0;
+        else begin
+            wr_en   <= run & inside;
+            wr_addr <= line_addr + cx;
+            wr_dat  <= col;
+        end
+    end
+
+    assign busy = (count != 0) | setup | run | wr_en;
+
+endmodule
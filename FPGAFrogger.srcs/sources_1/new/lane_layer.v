@@ -0,0 +1,130 @@
+// -----------------------------------------------------------------------------
+//  Lane layer
+//  16-pixel bands of the frame buffer shown from horizontally scrolling lane
+//  buffers, under the frame buffer and over the tile layer
+// -----------------------------------------------------------------------------
+//  Every band (frame-buffer rows 16b .. 16b+15) has a scroll register
+//    [8:0]    scroll, 0 .. width - 1
+//    [17:9]   width, 224 .. 511; 0 = band has no lane
+//  and frame-buffer column x of the band shows column (x + scroll) mod width
+//  of its lane buffer, 16 rows x 512 columns. Only bands FIRST_BAND ..
+//  FIRST_BAND + NUM_LANES - 1 have lane buffers. Colour 0 is transparent.
+//
+//  Lane buffers and scroll registers are double-buffered like the OAM: the
+//  display reads bank `bank`, the CPU writes the other one, and both swap
+//  with fb_front.
+//
+//  Read pipeline, 4 clocks from x/y to `col`:
+//    L1  scroll register, x + scroll
+//    L2  wrap at width, buffer address
+//    L3  buffer read
+//    L4  bands without a lane -> colour 0
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module lane_layer #(
+    parameter BPP        = 4,
+    parameter FIRST_BAND = 3,
+    parameter NUM_LANES  = 11
+)(
+    input  wire             clk_pix,
+    input  wire             clk_wr,     // write side of the frame buffer
+
+    // lane buffer write port, clk_wr domain; wr_bank is `bank` as seen there
+    input  wire             wr_en,
+    input  wire [3:0]       wr_band,
+    input  wire [3:0]       wr_row,
+    input  wire [8:0]       wr_col,
+    input  wire [BPP-1:0]   wr_dat,
+    input  wire             wr_bank,
+
+    // scroll register write port, driven from the CPU clock domain: band/dat
+    // are held stable from before we rises until past the write on
+    // we_sync[1] & ~we_sync[2], at most 4 clk_pix later (PIX_CLKS of
+    // axi_fb_slave)
+    input  wire             scroll_we,
+    input  wire [3:0]       scroll_band,
+    input  wire [17:0]      scroll_dat,
+
+    input  wire             bank,       // bank shown (fb_front)
+
+    // display read: frame-buffer position
+    input  wire [7:0]       x,
+    input  wire [7:0]       y,
+    output reg  [BPP-1:0]   col
+);
+
+    localparam LANE_WORDS = 16 * 512;
+
+    // -------------------------------------------------------------------------
+    //              Scroll registers (2 banks x 16) and their strobe
+    // -------------------------------------------------------------------------
+    reg [17:0] scroll_regs [0:31];
+
+    integer k;
+    initial for (k = 0; k < 32; k = k + 1)
+        scroll_regs[k] = 18'd0;
+
+    reg [2:0] we_sync;
+    always @(posedge clk_pix) begin
+        we_sync <= {we_sync[1:0], scroll_we};
+        if (we_sync[1] & ~we_sync[2])
+            scroll_regs[{~bank, scroll_band}] <= scroll_dat;
+    end
+
+    // -------------------------------------------------------------------------
+    //                    Lane buffers (2 banks x NUM_LANES)
+    // -------------------------------------------------------------------------
+    reg [BPP-1:0] mem [0:2*NUM_LANES*LANE_WORDS-1];
+
+    wire wr_lane_ok = (wr_band >= FIRST_BAND) & (wr_band < FIRST_BAND + NUM_LANES);
+    wire [31:0] wr_addr = (wr_bank ? 0 : NUM_LANES * LANE_WORDS) +
+                          (wr_band - FIRST_BAND) * LANE_WORDS + wr_row * 512 + wr_col;
+
+    always @(posedge clk_wr)
+        if (wr_en & wr_lane_ok)
+            mem[wr_addr] <= wr_dat;
+
+    // L1: scroll register of the band, x + scroll
+    wire [3:0]  band = y[7:4];
+    wire [17:0] sreg = scroll_regs[{bank, band}];
+
+    reg [9:0] sum1;
+    reg [8:0] width1;
+    reg [3:0] band1, row1;
+    reg       en1;
+    always @(posedge clk_pix) begin
+        sum1   <= x + sreg[8:0];
+        width1 <= sreg[17:9];
+        band1  <= band;
+        row1   <= y[3:0];
+        en1    <= (sreg[17:9] != 9'd0) & (band >= FIRST_BAND) &
+                  (band < FIRST_BAND + NUM_LANES);
+    end
+
+    // L2: wrap, buffer address
+    wire [9:0] col1 = (sum1 >= width1) ? sum1 - width1 : sum1;
+
+    reg [31:0] rd_addr2;
+    reg        en2;
+    always @(posedge clk_pix) begin
+        rd_addr2 <= (bank ? NUM_LANES * LANE_WORDS : 0) +
+                    (band1 - FIRST_BAND) * LANE_WORDS + row1 * 512 + col1[8:0];
+        en2      <= en1;
+    end
+
+    // L3: buffer read
+    reg [BPP-1:0] q3;
+    reg           en3;
+    always @(posedge clk_pix) begin
+        q3  <= mem[rd_addr2];
+        en3 <= en2;
+    end
+
+    // L4
+    always @(posedge clk_pix)
+        col <= en3 ? q3 : {BPP{1'b0}};
+
+endmodule
@@ -0,0 +1,216 @@
+// -----------------------------------------------------------------------------
+//  Object layer (OAM)
+//  up to 64 16x16 sprites composited over the frame buffer per scanline
+// -----------------------------------------------------------------------------
+//  OAM entry
+//    [5:0]    sprite id (row of the sprite ROM)
+//    [14:6]   x, signed
+//    [23:15]  y, signed
+//    [24]     flip H     ] same transform as sprite_blitter
+//    [25]     flip V     ]
+//    [26]     rotate     ]
+//    [27]     behind: only shown where the frame buffer pixel is 0
+//    [31]     enable
+//  Colour 0 is transparent; a higher entry index is drawn on top.
+// -----------------------------------------------------------------------------
+//  The OAM is double-buffered like the frame buffer: the display uses bank
+//  `bank`, the CPU writes the other one, and both swap with fb_front.
+//
+//  During each screen line the next frame-buffer line is built into one of
+//  two line buffers: the OAM is scanned (2 clocks per entry) and every entry
+//  on the line is drawn in 16 clocks. 64 * 2 + 32 * 16 clocks still fit in
+//  the 800-clock line, so lines with more than MAX_PER_LINE entries drop the
+//  extra ones and count them in `dropped`. The line buffer being shown is
+//  cleared as it is read, so it is empty again when it is built next.
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module oam_layer #(
+    parameter FB_WIDTH     = 224,
+    parameter FB_HEIGHT    = 256,
+    parameter Y0           = 112,   // first screen line of the frame buffer
+    parameter BPP          = 4,
+    parameter NUM_SPRITES  = 54,
+    parameter SPRITE_FILE  = "sprites.mem",
+    parameter MAX_PER_LINE = 32
+)(
+    input  wire                 clk_pix,
+    input  wire                 rst_pix,
+
+    // OAM write port, driven from the CPU clock domain: idx/dat are held
+    // stable from before we rises until past the write on we_sync[1] &
+    // ~we_sync[2], at most 4 clk_pix later (PIX_CLKS of axi_fb_slave)
+    input  wire                 oam_we,
+    input  wire [5:0]           oam_idx,
+    input  wire [31:0]          oam_dat,
+    input  wire                 bank,       // bank shown (fb_front)
+
+    // timing
+    input  wire                 line,       // start of screen line sy
+    input  wire signed [15:0]   sy,
+    input  wire                 frame_pulse,
+
+    // display read: frame-buffer column, registered read
+    input  wire                 rd_en,
+    input  wire [7:0]           rd_x,
+    output wire [BPP:0]         obj,        // {behind, colour}, colour 0 = none
+
+    output reg  [15:0]          dropped     // entries dropped in the last frame
+);
+
+    // -------------------------------------------------------------------------
+    //                  OAM (2 banks x 64) and its write strobe
+    // -------------------------------------------------------------------------
+    reg [31:0] oam [0:127];
+    reg [31:0] oam_q;
+
+    reg [2:0] we_sync;
+    always @(posedge clk_pix) we_sync <= {we_sync[1:0], oam_we};
+
+    reg [6:0] scan_i;      // entry being scanned, 64 = done
+    always @(posedge clk_pix) begin
+        if (we_sync[1] & ~we_sync[2])
+            oam[{~bank, oam_idx}] <= oam_dat;
+        oam_q <= oam[{bank, scan_i[5:0]}];
+    end
+
+    // -------------------------------------------------------------------------
+    //                             Line builder
+    // -------------------------------------------------------------------------
+    localparam B_IDLE  = 2'd0,
+               B_ADDR  = 2'd1,
+               B_CHECK = 2'd2,
+               B_DRAW  = 2'd3;
+
+    reg [1:0]        bstate;
+    reg              wb;          // line buffer being built, ~wb is shown
+    reg signed [9:0] ty;          // frame-buffer line being built
+    reg [5:0]        hits;
+    reg [15:0]       drop_cnt;
+
+    // entry being drawn
+    reg [5:0]        id;
+    reg signed [9:0] ox;
+    reg [3:0]        row;
+    reg              fh, fv, rot, behind;
+    reg [3:0]        dx;
+
+    wire signed [9:0] e_y  = {oam_q[23], oam_q[23:15]};
+    wire signed [9:0] e_dy = ty - e_y;
+    wire              e_hit = oam_q[31] & (e_dy >= 0) & (e_dy < 16);
+
+    always @(posedge clk_pix) begin
+        if (rst_pix) begin
+            bstate   <= B_IDLE;
+            wb       <= 1'b0;
+            drop_cnt <= 16'd0;
+            dropped  <= 16'd0;
+        end else begin
+            if (frame_pulse) begin
+                dropped  <= drop_cnt;
+                drop_cnt <= 16'd0;
+            end
+
+            if (line) begin
+                // the buffer just built is shown on this line; build the next
+                wb     <= ~wb;
+                ty     <= sy[9:0] + 10'sd1 - Y0;
+                scan_i <= 7'd0;
+                hits   <= 6'd0;
+                bstate <= (sy + 1 >= Y0 && sy + 1 < Y0 + FB_HEIGHT) ? B_ADDR : B_IDLE;
+            end
+            else case (bstate)
+            B_ADDR:  bstate <= B_CHECK;     // oam_q follows scan_i
+            B_CHECK: begin
+                        if (e_hit && hits != MAX_PER_LINE) begin
+                            id     <= oam_q[5:0];
+                            ox     <= {oam_q[14], oam_q[14:6]};
+                            row    <= e_dy[3:0];
+                            fh     <= oam_q[24];
+                            fv     <= oam_q[25];
+                            rot    <= oam_q[26];
+                            behind <= oam_q[27];
+                            dx     <= 4'd0;
+                            hits   <= hits + 1'b1;
+                            bstate <= B_DRAW;
+                        end
+                        else begin
+                            if (e_hit)
+                                drop_cnt <= drop_cnt + 1'b1;
+                            bstate <= (scan_i == 7'd63) ? B_IDLE : B_ADDR;
+                        end
+                        scan_i <= scan_i + 1'b1;
+                     end
+            B_DRAW:  begin
+                        dx <= dx + 1'b1;
+                        if (dx == 4'd15)
+                            bstate <= (scan_i == 7'd64) ? B_IDLE : B_ADDR;
+                     end
+            default: ;
+            endcase
+        end
+    end
+
+    // source pixel: flips on the screen position, then the rotation
+    wire [3:0] fx = dx ^ {4{fh}};
+    wire [3:0] fy = row ^ {4{fv}};
+    wire [3:0] sx = rot ? ~fy : fx;
+    wire [3:0] sy_src = rot ? fx : fy;
+
+    // D1: ROM address and column
+    reg [13:0]       rom_addr;
+    reg signed [9:0] px1;
+    reg              behind1, v1;
+    always @(posedge clk_pix) begin
+        rom_addr <= {id, sy_src, sx};
+        px1      <= ox + $signed({6'd0, dx});
+        behind1  <= behind;
+        v1       <= (bstate == B_DRAW) & ~line & ~rst_pix;
+    end
+
+    // D2: ROM read, clip
+    reg [BPP-1:0] rom [0:NUM_SPRITES*256-1];
+    initial $readmemh(SPRITE_FILE, rom);
+
+    reg [BPP-1:0] rom_q;
+    reg [7:0]     px2;
+    reg           behind2, v2;
+    always @(posedge clk_pix) begin
+        rom_q   <= rom[rom_addr];
+        px2     <= px1[7:0];
+        behind2 <= behind1;
+        v2      <= v1 & ~rst_pix & (px1 >= 0) & (px1 < FB_WIDTH);
+    end
+
+    wire build_we = v2 & (rom_q != {BPP{1'b0}});
+
+    // -------------------------------------------------------------------------
+    //          Line buffers: one built, the other read and cleared
+    // -------------------------------------------------------------------------
+    reg [BPP:0] lb0 [0:255];
+    reg [BPP:0] lb1 [0:255];
+    reg [BPP:0] lb0_q, lb1_q;
+
+    integer k;
+    initial for (k = 0; k < 256; k = k + 1) begin
+        lb0[k] = {(BPP+1){1'b0}};
+        lb1[k] = {(BPP+1){1'b0}};
+    end
+
+    always @(posedge clk_pix) begin
+        if (wb == 1'b0 ? build_we : rd_en)
+            lb0[wb == 1'b0 ? px2 : rd_x] <= wb == 1'b0 ? {behind2, rom_q} : {(BPP+1){1'b0}};
+        lb0_q <= lb0[rd_x];
+    end
+
+    always @(posedge clk_pix) begin
+        if (wb == 1'b1 ? build_we : rd_en)
+            lb1[wb == 1'b1 ? px2 : rd_x] <= wb == 1'b1 ? {behind2, rom_q} : {(BPP+1){1'b0}};
+        lb1_q <= lb1[rd_x];
+    end
+
+    assign obj = wb ? lb0_q : lb1_q;
+
+endmodule
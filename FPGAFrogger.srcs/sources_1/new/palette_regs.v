@@ -0,0 +1,123 @@
+// -----------------------------------------------------------------------------
+//  Palette registers
+//  16-entry RGB444 palette written by the CPU, with palette-cycle slots
+// -----------------------------------------------------------------------------
+//  Two copies, both loaded from PALETTE_FILE: `pending`, which the CPU
+//  writes, and `shown`, which colours the pixels. Shown takes all of
+//  pending just after each frame pulse, in the vertical blank, so the
+//  entries of one frame always change together, with or without a swap.
+//
+//  Cycle slot k rotates the pending entries first..last by one every `rate`
+//  frame pulses, so the CPU does not have to rewrite them:
+//    bits  3:0   first entry
+//    bits  7:4   last entry (>= first)
+//    bits 15:8   frame pulses per step, 0 = slot off
+//    bit  16     0: colours move to the next higher entry (last -> first),
+//                1: to the next lower one (first -> last)
+//  Writing a slot restarts its count. After a frame pulse the slots step
+//  one per clock, slot 0 first, and shown is taken on the clock after the
+//  last one; a CPU write to an entry on the clock it rotates wins.
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module palette_regs #(
+    parameter PALETTE_FILE = "palette.mem",
+    parameter CYCLES       = 4      // palette-cycle slots, 0..16
+)(
+    input  wire             clk_pix,
+
+    // write port, driven from the CPU clock domain: idx/dat are held stable
+    // from before we rises until past the write on we_sync[1] & ~we_sync[2],
+    // at most 4 clk_pix later (PIX_CLKS of axi_fb_slave)
+    input  wire             pal_we,
+    input  wire [4:0]       pal_idx,    // 0..15 entry, 16 + k cycle slot k
+    input  wire [16:0]      pal_dat,    // entry: RGB444 in bits 11:0
+
+    input  wire             frame_pulse,
+
+    // display read
+    input  wire [3:0]       col,
+    output reg  [11:0]      rgb
+);
+
+    localparam NSLOTS = (CYCLES > 0) ? CYCLES : 1;
+
+    reg [11:0] pending [0:15];
+    reg [11:0] shown   [0:15];
+    initial begin
+        $readmemh(PALETTE_FILE, pending);
+        $readmemh(PALETTE_FILE, shown);
+    end
+
+    reg [16:0] slot [0:NSLOTS-1];
+    reg [7:0]  slot_cnt [0:NSLOTS-1];
+
+    integer k;
+    initial for (k = 0; k < NSLOTS; k = k + 1) begin
+        slot[k]     = 17'd0;
+        slot_cnt[k] = 8'd0;
+    end
+
+    reg [2:0] we_sync;
+    always @(posedge clk_pix) we_sync <= {we_sync[1:0], pal_we};
+    wire we = we_sync[1] & ~we_sync[2];
+
+    // -------------------------------------------------------------------------
+    //                 Cycle slots, stepped one per clock
+    // -------------------------------------------------------------------------
+    reg [4:0] step;             // slot stepped on this clock; NSLOTS = none
+    reg       take;             // shown <= pending
+    initial begin
+        step = NSLOTS;
+        take = 1'b0;
+    end
+
+    wire        stepping = (CYCLES > 0) && (step < NSLOTS);
+    wire [16:0] cfg      = slot[step[3:0] < NSLOTS ? step[3:0] : 4'd0];
+    wire [3:0]  first    = cfg[3:0];
+    wire [3:0]  last     = cfg[7:4];
+    wire [7:0]  rate     = cfg[15:8];
+    wire        down     = cfg[16];
+    wire        on       = stepping & (rate != 8'd0);
+    wire        due      = on & (slot_cnt[step[3:0]] + 8'd1 == rate);
+
+    integer i, src;
+    always @(posedge clk_pix) begin
+        if (frame_pulse)
+            step <= 5'd0;
+        else if (stepping)
+            step <= step + 1'b1;
+
+        take <= (CYCLES > 0) ? stepping && step == NSLOTS - 1 : frame_pulse;
+
+        if (on)
+            slot_cnt[step[3:0]] <= due ? 8'd0 : slot_cnt[step[3:0]] + 8'd1;
+
+        for (i = 0; i < 16; i = i + 1) begin
+            src = down ? ((i == last)  ? first : i + 1)
+                       : ((i == first) ? last  : i - 1);
+            if (due && i >= first && i <= last)
+                pending[i] <= pending[src & 15];
+        end
+
+        if (we && !pal_idx[4])
+            pending[pal_idx[3:0]] <= pal_dat[11:0];
+        if (we && pal_idx[4] && pal_idx[3:0] < CYCLES) begin
+            slot[pal_idx[3:0]]     <= pal_dat;
+            slot_cnt[pal_idx[3:0]] <= 8'd0;
+        end
+
+        if (take)
+            for (i = 0; i < 16; i = i + 1)
+                shown[i] <= pending[i];
+    end
+
+    // -------------------------------------------------------------------------
+    //                              Lookup
+    // -------------------------------------------------------------------------
+    always @(posedge clk_pix)
+        rgb <= shown[col];
+
+endmodule
@@ -0,0 +1,179 @@
+// -----------------------------------------------------------------------------
+//  Sprite blitter
+//  draws 16x16 sprites from a ROM into the back buffer of vga_framebuffer_top
+//  on behalf of the CPU: one command word per sprite through a FIFO
+// -----------------------------------------------------------------------------
+//  Command word
+//    [5:0]    sprite id (row of the sprite ROM)
+//    [14:6]   x, signed
+//    [23:15]  y, signed
+//    [24]     flip H     ] applied to the screen position, then
+//    [25]     flip V     ] [26] rotates by 90 degrees counterclockwise:
+//    [26]     rotate     ] src = (15 - y', x')
+//    [30:27]  transparent colour, not written
+//    [31]     opaque: write every pixel, ignore [30:27]
+// -----------------------------------------------------------------------------
+//  One pixel per clock, 257 clocks per sprite; pixels off the frame buffer
+//  are clipped. Commands are only started while `enable` is high (S_DRAW).
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module sprite_blitter #(
+    parameter FB_WIDTH    = 224,
+    parameter FB_HEIGHT   = 256,
+    parameter BPP         = 4,
+    parameter NUM_SPRITES = 54,
+    parameter SPRITE_FILE = "sprites.mem",
+    parameter FIFO_DEPTH  = 16
+)(
+    input  wire             clk,        // clk_axi of vga_framebuffer_top
+    input  wire             rst,
+
+    // command port: cmd is taken on the rising edge of cmd_we
+    input  wire             cmd_we,
+    input  wire [31:0]      cmd,
+    input  wire             enable,
+
+    // frame-buffer write port
+    output reg              wr_en,
+    output reg  [$clog2(FB_WIDTH*FB_HEIGHT)-1:0] wr_addr,
+    output reg  [BPP-1:0]   wr_dat,
+
+    // status
+    output wire             busy,   // commands queued or pixels in flight
+    output wire             full    // room for fewer than two commands
+);
+
+    localparam ADDRW = $clog2(FB_WIDTH * FB_HEIGHT);
+    localparam FIFOW = $clog2(FIFO_DEPTH);
+
+    // -------------------------------------------------------------------------
+    //                     Command strobe (rising edge)
+    // -------------------------------------------------------------------------
+    reg  we_q;
+    always @(posedge clk) we_q <= cmd_we;
+    wire push = cmd_we & ~we_q;
+
+    // -------------------------------------------------------------------------
+    //                              Command FIFO
+    // -------------------------------------------------------------------------
+    reg [31:0]    fifo [0:FIFO_DEPTH-1];
+    reg [FIFOW-1:0] wr_ptr, rd_ptr;
+    reg [FIFOW:0] count;
+
+    reg  run;
+    wire pop = ~run & enable & (count != 0);
+
+    always @(posedge clk) begin
+        if (rst) begin
+            wr_ptr <= {FIFOW{1'b0}};
+            rd_ptr <= {FIFOW{1'b0}};
+            count  <= {(FIFOW+1){1'b0}};
+        end else begin
+            if (push && count != FIFO_DEPTH) begin
+                fifo[wr_ptr] <= cmd;
+                wr_ptr       <= wr_ptr + 1'b1;
+            end
+            if (pop)
+                rd_ptr <= rd_ptr + 1'b1;
+            if ((push && count != FIFO_DEPTH) && !pop)
+                count <= count + 1'b1;
+            else if (pop && !(push && count != FIFO_DEPTH))
+                count <= count - 1'b1;
+        end
+    end
+
+    assign full = (count >= FIFO_DEPTH - 2);
+
+    // -------------------------------------------------------------------------
+    //                        Rasterizer (S0: counters)
+    // -------------------------------------------------------------------------
+    reg [5:0]        id;
+    reg signed [9:0] ox, oy;
+    reg              fh, fv, rot;
+    reg [4:0]        key;      // {opaque, colour}
+    reg [3:0]        dx, dy;
+
+    always @(posedge clk) begin
+        if (rst) run <= 1'b0;
+        else if (pop) begin
+            id  <= fifo[rd_ptr][5:0];
+            ox  <= {fifo[rd_ptr][14], fifo[rd_ptr][14:6]};
+            oy  <= {fifo[rd_ptr][23], fifo[rd_ptr][23:15]};
+            fh  <= fifo[rd_ptr][24];
+            fv  <= fifo[rd_ptr][25];
+            rot <= fifo[rd_ptr][26];
+            key <= {fifo[rd_ptr][31], fifo[rd_ptr][30:27]};
+            dx  <= 4'd0;
+            dy  <= 4'd0;
+            run <= 1'b1;
+        end
+        else if (run) begin
+            dx <= dx + 1'b1;
+            if (dx == 4'd15) begin
+                dy <= dy + 1'b1;
+                if (dy == 4'd15)
+                    run <= 1'b0;
+            end
+        end
+    end
+
+    // source pixel: flips on the screen position, then the rotation
+    wire [3:0] fx = dx ^ {4{fh}};
+    wire [3:0] fy = dy ^ {4{fv}};
+    wire [3:0] sx = rot ? ~fy : fx;
+    wire [3:0] sy = rot ?  fx : fy;
+
+    // -------------------------------------------------------------------------
+    //                  S1: ROM address and screen position
+    // -------------------------------------------------------------------------
+    reg [13:0]       rom_addr;
+    reg signed [9:0] px1, py1;
+    reg [4:0]        key1;
+    reg              v1;
+    always @(posedge clk) begin
+        rom_addr <= {id, sy, sx};
+        px1      <= ox + $signed({6'd0, dx});
+        py1      <= oy + $signed({6'd0, dy});
+        key1     <= key;
+        v1       <= run & ~rst;
+    end
+
+    // -------------------------------------------------------------------------
+    //             S2: ROM read, clip test, row base = y * 224
+    // -------------------------------------------------------------------------
+    reg [BPP-1:0] rom [0:NUM_SPRITES*256-1];
+    initial $readmemh(SPRITE_FILE, rom);
+
+    reg [BPP-1:0]   rom_q;
+    reg [ADDRW-1:0] row_base2;
+    reg [7:0]       px2;
+    reg [4:0]       key2;
+    reg             v2;
+    always @(posedge clk) begin
+        rom_q     <= rom[rom_addr];
+        row_base2 <= (py1[7:0] << 7) + (py1[7:0] << 6) + (py1[7:0] << 5);
+        px2       <= px1[7:0];
+        key2      <= key1;
+        v2        <= v1 & ~rst &
+                     (px1 >= 0) & (px1 < FB_WIDTH) &
+                     (py1 >= 0) & (py1 < FB_HEIGHT);
+    end
+
+    // -------------------------------------------------------------------------
+    //                    S3: transparency, write port
+    // -------------------------------------------------------------------------
+    always @(posedge clk) begin
+        if (rst) wr_en <= 1'b0;
+        else begin
+            wr_en   <= v2 & (key2[4] | (rom_q != key2[3:0]));
+            wr_addr <= row_base2 + px2;
+            wr_dat  <= rom_q;
+        end
+    end
+
+    assign busy = (count != 0) | run | v1 | v2 | wr_en;
+
+endmodule
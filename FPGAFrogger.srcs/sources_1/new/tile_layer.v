@@ -0,0 +1,90 @@
+// -----------------------------------------------------------------------------
+//  Tile layer
+//  14x16 tilemap of 16x16 background tiles shown under the frame buffer
+// -----------------------------------------------------------------------------
+//  The tile patterns are the background[] tiles of the firmware, loaded from
+//  TILE_FILE (tile n, row y, column x at n * 256 + y * 16 + x). Tile 0 is
+//  empty and shows colour 0, as the cleared frame buffer did.
+//
+//  The tilemap is double-buffered like the OAM: the display reads bank
+//  `bank`, the CPU writes the other one, and both swap with fb_front.
+//
+//  Read pipeline, 4 clocks from x/y to `col`:
+//    T1  tilemap address ty * 14 + tx
+//    T2  tilemap read
+//    T3  pattern read
+//    T4  tile 0 -> colour 0
+// -----------------------------------------------------------------------------
+
+`timescale 1ns/1ps
+`default_nettype none
+
+module tile_layer #(
+    parameter TILES_X   = 14,
+    parameter TILES_Y   = 16,
+    parameter BPP       = 4,
+    parameter NUM_TILES = 11,
+    parameter TILE_FILE = "tiles.mem"
+)(
+    input  wire             clk_pix,
+
+    // tilemap write port, driven from the CPU clock domain: idx/dat are held
+    // stable from before we rises until past the write on we_sync[1] &
+    // ~we_sync[2], at most 4 clk_pix later (PIX_CLKS of axi_fb_slave)
+    input  wire             tile_we,
+    input  wire [7:0]       tile_idx,   // ty * TILES_X + tx
+    input  wire [3:0]       tile_dat,
+    input  wire             bank,       // bank shown (fb_front)
+
+    // display read: frame-buffer position
+    input  wire [7:0]       x,
+    input  wire [7:0]       y,
+    output reg  [BPP-1:0]   col
+);
+
+    // -------------------------------------------------------------------------
+    //                  Tilemap (2 banks x 256) and its write strobe
+    // -------------------------------------------------------------------------
+    reg [3:0] tilemap [0:511];
+
+    integer k;
+    initial for (k = 0; k < 512; k = k + 1)
+        tilemap[k] = 4'd0;
+
+    reg [2:0] we_sync;
+    always @(posedge clk_pix) we_sync <= {we_sync[1:0], tile_we};
+
+    // T1: tilemap address, pixel within the tile
+    reg [7:0] map_addr1;
+    reg [7:0] sub1;
+    always @(posedge clk_pix) begin
+        map_addr1 <= (y[7:4] << 4) - (y[7:4] << 1) + x[7:4];   // ty * 14 + tx
+        sub1      <= {y[3:0], x[3:0]};
+    end
+
+    // T2: tilemap read
+    reg [3:0] tid2;
+    reg [7:0] sub2;
+    always @(posedge clk_pix) begin
+        if (we_sync[1] & ~we_sync[2])
+            tilemap[{~bank, tile_idx}] <= tile_dat;
+        tid2 <= tilemap[{bank, map_addr1}];
+        sub2 <= sub1;
+    end
+
+    // T3: pattern read
+    reg [BPP-1:0] rom [0:NUM_TILES*256-1];
+    initial $readmemh(TILE_FILE, rom);
+
+    reg [BPP-1:0] pat3;
+    reg           empty3;
+    always @(posedge clk_pix) begin
+        pat3   <= rom[{tid2, sub2}];
+        empty3 <= (tid2 == 4'd0) | (tid2 >= NUM_TILES);
+    end
+
+    // T4
+    always @(posedge clk_pix)
+        col <= empty3 ? {BPP{1'b0}} : pat3;
+
+endmodule
@@ -1,6 +1,16 @@
 // -----------------------------------------------------------------------------
-//  VGA Frame-buffer Top (640×480 @ 60 Hz)   –   double-buffered
-//  with CPU-done handshake, using Project-F display_480p timing block
+//  VGA Frame-buffer Top (640×480 @ 60 Hz)   –   double- or triple-buffered
+//  with CPU-done handshake, using Project-F display_480p timing block,
+//  sprite blitter, rectangle fill engine, scanline object layer, scrolling
+//  lane layer, background tile layer and CPU-written palette
+// -----------------------------------------------------------------------------
+//  Two clock domains. The write side runs on clk_axi, the clock of the CPU
+//  and axi_fb_slave: the CPU write ports, cpu_done / frame_ready, the
+//  buffer state machine, the blitter, the fill engine, the line clearer
+//  and the BRAM write ports. The display side runs on clk_pix: timing, the
+//  BRAM read ports and the layers. Between them only the beam position
+//  (with the frame pulse) and the buffer selection cross, each as a word
+//  that holds for a line or more and is taken on a synchronized toggle.
 // -----------------------------------------------------------------------------
 //  Tested with Vivado 2018.2  (Artix-7, Basys-3, 25 MHz pixel clock)
 // -----------------------------------------------------------------------------
@@ -12,18 +22,77 @@ module vga_framebuffer_top #(
     parameter FB_WIDTH  = 224,
     parameter FB_HEIGHT = 256,
     parameter BPP       = 4,
-    parameter INIT_FILE = "background.mem"
+    parameter INIT_FILE = "background.mem",
+    parameter SPRITE_FILE = "sprites.mem",   // sprite ROM of the blitter
+    parameter TILE_FILE = "tiles.mem",       // tile patterns of the tile layer
+    parameter PALETTE_FILE = "palette.mem",  // RGB444 palette, one entry per line
+    parameter PAL_CYCLES = 4,   // palette-cycle slots (see palette_regs.v)
+    parameter CLEAR_BACK = 1,   // 0: back buffer keeps its old frame at the swap
+    parameter NUM_BUFFERS = 2,  // 3: triple-buffered; no lane layer, and the
+                                // object and tile layers stay double-banked
+    parameter LANES = 1         // 0: no lane layer, frees its 22 BRAM36
 )(
     // clocks & reset ----------------------------------------------------------
     input  wire clk_pix,      // 25 MHz pixel clock
     input  wire rst_pix,
+    input  wire clk_axi,      // 75 MHz CPU / AXI clock, the write side
+    input  wire rst_axi,
 
-    // CPU write port ----------------------------------------------------------
+    // CPU write port, clk_axi domain ------------------------------------------
     input  wire         cpu_we,
     input  wire [15:0]  cpu_addr,
     input  wire [BPP-1:0] cpu_dat,
     input  wire         cpu_done,   // asserted by CPU when frame is finished
 
+    // packed write port: eight pixels at once, cpu_addr is the 8-pixel
+    // group (pixel address / 8), pixel 0 in the low bits of cpu_dat8
+    input  wire         cpu_we8,
+    input  wire [8*BPP-1:0] cpu_dat8,
+    input  wire [7:0]   cpu_mask8,  // per-pixel write enable
+    input  wire         cpu_lane8,  // packed write goes to a lane buffer,
+                                    // cpu_addr = {band, row, column / 8}
+
+    // sprite blitter command port (see sprite_blitter.v)
+    input  wire         cpu_blit_we,
+    input  wire [31:0]  cpu_blit_cmd,
+    output wire         blit_busy,  // FIFO not empty or sprite being drawn
+    output wire         blit_full,
+
+    // rectangle fill engine command port (see fill_engine.v); the line
+    // clearer fills buffers with cpu_clear_col
+    input  wire         cpu_fill_we,
+    input  wire [36:0]  cpu_fill_cmd,
+    input  wire [BPP-1:0] cpu_clear_col,
+    output wire         fill_busy,
+    output wire         fill_full,
+
+    // object layer: OAM write port (see oam_layer.v), the CPU writes the
+    // bank that goes with the back buffer. This and the tile and scroll
+    // ports are strobes from clk_axi, synchronized in the layers
+    input  wire         cpu_oam_we,
+    input  wire [5:0]   cpu_oam_idx,
+    input  wire [31:0]  cpu_oam_dat,
+    output wire [15:0]  oam_dropped, // entries over the per-line limit, last frame
+
+    // tile layer: tilemap write port (see tile_layer.v), same banking as
+    // the OAM
+    input  wire         cpu_tile_we,
+    input  wire [7:0]   cpu_tile_idx,
+    input  wire [3:0]   cpu_tile_dat,
+
+    // lane layer: scroll register write port (see lane_layer.v), same
+    // banking as the OAM
+    input  wire         cpu_scroll_we,
+    input  wire [3:0]   cpu_scroll_band,
+    input  wire [17:0]  cpu_scroll_dat,
+
+    // palette write port (see palette_regs.v): entries 0..15 and the cycle
+    // slots, a strobe from clk_axi like the tile port; the entries written
+    // are shown from the next frame pulse
+    input  wire         cpu_pal_we,
+    input  wire [4:0]   cpu_pal_idx,
+    input  wire [16:0]  cpu_pal_dat,
+
     // VGA outputs -------------------------------------------------------------
     output wire         VGA_Hsync,
     output wire         VGA_Vsync,
@@ -31,8 +100,16 @@ module vga_framebuffer_top #(
     output wire [BPP-1:0] VGA_Green,
     output wire [BPP-1:0] VGA_Blue,
 
-    // status ------------------------------------------------------------------
-    output wire         frame_ready  // high while CPU may draw
+    // status, clk_axi domain --------------------------------------------------
+    output wire         frame_ready, // high while CPU may draw
+
+    // frame-pacing statistics since reset, copied one clock after each frame
+    // pulse (see below)
+    output reg  [31:0]  stat_vsyncs,     // frame pulses
+    output reg  [31:0]  stat_swaps,      // buffer swaps
+    output reg  [31:0]  stat_missed,     // frame pulses in S_DRAW (no swap)
+    output reg  [31:0]  stat_draw_max,   // longest S_DRAW, clk_axi cycles
+    output reg  [31:0]  stat_clear_clks  // clk_axi cycles in S_CLEAR
 );
 
     // -------------------------------------------------------------------------
@@ -73,67 +150,421 @@ module vga_framebuffer_top #(
     always @(posedge clk_pix) prev_frame <= frame;
 
     // -------------------------------------------------------------------------
-    //                    Double-buffering state machine
+    //                   Beam position into clk_axi
     // -------------------------------------------------------------------------
+    // At the start of every line: beam_lines, the window lines the beam is
+    // past (line y is scanned once beam_lines > y), and beam_frame, which
+    // flips on the frame pulse. The pair holds for a whole line, so clk_axi
+    // takes it once the beam_tgl edge is through the synchronizer, and
+    // frame_pulse_s comes from the same copy: the write side never sees a
+    // new frame with the old frame's lines.
+    reg       beam_tgl, beam_frame;
+    reg [8:0] beam_lines;
+
+    always @(posedge clk_pix) begin
+        if (rst_pix) begin
+            beam_tgl   <= 1'b0;
+            beam_frame <= 1'b0;
+            beam_lines <= 9'd0;
+        end
+        else if (line) begin
+            beam_tgl <= ~beam_tgl;
+            if (frame_pulse) begin
+                beam_frame <= ~beam_frame;
+                beam_lines <= 9'd0;
+            end
+            else if (~sy[15] && sy[9:0] > Y0 && beam_lines != FB_HEIGHT)
+                beam_lines <= beam_lines + 1'b1;
+        end
+    end
+
+    reg [2:0] beam_tgl_s;
+    reg       beam_frame_s, frame_pulse_s;
+    reg [8:0] beam_lines_s;
+
+    always @(posedge clk_axi) begin
+        beam_tgl_s    <= {beam_tgl_s[1:0], beam_tgl};
+        frame_pulse_s <= 1'b0;
+        if (rst_axi) begin
+            beam_tgl_s   <= 3'd0;
+            beam_frame_s <= 1'b0;
+            beam_lines_s <= 9'd0;
+        end
+        else if (beam_tgl_s[2] ^ beam_tgl_s[1]) begin
+            beam_frame_s  <= beam_frame;
+            beam_lines_s  <= beam_lines;
+            frame_pulse_s <= beam_frame ^ beam_frame_s;
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                 Double/triple-buffering state machine
+    // -------------------------------------------------------------------------
+    // Buffer roles: fb_front is on screen, fb_draw is the CPU's back buffer.
+    // With two buffers a finished frame waits in S_WAIT for the frame pulse,
+    // which swaps the two. With three, a finished frame becomes fb_ready
+    // (ready_valid) and the CPU goes straight on with the spare buffer; the
+    // frame pulse then puts fb_ready on screen and frees the old front. Only
+    // when a frame is already waiting does the CPU wait in S_WAIT. All of it
+    // runs on clk_axi, from frame_pulse_s.
     localparam S_IDLE  = 2'd0,
                S_CLEAR = 2'd1,
                S_DRAW  = 2'd2,
                S_WAIT  = 2'd3;
+    localparam TRIPLE  = (NUM_BUFFERS == 3);
 
     reg [1:0] state;
-    reg fb_front;          // 0 = bram0 is front, 1 = bram1 is front
-    reg clearing;
-    reg [ADDRW-1:0] clear_addr;
+    reg [1:0] fb_front;    // buffer on screen
+    reg [1:0] fb_draw;     // buffer the CPU draws into
+    reg [1:0] fb_ready;    // finished, shown at the next frame pulse
+    reg ready_valid;
+    reg layer_bank;        // object/tile/lane bank shown, flips at each swap
+    wire clear_done;       // line clearer: no line of fb_draw left to clear
+    reg w8_busy;           // packed store being unpacked (see below)
+    reg fb_we;             // write-side mux: a pixel store on the next clock
+    reg done_armed;        // cpu_done seen low since S_DRAW was entered
 
-    always @(posedge clk_pix) begin
-        if (rst_pix) begin
-            state      <= S_IDLE;
-            fb_front   <= 1'b0;
-            clearing   <= 1'b0;
-            clear_addr <= {ADDRW{1'b0}};
+    // Sprites, fills and packed stores still queued belong to the frame
+    // being finished, as does a pixel still on its way from cpu_we / the
+    // engines through fb_we: the slave answers a store before it is written
+    wire       taken     = cpu_done & done_armed & ~blit_busy & ~fill_busy &
+                           ~w8_busy & ~cpu_we & ~cpu_we8 & ~fb_we;
+    wire       show      = TRIPLE & frame_pulse_s & ready_valid;
+    wire       has_spare = ~ready_valid | show;
+    wire [1:0] spare     = show ? fb_front : 2'd3 - fb_front - fb_draw;
+
+    always @(posedge clk_axi) begin
+        if (rst_axi) begin
+            state       <= S_IDLE;
+            fb_front    <= 2'd0;
+            fb_draw     <= 2'd1;
+            fb_ready    <= 2'd0;
+            ready_valid <= 1'b0;
+            layer_bank  <= 1'b0;
+            done_armed  <= 1'b0;
         end else begin
+            if (show) begin
+                fb_front    <= fb_ready;
+                ready_valid <= 1'b0;
+                layer_bank  <= ~layer_bank;
+            end
             case (state)
             //-------------------------------------------------------------
-            S_IDLE:  if (frame_pulse)
-                        state <= S_CLEAR;
+            S_IDLE:  if (frame_pulse_s) begin
+                        state       <= CLEAR_BACK ? S_CLEAR : S_DRAW;
+                        done_armed  <= 1'b0;
+                     end
             //-------------------------------------------------------------
-            S_CLEAR: begin
-                        clearing   <= 1'b1;
-                        clear_addr <= clear_addr + 1'b1;
-                        if (clear_addr == DEPTH0-1) begin
-                            clearing   <= 1'b0;
-                            clear_addr <= {ADDRW{1'b0}};
-                            state      <= S_DRAW;
-                        end
+            // The clear is often over before the CPU has seen the swap (or,
+            // with three buffers, frame_ready fall), so a cpu_done still
+            // high from the last frame must be dropped first
+            S_CLEAR: if (clear_done) begin
+                        state      <= S_DRAW;
+                        done_armed <= ~cpu_done;
                      end
             //-------------------------------------------------------------
-            S_DRAW:  if (cpu_done) state <= S_WAIT;
+            // Without the clear the swap hands the buffer straight back, so
+            // a cpu_done still high from the frame just shown is ignored
+            // until the CPU has dropped it
+            S_DRAW:  begin
+                        if (!cpu_done)
+                            done_armed <= 1'b1;
+                        else if (taken && TRIPLE && has_spare) begin
+                            fb_ready    <= fb_draw;
+                            ready_valid <= 1'b1;
+                            fb_draw     <= spare;
+                            state       <= CLEAR_BACK ? S_CLEAR : S_DRAW;
+                            done_armed  <= 1'b0;
+                        end
+                        else if (taken)
+                            state <= S_WAIT;
+                     end
             //-------------------------------------------------------------
-            S_WAIT:  if (frame_pulse) begin
-                        fb_front <= ~fb_front;   // swap now
-                        state    <= S_CLEAR;     // clear new back buffer
+            S_WAIT:  if (frame_pulse_s) begin
+                        // swap now; with three buffers the frame that was
+                        // ready goes on screen and this one takes its place
+                        if (TRIPLE) begin
+                            fb_ready    <= fb_draw;
+                            ready_valid <= 1'b1;
+                        end
+                        else
+                            layer_bank <= ~layer_bank;
+                        fb_front    <= TRIPLE ? fb_ready : fb_draw;
+                        fb_draw     <= fb_front;
+                        // clear what is left of the new back buffer, or hand
+                        // it straight to the CPU, which then only redraws
+                        // what changed since this buffer was last drawn
+                        // (NUM_BUFFERS frames ago)
+                        state       <= CLEAR_BACK ? S_CLEAR : S_DRAW;
+                        done_armed  <= 1'b0;
                      end
             endcase
         end
     end
 
-    assign frame_ready = (state == S_DRAW);
+    wire swap_now = TRIPLE ? show : (frame_pulse_s & (state == S_WAIT));
+
+    // With three buffers the CPU may stay in S_DRAW across frames, so
+    // frame_ready also falls when a frame is taken, until cpu_done drops
+    assign frame_ready = (state == S_DRAW) & (done_armed | ~TRIPLE);
+
+    // -------------------------------------------------------------------------
+    //                    Buffer selection into clk_pix
+    // -------------------------------------------------------------------------
+    // fb_front and layer_bank only change at a swap, just after a frame
+    // pulse and far from the next window line, so clk_pix takes both
+    // together once the sel_tgl edge of that swap is through the
+    // synchronizer; a copy bit by bit could catch fb_front half changed.
+    reg sel_tgl;
+    always @(posedge clk_axi)
+        if (rst_axi)       sel_tgl <= 1'b0;
+        else if (swap_now) sel_tgl <= ~sel_tgl;
+
+    reg [2:0] sel_tgl_s;
+    reg [1:0] fb_front_s;
+    reg       layer_bank_s;
+    always @(posedge clk_pix) begin
+        sel_tgl_s <= {sel_tgl_s[1:0], sel_tgl};
+        if (rst_pix) begin
+            sel_tgl_s    <= 3'd0;
+            fb_front_s   <= 2'd0;
+            layer_bank_s <= 1'b0;
+        end
+        else if (sel_tgl_s[2] ^ sel_tgl_s[1]) begin
+            fb_front_s   <= fb_front;
+            layer_bank_s <= layer_bank;
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                     Frame-pacing statistics
+    // -------------------------------------------------------------------------
+    // A frame pulse without a finished frame to swap in, while the CPU is
+    // still drawing, shows the front buffer again. S_DRAW is timed from
+    // entry to exit, across such pulses, or to the frame taken with three
+    // buffers.
+    // The counts are copied out one clock after each pulse, so a copy
+    // includes that pulse and then holds for a whole frame. All wrap at 2^32.
+    reg [31:0] n_vsyncs, n_swaps, n_missed, draw_clks, draw_max, clear_clks;
+    reg        stat_latch;
+
+    always @(posedge clk_axi) begin
+        if (rst_axi) begin
+            n_vsyncs   <= 32'd0;
+            n_swaps    <= 32'd0;
+            n_missed   <= 32'd0;
+            draw_clks  <= 32'd0;
+            draw_max   <= 32'd0;
+            clear_clks <= 32'd0;
+            stat_latch <= 1'b0;
+        end else begin
+            if (frame_pulse_s) begin
+                n_vsyncs <= n_vsyncs + 1'b1;
+                if (swap_now)
+                    n_swaps <= n_swaps + 1'b1;
+                else if (state == S_DRAW || state == S_CLEAR)
+                    n_missed <= n_missed + 1'b1;
+            end
+            if (state == S_DRAW) begin
+                draw_clks <= taken ? 32'd0 : draw_clks + 1'b1;
+                if (draw_clks >= draw_max)
+                    draw_max <= draw_clks + 1'b1;
+            end
+            else
+                draw_clks <= 32'd0;
+            if (state == S_CLEAR)
+                clear_clks <= clear_clks + 1'b1;
+
+            stat_latch <= frame_pulse_s;
+            if (stat_latch) begin
+                stat_vsyncs     <= n_vsyncs;
+                stat_swaps      <= n_swaps;
+                stat_missed     <= n_missed;
+                stat_draw_max   <= draw_max;
+                stat_clear_clks <= clear_clks;
+            end
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //          Packed write: latch 8 pixels, store one per clock
+    // -------------------------------------------------------------------------
+    // Through the GPIOs a packed write takes several AXI writes to set up
+    // (address, data, mask, strobe), far more than the 8 clocks needed to
+    // store it; axi_fb_slave holds the next store back for those 8 clocks.
+    // Either way the next one never arrives while this one is busy. A
+    // strobe still high when it finishes just stores the same group again.
+    reg             w8_lane;    // into a lane buffer, not the frame buffer
+    reg [2:0]       w8_cnt;
+    reg [13:0]      w8_group;   // lane address {band, row, column / 8}, or
+                                // the frame-buffer group in the low bits
+    reg [8*BPP-1:0] w8_dat;
+    reg [7:0]       w8_mask;
+
+    always @(posedge clk_axi) begin
+        if (rst_axi) w8_busy <= 1'b0;
+        else if (!w8_busy) begin
+            if (cpu_we8 && state == S_DRAW) begin
+                w8_busy  <= 1'b1;
+                w8_lane  <= cpu_lane8;
+                w8_cnt   <= 3'd0;
+                w8_group <= cpu_addr[13:0];
+                w8_dat   <= cpu_dat8;
+                w8_mask  <= cpu_mask8;
+            end
+        end
+        else begin
+            w8_cnt  <= w8_cnt + 1'b1;
+            w8_dat  <= w8_dat >> BPP;
+            w8_mask <= w8_mask >> 1;
+            if (w8_cnt == 3'd7)
+                w8_busy <= 1'b0;
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //                            Sprite blitter
+    // -------------------------------------------------------------------------
+    wire             blit_we;
+    wire [ADDRW-1:0] blit_addr;
+    wire [BPP-1:0]   blit_dat;
+
+    sprite_blitter #(
+        .FB_WIDTH    (FB_WIDTH),
+        .FB_HEIGHT   (FB_HEIGHT),
+        .BPP         (BPP),
+        .SPRITE_FILE (SPRITE_FILE)
+    ) u_blit (
+        .clk     (clk_axi),
+        .rst     (rst_axi),
+        .cmd_we  (cpu_blit_we),
+        .cmd     (cpu_blit_cmd),
+        .enable  (state == S_DRAW),
+        .wr_en   (blit_we),
+        .wr_addr (blit_addr),
+        .wr_dat  (blit_dat),
+        .busy    (blit_busy),
+        .full    (blit_full)
+    );
 
     // -------------------------------------------------------------------------
-    //                    Write-side mux (CPU or clear)
+    //                        Rectangle fill engine
     // -------------------------------------------------------------------------
+    wire             fill_we;
+    wire [ADDRW-1:0] fill_addr;
+    wire [BPP-1:0]   fill_dat;
+
+    fill_engine #(
+        .FB_WIDTH  (FB_WIDTH),
+        .FB_HEIGHT (FB_HEIGHT),
+        .BPP       (BPP)
+    ) u_fill (
+        .clk         (clk_axi),
+        .rst         (rst_axi),
+        .cmd_we      (cpu_fill_we),
+        .cmd         (cpu_fill_cmd),
+        .enable      (state == S_DRAW),
+        .wr_en       (fill_we),
+        .wr_addr     (fill_addr),
+        .wr_dat      (fill_dat),
+        .busy        (fill_busy),
+        .full        (fill_full)
+    );
+
+    // -------------------------------------------------------------------------
+    //                  Line clearer with per-line clean tags
+    // -------------------------------------------------------------------------
+    // clean[b][y]: line y of buffer b holds nothing but the clear colour. A
+    // front buffer that is sure to be swapped out at the next frame pulse
+    // (S_WAIT; with three buffers, a ready frame queued) is cleared line by
+    // line behind the beam, through its own BRAM write port, while the CPU
+    // waits or draws elsewhere. S_CLEAR then only clears the lines still
+    // left, often none, so the CPU gets the buffer at the swap rather than
+    // a whole-buffer pass (FB_WIDTH * FB_HEIGHT clocks) later. The tags of
+    // the buffer being drawn are dropped, the CPU may write any line of it.
+    reg [FB_HEIGHT-1:0] clean [0:NUM_BUFFERS-1];
+    reg [8:0]       clr_y;           // line being cleared or skipped
+    reg [7:0]       clr_x;
+    reg [ADDRW-1:0] clr_base;        // clr_y * FB_WIDTH
+    reg             clr_was;         // clearer active last clock, on clr_prev
+    reg [1:0]       clr_prev;
+    reg             clr_we;
+    reg [ADDRW-1:0] clr_addr;
+    reg [1:0]       clr_buf_w;       // buffer clr_we writes
+
+    wire       leaving     = TRIPLE ? ready_valid : (state == S_WAIT);
+    wire       clr_active  = CLEAR_BACK && (state == S_CLEAR || leaving);
+    wire [1:0] clr_buf     = (state == S_CLEAR) ? fb_draw : fb_front;
+    wire       clr_restart = ~clr_was | (clr_buf != clr_prev);
+    wire       clr_passed  = (beam_lines_s > clr_y);   // beam is past the line
+
+    assign clear_done = (state == S_CLEAR) & ~clr_restart & (clr_y == FB_HEIGHT);
+
+    integer cb;
+    always @(posedge clk_axi) begin
+        clr_we   <= 1'b0;
+        clr_was  <= clr_active;
+        clr_prev <= clr_buf;
+        if (rst_axi) begin
+            for (cb = 0; cb < NUM_BUFFERS; cb = cb + 1)
+                clean[cb] <= {FB_HEIGHT{1'b0}};
+            clr_was <= 1'b0;
+        end else begin
+            if (state == S_DRAW)
+                clean[fb_draw] <= {FB_HEIGHT{1'b0}};
+            if (!clr_active || clr_restart) begin
+                clr_y    <= 9'd0;
+                clr_x    <= 8'd0;
+                clr_base <= {ADDRW{1'b0}};
+            end
+            else if (clr_y != FB_HEIGHT) begin
+                if (clean[clr_buf][clr_y]) begin
+                    clr_y    <= clr_y + 1'b1;
+                    clr_base <= clr_base + FB_WIDTH;
+                end
+                else if (state == S_CLEAR || clr_passed) begin
+                    clr_we    <= 1'b1;
+                    clr_addr  <= clr_base + clr_x;
+                    clr_buf_w <= clr_buf;
+                    clr_x     <= clr_x + 1'b1;
+                    if (clr_x == FB_WIDTH - 1) begin
+                        clr_x    <= 8'd0;
+                        clr_y    <= clr_y + 1'b1;
+                        clr_base <= clr_base + FB_WIDTH;
+                        clean[clr_buf][clr_y] <= 1'b1;
+                    end
+                end
+            end
+        end
+    end
+
+    // -------------------------------------------------------------------------
+    //            Write-side mux (fill, blitter or CPU)
+    // -------------------------------------------------------------------------
+    // axi_fb_slave holds CPU pixel writes back while blit_busy or fill_busy,
+    // and each engine's commands while the other one is busy, so writes
+    // never collide and land in the order they were issued
     reg [ADDRW-1:0] fb_addr_write;
     reg [BPP-1:0]   fb_data_write;
-    reg             fb_we;
 
-    always @(posedge clk_pix) begin
-        if (rst_pix) fb_we <= 1'b0;
+    always @(posedge clk_axi) begin
+        if (rst_axi) fb_we <= 1'b0;
         else begin
-            if (clearing) begin
-                fb_addr_write <= clear_addr;
-                fb_data_write <= {BPP{1'b0}};
+            if (fill_we) begin
+                fb_addr_write <= fill_addr;
+                fb_data_write <= fill_dat;
                 fb_we         <= 1'b1;
             end
+            else if (blit_we) begin
+                fb_addr_write <= blit_addr;
+                fb_data_write <= blit_dat;
+                fb_we         <= 1'b1;
+            end
+            else if (w8_busy && !w8_lane) begin
+                fb_addr_write <= {w8_group[ADDRW-4:0], w8_cnt};
+                fb_data_write <= w8_dat[BPP-1:0];
+                fb_we         <= w8_mask[0] & ({w8_group[ADDRW-4:0], w8_cnt} < DEPTH0);
+            end
             else if (state == S_DRAW) begin
                 fb_addr_write <= cpu_addr[ADDRW-1:0];
                 fb_data_write <= cpu_dat;
@@ -175,69 +606,184 @@ module vga_framebuffer_top #(
     end
 
     // S4: final address
-    reg [ADDRW-1:0] pix_addr_r4; reg in_win_r4;
+    reg [ADDRW-1:0] pix_addr_r4; reg in_win_r4; reg [7:0] x_off_r4;
     always @(posedge clk_pix) begin
         pix_addr_r4 <= row_base_r3 + x_off_r3;
         in_win_r4   <= in_win_r3;
+        x_off_r4    <= x_off_r3[7:0];
+    end
+
+    // -------------------------------------------------------------------------
+    //          Object layer, line buffer read in step with the BRAMs
+    // -------------------------------------------------------------------------
+    wire [BPP:0] obj;
+
+    oam_layer #(
+        .FB_WIDTH    (FB_WIDTH),
+        .FB_HEIGHT   (FB_HEIGHT),
+        .Y0          (Y0),
+        .BPP         (BPP),
+        .SPRITE_FILE (SPRITE_FILE)
+    ) u_oam (
+        .clk_pix     (clk_pix),
+        .rst_pix     (rst_pix),
+        .oam_we      (cpu_oam_we),
+        .oam_idx     (cpu_oam_idx),
+        .oam_dat     (cpu_oam_dat),
+        .bank        (layer_bank_s),
+        .line        (line),
+        .sy          (sy),
+        .frame_pulse (frame_pulse),
+        .rd_en       (in_win_r4),
+        .rd_x        (x_off_r4),
+        .obj         (obj),
+        .dropped     (oam_dropped)
+    );
+
+    // -------------------------------------------------------------------------
+    //          Tile layer, 4 clocks from the offsets like the BRAM read
+    // -------------------------------------------------------------------------
+    wire [BPP-1:0] tile_col_r5;
+
+    tile_layer #(
+        .BPP       (BPP),
+        .TILE_FILE (TILE_FILE)
+    ) u_tiles (
+        .clk_pix  (clk_pix),
+        .tile_we  (cpu_tile_we),
+        .tile_idx (cpu_tile_idx),
+        .tile_dat (cpu_tile_dat),
+        .bank     (layer_bank_s),
+        .x        (x_off_r2[7:0]),
+        .y        (y_off_r2[7:0]),
+        .col      (tile_col_r5)
+    );
+
+    // -------------------------------------------------------------------------
+    //     Lane layer, written by the packed port, read like the tile layer
+    // -------------------------------------------------------------------------
+    // Left out with three frame buffers or LANES = 0: its two banks and the
+    // third buffer, or the 64 KB LMB of the profiling build, do not both fit
+    // the 50 BRAM36 of the Basys-3
+    wire [BPP-1:0] lane_col_r5;
+
+    generate
+    if (TRIPLE || !LANES) begin : g_no_lanes
+        assign lane_col_r5 = {BPP{1'b0}};
     end
+    else begin : g_lanes
+        lane_layer #(
+            .BPP (BPP)
+        ) u_lanes (
+            .clk_pix     (clk_pix),
+            .clk_wr      (clk_axi),
+            .wr_en       (w8_busy & w8_lane & w8_mask[0] & (state == S_DRAW)),
+            .wr_band     (w8_group[13:10]),
+            .wr_row      (w8_group[9:6]),
+            .wr_col      ({w8_group[5:0], w8_cnt}),
+            .wr_dat      (w8_dat[BPP-1:0]),
+            .wr_bank     (layer_bank),
+            .scroll_we   (cpu_scroll_we),
+            .scroll_band (cpu_scroll_band),
+            .scroll_dat  (cpu_scroll_dat),
+            .bank        (layer_bank_s),
+            .x           (x_off_r2[7:0]),
+            .y           (y_off_r2[7:0]),
+            .col         (lane_col_r5)
+        );
+    end
+    endgenerate
 
     // -------------------------------------------------------------------------
     //                Dual-port BRAMs (simple dual-port)
     // -------------------------------------------------------------------------
-    wire [BPP-1:0] dout0, dout1;
+    // buffer k takes the writes while it is fb_draw, and the line clearer's
+    // while it clears k
+    wire [BPP-1:0] dout0, dout1, dout2;
+    wire [2:0] clr_sel = {3{clr_we}} & {clr_buf_w == 2'd2, clr_buf_w == 2'd1, clr_buf_w == 2'd0};
 
     bram_sdp #(.WIDTH(BPP), .DEPTH(DEPTH0), .INIT_F(INIT_FILE)) bram0 (
-        .clk_write (clk_pix),
+        .clk_write (clk_axi),
         .clk_read  (clk_pix),
-        .we        (fb_we &  fb_front),
-        .addr_write(fb_addr_write),
+        .we        ((fb_we & (fb_draw == 2'd0)) | clr_sel[0]),
+        .addr_write(clr_sel[0] ? clr_addr : fb_addr_write),
         .addr_read (pix_addr_r4),
-        .data_in   (fb_data_write),
+        .data_in   (clr_sel[0] ? cpu_clear_col : fb_data_write),
         .data_out  (dout0)
     );
 
     bram_sdp #(.WIDTH(BPP), .DEPTH(DEPTH0), .INIT_F(INIT_FILE)) bram1 (
-        .clk_write (clk_pix),
+        .clk_write (clk_axi),
         .clk_read  (clk_pix),
-        .we        (fb_we & ~fb_front),
-        .addr_write(fb_addr_write),
+        .we        ((fb_we & (fb_draw == 2'd1)) | clr_sel[1]),
+        .addr_write(clr_sel[1] ? clr_addr : fb_addr_write),
         .addr_read (pix_addr_r4),
-        .data_in   (fb_data_write),
+        .data_in   (clr_sel[1] ? cpu_clear_col : fb_data_write),
         .data_out  (dout1)
     );
 
+    generate
+    if (TRIPLE) begin : g_bram2
+        bram_sdp #(.WIDTH(BPP), .DEPTH(DEPTH0), .INIT_F(INIT_FILE)) bram2 (
+            .clk_write (clk_axi),
+            .clk_read  (clk_pix),
+            .we        ((fb_we & (fb_draw == 2'd2)) | clr_sel[2]),
+            .addr_write(clr_sel[2] ? clr_addr : fb_addr_write),
+            .addr_read (pix_addr_r4),
+            .data_in   (clr_sel[2] ? cpu_clear_col : fb_data_write),
+            .data_out  (dout2)
+        );
+    end
+    else begin : g_no_bram2
+        assign dout2 = {BPP{1'b0}};
+    end
+    endgenerate
+
     // -------------------------------------------------------------------------
     //                Front-buffer selector (5-cycle delay)
     // -------------------------------------------------------------------------
-    reg [4:0] fb_front_d;
-    always @(posedge clk_pix) fb_front_d <= {fb_front_d[3:0], fb_front};
+    reg [9:0] fb_front_d;
+    always @(posedge clk_pix) fb_front_d <= {fb_front_d[7:0], fb_front_s};
 
-    reg [BPP-1:0] pix_col_r5; reg in_win_r5;
+    reg [BPP-1:0] pix_col_r5; reg [BPP:0] obj_r5; reg in_win_r5;
     always @(posedge clk_pix) begin
-        pix_col_r5 <= fb_front_d[4] ? dout1 : dout0;
+        pix_col_r5 <= (fb_front_d[9:8] == 2'd2) ? dout2 :
+                      (fb_front_d[9:8] == 2'd1) ? dout1 : dout0;
+        obj_r5     <= obj;
         in_win_r5  <= in_win_r4;
     end
 
+    // frame buffer colour 0 shows the lane layer, and lane colour 0 the tile
+    // layer; the object pixel wins unless transparent, or marked behind and
+    // the frame buffer pixel is not 0
+    wire fb_clear  = (pix_col_r5 == {BPP{1'b0}});
+    wire obj_shown = (obj_r5[BPP-1:0] != {BPP{1'b0}}) & (~obj_r5[BPP] | fb_clear);
+    wire [BPP-1:0] col_r5 = obj_shown ? obj_r5[BPP-1:0] :
+                            !fb_clear ? pix_col_r5 :
+                            (lane_col_r5 != {BPP{1'b0}}) ? lane_col_r5 : tile_col_r5;
+
     // -------------------------------------------------------------------------
     //                     16-entry RGB444 palette
     // -------------------------------------------------------------------------
-    reg [11:0] palette [0:15];
-    initial begin
-        palette[ 0]=12'h000; palette[ 1]=12'h004;
-        palette[ 2]=12'h00F; palette[ 3]=12'h0DF;
-        palette[ 4]=12'hFF0; palette[ 5]=12'h9F0;
-        palette[ 6]=12'h2D0; palette[ 7]=12'hF0F;
-        palette[ 8]=12'h90F; palette[ 9]=12'hF40;
-        palette[10]=12'hF00; palette[11]=12'hD64;
-        palette[12]=12'h964; palette[13]=12'hDDF;
-        palette[14]=12'hFFF; palette[15]=12'h000;
-    end
+    // palette.mem is the one palette of the assets: frogger_host/assetgen
+    // maps the sprite sheets onto it and writes it into sprites.h. It is
+    // the reset value; the CPU rewrites entries and cycles ranges of them
+    wire [11:0] rgb_r6; reg in_win_r6;
 
-    reg [11:0] rgb_r6; reg in_win_r6;
-    always @(posedge clk_pix) begin
-        rgb_r6    <= palette[pix_col_r5];
-        in_win_r6 <= in_win_r5;
-    end
+    palette_regs #(
+        .PALETTE_FILE (PALETTE_FILE),
+        .CYCLES       (PAL_CYCLES)
+    ) u_palette (
+        .clk_pix     (clk_pix),
+        .pal_we      (cpu_pal_we),
+        .pal_idx     (cpu_pal_idx),
+        .pal_dat     (cpu_pal_dat),
+        .frame_pulse (frame_pulse),
+        .col         (col_r5),
+        .rgb         (rgb_r6)
+    );
+
+    always @(posedge clk_pix) in_win_r6 <= in_win_r5;
 
     // output RGB
     assign VGA_Red   = in_win_r6 ? rgb_r6[11:8] : 4'h0;